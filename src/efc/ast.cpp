@@ -5,8 +5,11 @@
 #include "env.h"
 #include "errorhandler.h"
 #include "irgen.h"
+#include "stackgrowth.h"
 
 #include <cassert>
+#include <climits>
+#include <cstdint>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
@@ -39,22 +42,43 @@ thread_local shared_ptr<const ObjTypeFunda> objTypeFundaVoid =
 
 thread_local shared_ptr<const ObjTypeFunda> objTypeFundaNoreturn =
   make_shared<ObjTypeFunda>(ObjTypeFunda::eNoreturn);
+
+/** See AstNode::deleteLater */
+thread_local vector<AstNode*> toBeDeletedLater;
+/** Whether the destructor of an AST node is currently deleting the nodes in
+toBeDeletedLater */
+thread_local bool isDeletingLater = false;
 }
 
 bool DisableLocationRequirement::m_areLocationsRequired = true;
 
-AstNode::AstNode(Location loc) : m_loc{move(loc)} {
+AstNode::AstNode(EKind kind, Location loc) : m_loc{move(loc)}, m_kind{kind} {
   if (DisableLocationRequirement::areLocationsRequired()) {
     assert(!m_loc.isNull());
   }
 }
 
+AstNode::~AstNode() {
+  if (isDeletingLater) { return; }
+  isDeletingLater = true;
+  while (!toBeDeletedLater.empty()) {
+    const auto node = toBeDeletedLater.back();
+    toBeDeletedLater.pop_back();
+    delete node;
+  }
+  isDeletingLater = false;
+}
+
+void AstNode::deleteLater(AstNode* child) {
+  if (child) { toBeDeletedLater.push_back(child); }
+}
+
 string AstNode::toStr() const {
   return AstPrinter::toStr(*this);
 }
 
-AstObject::AstObject(Location loc)
-  : AstNode{move(loc)}, m_accessFromAstParent{Access::eYetUndefined} {
+AstObject::AstObject(EKind kind, Location loc)
+  : AstNode{kind, move(loc)}, m_accessFromAstParent{Access::eYetUndefined} {
 }
 
 bool AstObject::isObjTypeNoReturn() const {
@@ -73,7 +97,8 @@ Access AstObject::accessFromAstParent() const {
   return m_accessFromAstParent;
 }
 
-AstObjDef::AstObjDef(Location loc) : AstObject(move(loc)) {
+AstObjDef::AstObjDef(EKind kind, Location loc)
+  : AstObject(kind, move(loc)) {
 }
 
 basic_ostream<char>& AstObjDef::printTo(basic_ostream<char>& os) const {
@@ -86,17 +111,19 @@ basic_ostream<char>& AstObjDef::printTo(basic_ostream<char>& os) const {
 }
 
 AstNop::AstNop(Location loc)
-  : AstObject{std::move(loc)}
+  : AstObject{EKind::eNop, std::move(loc)}
   , FullConcreteObject{objTypeFundaVoid, StorageDuration::eLocal} {
 }
 
 AstBlock::AstBlock(AstObject* body, Location loc)
   : Object{Env::makeUniqueInternalName("$block")}
-  , AstObject{move(loc)}
+  , AstObject{EKind::eBlock, move(loc)}
   , m_body{body} {
   assert(m_body);
 }
 
+AstBlock::~AstBlock() { deleteChildsLater(m_body); }
+
 const ObjType& AstBlock::objType() const {
   return *objTypeAsSp();
 }
@@ -116,7 +143,7 @@ AstCast::AstCast(AstObjType* specifiedNewAstObjType, AstObject* arg)
 
 AstCast::AstCast(
   AstObjType* specifiedNewAstObjType, AstCtList* args, Location loc)
-  : AstObject{move(loc)}
+  : AstObject{EKind::eCast, move(loc)}
   , m_specifiedNewAstObjType{specifiedNewAstObjType != nullptr
         ? unique_ptr<AstObjType>{specifiedNewAstObjType}
         : make_unique<AstObjTypeSymbol>(ObjTypeFunda::eInfer)}
@@ -128,6 +155,8 @@ AstCast::AstCast(ObjTypeFunda::EType specifiedNewOjType, AstObject* child)
   : AstCast{new AstObjTypeSymbol{specifiedNewOjType}, child} {
 }
 
+AstCast::~AstCast() { deleteChildsLater(m_specifiedNewAstObjType, m_args); }
+
 AstObjType& AstCast::specifiedNewAstObjType() const {
   return *m_specifiedNewAstObjType;
 }
@@ -147,15 +176,16 @@ StorageDuration AstCast::storageDuration() const {
 AstFunDef::AstFunDef(const string& name, vector<AstDataDef*>* args,
   AstObjType* ret, AstObject* body, Location loc)
   : Object{name}
-  , AstObjDef{move(loc)}
+  , AstObjDef{EKind::eFunDef, move(loc)}
   , m_args{toUniquePtrs(args)}
   , m_ret{ret}
   , m_body{body} {
   assert(m_ret);
-  assert(m_body);
   for (const auto& arg : m_args) { assert(arg); }
 }
 
+AstFunDef::~AstFunDef() { deleteChildsLater(m_args, m_ret, m_body); }
+
 std::string AstFunDef::description() const {
   return "function definition of " + fqName() + " defined here '" +
     toString(loc()) + "'";
@@ -216,7 +246,7 @@ AstObject* const AstDataDef::noInit = reinterpret_cast<AstObject*>(1);
 AstDataDef::AstDataDef(const string& name, AstObjType* declaredAstObjType,
   StorageDuration declaredStorageDuration, AstCtList* ctorArgs, Location loc)
   : Object{name}
-  , AstObjDef{loc}
+  , AstObjDef{EKind::eDataDef, loc}
   , m_doNotInit{false} // conceptually initialized by mkCtorArgs below
   , m_declaredAstObjType{declaredAstObjType != nullptr
         ? unique_ptr<AstObjType>{declaredAstObjType}
@@ -245,6 +275,10 @@ AstDataDef::AstDataDef(const string& name, ObjTypeFunda::EType declaredObjType,
   : AstDataDef{name, new AstObjTypeSymbol{declaredObjType, loc}, initObj, loc} {
 }
 
+AstDataDef::~AstDataDef() {
+  deleteChildsLater(m_declaredAstObjType, m_ctorArgs);
+}
+
 std::string AstDataDef::description() const {
   return "data definition of " + fqName() + " defined here '" +
     toString(loc()) + "'";
@@ -289,7 +323,7 @@ StorageDuration AstDataDef::declaredStorageDuration() const {
 }
 
 AstNumber::AstNumber(GeneralValue value, AstObjType* astObjType, Location loc)
-  : AstObject{loc}
+  : AstObject{EKind::eNumber, loc}
   , m_value{value}
   , m_declaredAstObjType{astObjType != nullptr
         ? astObjType
@@ -302,6 +336,8 @@ AstNumber::AstNumber(
   : AstNumber{value, new AstObjTypeSymbol{eType, loc}, loc} {
 }
 
+AstNumber::~AstNumber() { deleteChildsLater(m_declaredAstObjType); }
+
 AstObjType& AstNumber::declaredAstObjType() const {
   assert(m_declaredAstObjType);
   return *m_declaredAstObjType;
@@ -320,7 +356,7 @@ StorageDuration AstNumber::storageDuration() const {
 }
 
 AstSymbol::AstSymbol(std::string name, Location loc)
-  : AstObject{std::move(loc)}
+  : AstObject{EKind::eSymbol, std::move(loc)}
   , m_referencedObj{nullptr}
   , m_name{std::move(name)} {
 }
@@ -352,14 +388,20 @@ bool AstSymbol::isInitialized() const {
 
 const map<const string, const AstOperator::EOperation> AstOperator::m_opMap{
   {"and", eAnd}, {"&&", eAnd}, {"or", eOr}, {"||", eOr}, {"==", eEqualTo},
-  {"=<", eAssign}, {"not", eNot}};
+  {"=<", eAssign}, {"not", eNot}, {"lane", eLane}, {"withlane", eWithLane},
+  {"hadd", eHAdd}, {"hmul", eHMul}, {"index", eIndex}, {"<<", eShl},
+  {">>", eShr}, {"ctpop", eCtpop}, {"ctlz", eCtlz}, {"cttz", eCttz},
+  {"bswap", eBswap}};
 
 // in case of ambiguity, prefer one letters over symbols. Also note that
 // single char operators are prefered over multi chars; the single chars are
 // not even in the map.
 const map<const AstOperator::EOperation, const string>
   AstOperator::m_opReverseMap{{eAnd, "and"}, {eOr, "or"}, {eEqualTo, "=="},
-    {eAssign, "=<"}, {eDeref, "*"}};
+    {eAssign, "=<"}, {eDeref, "*"}, {eLane, "lane"}, {eWithLane, "withlane"},
+    {eHAdd, "hadd"}, {eHMul, "hmul"}, {eIndex, "index"}, {eBitAnd, "&"},
+    {eShl, "<<"}, {eShr, ">>"}, {eCtpop, "ctpop"}, {eCtlz, "ctlz"},
+    {eCttz, "cttz"}, {eBswap, "bswap"}};
 
 AstOperator::AstOperator(char op, AstCtList* args, Location loc)
   : AstOperator{static_cast<EOperation>(op), args, move(loc)} {
@@ -371,7 +413,7 @@ AstOperator::AstOperator(const string& op, AstCtList* args, Location loc)
 
 AstOperator::AstOperator(
   AstOperator::EOperation op, AstCtList* args, Location loc)
-  : AstObject{move(loc)}
+  : AstObject{EKind::eOperator, move(loc)}
   , m_referencedObj{nullptr}
   , m_op{op}
   , m_args{args != nullptr ? unique_ptr<AstCtList>{args}
@@ -385,9 +427,6 @@ AstOperator::AstOperator(
       // nop - it's a semantic error if there are no arguments, but it's the job
       // of the SemanticAnalizer to report an error.
     }
-    else if (class_() == AstOperator::eComparison) {
-      m_obj->m_objType = std::make_unique<ObjTypeFunda>(ObjTypeFunda::eBool);
-    }
     else if (m_op == AstOperator::eVoidAssign) {
       m_obj->m_objType = make_shared<ObjTypeFunda>(ObjTypeFunda::eVoid);
     }
@@ -401,14 +440,21 @@ AstOperator::AstOperator(
     // nop - settig m_referencedObj to the proper object is done later by
     // SemanticAnalizer
   }
-  if ('-' == m_op || '+' == m_op) {
-    const auto argCnt = m_args->childs().size();
-    assert(argCnt == 1 || argCnt == 2);
-  }
+  const auto argCnt = m_args->childs().size();
+  if ('-' == m_op) { assert(argCnt == 1 || argCnt == 2); }
+  else if ('+' == m_op) { assert(argCnt >= 1); }
+  else if (isNAry(m_op)) { assert(argCnt >= 2); }
   else {
-    const size_t required_arity =
-      (op == eNot || op == eAddrOf || op == eDeref) ? 1 : 2;
-    assert(m_args->childs().size() == required_arity);
+    size_t required_arity = 2;
+    if (op == eNot || op == eAddrOf || op == eDeref || op == eHAdd ||
+      op == eHMul || op == eCtpop || op == eCtlz || op == eCttz ||
+      op == eBswap) {
+      required_arity = 1;
+    }
+    else if (op == eWithLane) {
+      required_arity = 3;
+    }
+    assert(argCnt == required_arity);
   }
 }
 
@@ -427,6 +473,8 @@ AstOperator::AstOperator(AstOperator::EOperation op, AstObject* operand1,
   : AstOperator{op, new AstCtList{loc, operand1, operand2}, loc} {
 }
 
+AstOperator::~AstOperator() { deleteChildsLater(m_args); }
+
 void AstOperator::addAccess(Access access) {
   // do it the normal way if possible
   if (m_referencedObj != nullptr) { ObjectDelegate::addAccess(access); }
@@ -455,6 +503,11 @@ void AstOperator::setReferencedObjAndPropagateAccess(Object& object) {
   m_referencedObj->addAccess(accessFromAstParent());
 }
 
+void AstOperator::setIndexIsProvablyInRange(bool isInRange) {
+  assert(m_op == eIndex);
+  m_isIndexProvablyInRange = isInRange;
+}
+
 void AstOperator::setObjType(shared_ptr<const ObjType> objType) {
   assert(objType);
   assert(!returnsByRef()); // can't set obj type of m_referencedObj
@@ -478,10 +531,14 @@ AstOperator::EClass AstOperator::class_() const {
   return classOf(m_op);
 }
 
-bool AstOperator::isBinaryLogicalShortCircuit() const {
+bool AstOperator::isLogicalShortCircuit() const {
   return m_op == eAnd || m_op == eOr;
 }
 
+bool AstOperator::isNAry(EOperation op) {
+  return op == eAdd || op == eMul || op == eAnd || op == eOr;
+}
+
 AstOperator::EClass AstOperator::classOf(AstOperator::EOperation op) {
   switch (op) {
   case eVoidAssign:
@@ -496,10 +553,27 @@ AstOperator::EClass AstOperator::classOf(AstOperator::EOperation op) {
   case eAnd:
   case eOr: return eLogical;
 
-  case eEqualTo: return eComparison;
+  case eBitAnd:
+  case eBitOr:
+  case eXor:
+  case eShl:
+  case eShr:
+  case eCtpop:
+  case eCtlz:
+  case eCttz:
+  case eBswap: return eBitwise;
+
+  case eEqualTo:
+  case eLess: return eComparison;
 
   case eAddrOf:
-  case eDeref: return eMemberAccess;
+  case eDeref:
+  case eIndex: return eMemberAccess;
+
+  case eLane:
+  case eWithLane:
+  case eHAdd:
+  case eHMul: return eSimd;
   }
   assert(false);
   return eOther;
@@ -508,6 +582,7 @@ AstOperator::EClass AstOperator::classOf(AstOperator::EOperation op) {
 AstOperator::EOperation AstOperator::toEOperationPreferingBinary(
   const string& op) {
   if (op == "*") { return eMul; }
+  if (op == "&") { return eBitAnd; }
   return toEOperation(op);
 }
 
@@ -523,7 +598,8 @@ AstOperator::EOperation AstOperator::toEOperation(const string& op) {
 }
 
 bool AstOperator::returnsByRef() const {
-  return m_op == AstOperator::eAssign || m_op == AstOperator::eDeref;
+  return m_op == AstOperator::eAssign || m_op == AstOperator::eDeref ||
+    m_op == AstOperator::eIndex;
 }
 
 basic_ostream<char>& operator<<(
@@ -554,15 +630,21 @@ AstSeq::AstSeq(
 }
 
 AstSeq::AstSeq(vector<unique_ptr<AstNode>>&& operands)
-  : AstObject{locationOf(operands)}, m_operands{move(operands)} {
+  : AstObject{EKind::eSeq, locationOf(operands)}
+  , m_operands{move(operands)}
+  , m_referencedObj{&m_dummyObj} {
   for (const auto& operand : m_operands) { assert(operand); }
   assert(!m_operands.empty());
+  if (const auto lastSeq = dynamic_cast<AstSeq*>(m_operands.back().get())) {
+    m_referencedObj = &lastSeq->referencedObj();
+  } else if (lastOperandIsAnObject()) {
+    m_referencedObj = &lastOperand();
+  }
 }
 
-Object& AstSeq::referencedObj() const {
-  if (lastOperandIsAnObject()) { return lastOperand(); }
-  return m_dummyObj;
-}
+AstSeq::~AstSeq() { deleteChildsLater(m_operands); }
+
+Object& AstSeq::referencedObj() const { return *m_referencedObj; }
 
 bool AstSeq::lastOperandIsAnObject() const {
   return nullptr != dynamic_cast<AstObject*>(m_operands.back().get());
@@ -576,7 +658,7 @@ AstObject& AstSeq::lastOperand() const {
 
 AstIf::AstIf(
   AstObject* cond, AstObject* action, AstObject* elseAction, Location loc)
-  : AstObject{move(loc)}
+  : AstObject{EKind::eIf, move(loc)}
   , m_condition{cond}
   , m_action{action}
   , m_elseAction{elseAction} {
@@ -584,6 +666,8 @@ AstIf::AstIf(
   assert(m_action);
 }
 
+AstIf::~AstIf() { deleteChildsLater(m_condition, m_action, m_elseAction); }
+
 const ObjType& AstIf::objType() const {
   assert(m_objType);
   return *m_objType;
@@ -605,11 +689,21 @@ void AstIf::setObjectType(shared_ptr<const ObjType> objType) {
 }
 
 AstLoop::AstLoop(AstObject* cond, AstObject* body, Location loc)
-  : AstObject{move(loc)}, m_condition(cond), m_body(body) {
+  : AstLoop{cond, body, LoopHints{}, move(loc)} {
+}
+
+AstLoop::AstLoop(
+  AstObject* cond, AstObject* body, LoopHints hints, Location loc)
+  : AstObject{EKind::eLoop, move(loc)}
+  , m_hints{hints}
+  , m_condition(cond)
+  , m_body(body) {
   assert(m_condition);
   assert(m_body);
 }
 
+AstLoop::~AstLoop() { deleteChildsLater(m_condition, m_body); }
+
 const ObjType& AstLoop::objType() const {
   return *objTypeFundaVoid;
 }
@@ -628,12 +722,14 @@ AstReturn::AstReturn(AstObject* retVal, Location loc)
 }
 
 AstReturn::AstReturn(AstCtList* ctorArgs, Location loc)
-  : AstObject{loc}
+  : AstObject{EKind::eReturn, loc}
   , m_ctorArgs{ctorArgs != nullptr ? unique_ptr<AstCtList>{ctorArgs}
                                    : make_unique<AstCtList>(loc)} {
   if (m_ctorArgs->childs().empty()) { m_ctorArgs->Add(new AstNop{loc}); }
 }
 
+AstReturn::~AstReturn() { deleteChildsLater(m_ctorArgs); }
+
 const ObjType& AstReturn::objType() const {
   return *objTypeFundaNoreturn;
 }
@@ -646,8 +742,88 @@ StorageDuration AstReturn::storageDuration() const {
   return StorageDuration::eLocal;
 }
 
+AstRawNew::AstRawNew(
+  AstObjType* specifiedAstObjType, AstCtList* args, Location loc)
+  : AstObject{EKind::eRawNew, move(loc)}
+  , m_isStackPromoted{false}
+  , m_specifiedAstObjType{specifiedAstObjType}
+  , m_args{args != nullptr ? unique_ptr<AstCtList>{args}
+                           : make_unique<AstCtList>()} {
+  assert(m_specifiedAstObjType);
+}
+
+AstRawNew::~AstRawNew() { deleteChildsLater(m_specifiedAstObjType, m_args); }
+
+const ObjType& AstRawNew::objType() const {
+  return *objTypeAsSp();
+}
+
+shared_ptr<const ObjType> AstRawNew::objTypeAsSp() const {
+  if (!m_objType) {
+    m_objType =
+      make_shared<ObjTypePtr>(m_specifiedAstObjType->objTypeAsSp());
+  }
+  return m_objType;
+}
+
+StorageDuration AstRawNew::storageDuration() const {
+  return StorageDuration::eLocal;
+}
+
+AstRawDelete::AstRawDelete(AstObject* ptr, Location loc)
+  : AstObject{EKind::eRawDelete, move(loc)}
+  , m_isStackPromoted{false}
+  , m_ptr{ptr} {
+  assert(m_ptr);
+}
+
+AstRawDelete::~AstRawDelete() { deleteChildsLater(m_ptr); }
+
+const ObjType& AstRawDelete::objType() const {
+  return *objTypeFundaVoid;
+}
+
+shared_ptr<const ObjType> AstRawDelete::objTypeAsSp() const {
+  return objTypeFundaVoid;
+}
+
+StorageDuration AstRawDelete::storageDuration() const {
+  return StorageDuration::eLocal;
+}
+
+AstMemberAccess::AstMemberAccess(
+  AstObject* obj, string memberName, Location loc)
+  : AstObject{EKind::eMemberAccess, move(loc)}
+  , m_obj{obj}
+  , m_memberName{move(memberName)} {
+  assert(m_obj);
+}
+
+AstMemberAccess::~AstMemberAccess() { deleteChildsLater(m_obj); }
+
+void AstMemberAccess::addAccess(Access access) {
+  // Not yet possible before the referenced object is known. Will be done
+  // later in setReferencedObjAndPropagateAccess
+  if (m_referencedObj) { ObjectDelegate::addAccess(access); }
+}
+
+Object& AstMemberAccess::referencedObj() const {
+  assert(m_referencedObj);
+  return *m_referencedObj;
+}
+
+void AstMemberAccess::setReferencedObjAndPropagateAccess(
+  unique_ptr<Object> object) {
+  assert(object);
+  assert(!m_referencedObj); // it doesn't make sense to set it twice
+  m_referencedObj = move(object);
+  m_referencedObj->addAccess(accessFromAstParent());
+}
+
 AstFunCall::AstFunCall(AstObject* address, AstCtList* args, Location loc)
-  : AstObject{move(loc)}
+  : AstObject{EKind::eFunCall, move(loc)}
+  , m_builtin{eNoBuiltin}
+  , m_isTailCall{false}
   , m_address{address != nullptr ? unique_ptr<AstObject>{address}
                                  : make_unique<AstSymbol>("")}
   , m_args{args != nullptr ? unique_ptr<AstCtList>{args}
@@ -656,11 +832,50 @@ AstFunCall::AstFunCall(AstObject* address, AstCtList* args, Location loc)
   assert(m_args);
 }
 
+AstFunCall::~AstFunCall() { deleteChildsLater(m_address, m_args); }
+
+const map<const string, const AstFunCall::EBuiltin> AstFunCall::m_builtinMap{
+  {"sqrt", eSqrt},
+  {"fma", eFma},
+  {"floor", eFloor},
+  {"ceil", eCeil},
+  {"trunc", eTrunc},
+  {"round", eRound},
+  {"abs", eAbs},
+  {"min", eMin},
+  {"max", eMax},
+  {"likely", eLikely},
+  {"unlikely", eUnlikely},
+  {"expect_trips", eExpectTrips}};
+
+void AstFunCall::setBuiltin(EBuiltin builtin) {
+  assert(m_builtin == eNoBuiltin);
+  m_builtin = builtin;
+}
+
+AstFunCall::EBuiltin AstFunCall::toBuiltin(const string& name) {
+  const auto i = m_builtinMap.find(name);
+  return i == m_builtinMap.end() ? eNoBuiltin : i->second;
+}
+
+size_t AstFunCall::arityOf(EBuiltin builtin) {
+  switch (builtin) {
+  case eFma: return 3;
+  case eMin:
+  case eMax:
+  case eExpectTrips: return 2;
+  default: return 1;
+  }
+}
+
 const ObjType& AstFunCall::objType() const {
   return *objTypeAsSp();
 }
 
 shared_ptr<const ObjType> AstFunCall::objTypeAsSp() const {
+  if (m_builtin != eNoBuiltin) {
+    return m_args->childs().front()->objType().unqualifiedObjType();
+  }
   const auto objTypeFun =
     dynamic_pointer_cast<const ObjTypeFun>(m_address->objTypeAsSp());
   assert(objTypeFun);
@@ -672,11 +887,12 @@ StorageDuration AstFunCall::storageDuration() const {
 }
 
 AstObjTypeSymbol::AstObjTypeSymbol(string name, Location loc)
-  : AstObjType{move(loc)}, m_name{move(name)} {
+  : AstObjType{EKind::eObjTypeSymbol, move(loc)}, m_name{move(name)} {
 }
 
 AstObjTypeSymbol::AstObjTypeSymbol(ObjTypeFunda::EType fundaType, Location loc)
-  : AstObjType{move(loc)}, m_name{toName(fundaType)} {
+  : AstObjType{EKind::eObjTypeSymbol, move(loc)}
+  , m_name{toName(fundaType)} {
   assert(fundaType != ObjTypeFunda::ePointer);
 }
 
@@ -713,23 +929,40 @@ array<string, ObjTypeFunda::eTypeCnt> AstObjTypeSymbol::m_typeToName{};
 bool AstObjTypeSymbol::m_isMapInitialzied = false;
 
 void AstObjTypeSymbol::printValueTo(ostream& os, GeneralValue value) const {
+  if (!denotesFundaType()) {
+    os << m_name << "(" << value << ")";
+    return;
+  }
   const auto type = toType(m_name);
   if (type == ObjTypeFunda::eChar) { os << "'" << char(value) << "'"; }
   else if (type == ObjTypeFunda::eNullptr) {
     os << "nullptr";
   }
   else {
-    os << value;
+    // Printing integral values as integers, since for large values the
+    // default floating point format would loose digits
     switch (type) {
-    case ObjTypeFunda::eBool: os << "bool"; break;
-    case ObjTypeFunda::eInt: break;
-    case ObjTypeFunda::eDouble: os << "d"; break;
+    case ObjTypeFunda::eBool: os << value << "bool"; break;
+    case ObjTypeFunda::eInt: os << static_cast<long long>(value); break;
+    case ObjTypeFunda::eDouble: os << value << "d"; break;
+    case ObjTypeFunda::eInt64:
+      os << static_cast<long long>(value) << "i64";
+      break;
+    case ObjTypeFunda::eUInt32:
+      os << static_cast<unsigned long long>(value) << "u";
+      break;
+    case ObjTypeFunda::eUInt64:
+      os << static_cast<unsigned long long>(value) << "u64";
+      break;
+    case ObjTypeFunda::eFloat: os << value << "f"; break;
     default: assert(false);
     }
   }
 }
 
 bool AstObjTypeSymbol::isValueInRange(GeneralValue value) const {
+  // An object of class type can only be zero-initialized
+  if (!denotesFundaType()) { return value == 0.0; }
   switch (toType(m_name)) {
   case ObjTypeFunda::eVoid: return false;
   case ObjTypeFunda::eNoreturn: return false;
@@ -740,6 +973,16 @@ bool AstObjTypeSymbol::isValueInRange(GeneralValue value) const {
     return (INT_MIN <= value && value <= INT_MAX) &&
       (value == static_cast<int>(value));
   case ObjTypeFunda::eDouble: return true;
+  case ObjTypeFunda::eInt64:
+    return (INT64_MIN <= value && value <= INT64_MAX) &&
+      (value == static_cast<int64_t>(value));
+  case ObjTypeFunda::eUInt32:
+    return (0 <= value && value <= UINT32_MAX) &&
+      (value == static_cast<uint32_t>(value));
+  case ObjTypeFunda::eUInt64:
+    return (0 <= value && value <= UINT64_MAX) &&
+      (value == static_cast<uint64_t>(value));
+  case ObjTypeFunda::eFloat: return true;
   case ObjTypeFunda::eBool: return value == 0.0 || value == 1.0;
   case ObjTypeFunda::eNullptr: return value == 0.0;
   case ObjTypeFunda::ePointer:
@@ -753,28 +996,46 @@ bool AstObjTypeSymbol::isValueInRange(GeneralValue value) const {
 AstObject* AstObjTypeSymbol::createDefaultAstObjectForSemanticAnalizer(
   Location loc) const {
   // What parser does
-  const auto newAstNode =
-    new AstNumber{0, new AstObjTypeSymbol{m_name, loc}, loc};
+  const auto newAstObjType = new AstObjTypeSymbol{m_name, loc};
+  const auto newAstNode = new AstNumber{0, newAstObjType, loc};
 
   // What EnvInserter does: nothing
 
   // What TemplateInstanciator does:
-  newAstNode->declaredAstObjType().createAndSetObjType();
+  if (denotesFundaType()) { newAstObjType->createAndSetObjType(); }
+  else {
+    newAstObjType->setObjType(m_objType);
+  }
 
   // What SemanticAnalizer does: to be done by caller
   return newAstNode;
 }
 
 llvm::Value* AstObjTypeSymbol::createLlvmValueFrom(GeneralValue value) const {
+  if (!denotesFundaType()) {
+    assert(value == 0.0);
+    return llvm::ConstantAggregateZero::get(objType().llvmType());
+  }
   switch (toType(m_name)) {
-  case ObjTypeFunda::eChar: // fall through
   case ObjTypeFunda::eInt: // fall through
-  case ObjTypeFunda::eBool:
-    return llvm::ConstantInt::get(
-      llvmContext, llvm::APInt(objType().size(), value));
+  case ObjTypeFunda::eInt64:
+    return llvm::ConstantInt::get(llvmContext,
+      llvm::APInt(objType().size(), static_cast<int64_t>(value), true));
+    break;
+  case ObjTypeFunda::eChar: // fall through
+  case ObjTypeFunda::eBool: // fall through
+  case ObjTypeFunda::eUInt32: // fall through
+  case ObjTypeFunda::eUInt64:
+    return llvm::ConstantInt::get(llvmContext,
+      llvm::APInt(objType().size(), static_cast<uint64_t>(value)));
     break;
   case ObjTypeFunda::eDouble:
-    return llvm::ConstantFP::get(llvmContext, llvm::APFloat(value));
+    return llvm::ConstantFP::get(
+      llvmContext, llvm::APFloat(static_cast<double>(value)));
+    break;
+  case ObjTypeFunda::eFloat:
+    return llvm::ConstantFP::get(
+      llvmContext, llvm::APFloat(static_cast<float>(value)));
     break;
   default: assert(false);
   }
@@ -798,12 +1059,28 @@ void AstObjTypeSymbol::createAndSetObjType() {
   m_objType = make_shared<ObjTypeFunda>(toType(m_name));
 }
 
+void AstObjTypeSymbol::setObjType(shared_ptr<const ObjType> objType) {
+  assert(objType);
+  assert(!m_objType); // it doesn't make sense to set it twice
+  m_objType = move(objType);
+}
+
+bool AstObjTypeSymbol::denotesFundaType() const {
+  initMap();
+  return find(m_typeToName.begin(), m_typeToName.end(), m_name) !=
+    m_typeToName.end();
+}
+
 AstObjTypeQuali::AstObjTypeQuali(
   ObjType::Qualifiers qualifiers, AstObjType* targetType, Location loc)
-  : AstObjType{move(loc)}, m_qualifiers{qualifiers}, m_targetType{targetType} {
+  : AstObjType{EKind::eObjTypeQuali, move(loc)}
+  , m_qualifiers{qualifiers}
+  , m_targetType{targetType} {
   assert(m_targetType);
 }
 
+AstObjTypeQuali::~AstObjTypeQuali() { deleteChildsLater(m_targetType); }
+
 void AstObjTypeQuali::printValueTo(ostream& os, GeneralValue value) const {
   m_targetType->printValueTo(os, value);
 }
@@ -839,10 +1116,12 @@ void AstObjTypeQuali::createAndSetObjType() {
 }
 
 AstObjTypePtr::AstObjTypePtr(AstObjType* pointee, Location loc)
-  : AstObjType{move(loc)}, m_pointee{pointee} {
+  : AstObjType{EKind::eObjTypePtr, move(loc)}, m_pointee{pointee} {
   assert(m_pointee);
 }
 
+AstObjTypePtr::~AstObjTypePtr() { deleteChildsLater(m_pointee); }
+
 void AstObjTypePtr::printValueTo(
   ostream& /*os*/, GeneralValue /*value*/) const {
   // not yet implemented
@@ -887,38 +1166,180 @@ void AstObjTypePtr::createAndSetObjType() {
   m_objType = make_shared<ObjTypePtr>(m_pointee->objTypeAsSp());
 }
 
-AstClassDef::AstClassDef(
-  string name, vector<AstDataDef*>* dataMembers, Location loc)
-  : AstObjType{move(loc)}
+namespace {
+/** Creates a new AST subtree denoting the given obj type, as if it was created
+by the parser and processed by the passes up to and including
+TemplateInstanciator. Only supports what SemanticAnalizer allows as element of
+simd and array types. */
+AstObjType* createAstObjTypeFor(const ObjType& objType, const Location& loc) {
+  AstObjType* astObjType = nullptr;
+  if (const auto array = dynamic_cast<const ObjTypeArray*>(&objType)) {
+    astObjType = new AstObjTypeArray{array->elementCnt(),
+      createAstObjTypeFor(array->element(), loc), loc};
+  }
+  else if (const auto simd = dynamic_cast<const ObjTypeSimd*>(&objType)) {
+    astObjType = new AstObjTypeSimd{
+      simd->laneCnt(), createAstObjTypeFor(simd->element(), loc), loc};
+  }
+  else {
+    assert(dynamic_cast<const ObjTypeFunda*>(&objType));
+    astObjType = new AstObjTypeSymbol{objType.completeName(), loc};
+  }
+  astObjType->createAndSetObjType();
+  return astObjType;
+}
+}
+
+AstObjTypeSimd::AstObjTypeSimd(int laneCnt, AstObjType* element, Location loc)
+  : AstObjType{EKind::eObjTypeSimd, move(loc)}
+  , m_laneCnt{laneCnt}
+  , m_element{element} {
+  assert(m_element);
+}
+
+AstObjTypeSimd::~AstObjTypeSimd() { deleteChildsLater(m_element); }
+
+void AstObjTypeSimd::printValueTo(ostream& os, GeneralValue value) const {
+  os << "simd[" << m_laneCnt << "](";
+  m_element->printValueTo(os, value);
+  os << ")";
+}
+
+bool AstObjTypeSimd::isValueInRange(GeneralValue value) const {
+  return m_element->isValueInRange(value);
+}
+
+AstObject* AstObjTypeSimd::createDefaultAstObjectForSemanticAnalizer(
+  Location loc) const {
+  // What parser, EnvInserter and TemplateInstanciator do
+  const auto newAstNode =
+    new AstNumber{0, createAstObjTypeFor(objType(), loc), loc};
+
+  // What SemanticAnalizer does: to be done by caller
+  return newAstNode;
+}
+
+llvm::Value* AstObjTypeSimd::createLlvmValueFrom(GeneralValue value) const {
+  return llvm::ConstantVector::getSplat(
+    llvm::ElementCount::getFixed(m_laneCnt),
+    llvm::cast<llvm::Constant>(m_element->createLlvmValueFrom(value)));
+}
+
+const ObjTypeSimd& AstObjTypeSimd::objType() const {
+  assert(m_objType);
+  return *m_objType;
+}
+
+shared_ptr<const ObjType> AstObjTypeSimd::objTypeAsSp() const {
+  return m_objType;
+}
+
+void AstObjTypeSimd::createAndSetObjType() {
+  assert(m_element->objTypeAsSp());
+  assert(!m_objType); // it doesn't make sense to set it twice
+  m_objType = make_shared<ObjTypeSimd>(m_laneCnt, m_element->objTypeAsSp());
+}
+
+AstObjTypeArray::AstObjTypeArray(
+  int elementCnt, AstObjType* element, Location loc)
+  : AstObjType{EKind::eObjTypeArray, move(loc)}
+  , m_elementCnt{elementCnt}
+  , m_element{element} {
+  assert(m_element);
+}
+
+AstObjTypeArray::~AstObjTypeArray() { deleteChildsLater(m_element); }
+
+void AstObjTypeArray::printValueTo(ostream& os, GeneralValue value) const {
+  os << "raw[" << m_elementCnt << "](";
+  m_element->printValueTo(os, value);
+  os << ")";
+}
+
+bool AstObjTypeArray::isValueInRange(GeneralValue value) const {
+  return m_element->isValueInRange(value);
+}
+
+AstObject* AstObjTypeArray::createDefaultAstObjectForSemanticAnalizer(
+  Location loc) const {
+  // What parser, EnvInserter and TemplateInstanciator do
+  const auto newAstNode =
+    new AstNumber{0, createAstObjTypeFor(objType(), loc), loc};
+
+  // What SemanticAnalizer does: to be done by caller
+  return newAstNode;
+}
+
+llvm::Value* AstObjTypeArray::createLlvmValueFrom(GeneralValue value) const {
+  const auto llvmElement =
+    llvm::cast<llvm::Constant>(m_element->createLlvmValueFrom(value));
+  const auto llvmType = llvm::cast<llvm::ArrayType>(objType().llvmType());
+  // zeroinitializer instead of m_elementCnt times the same operand
+  if (llvmElement->isNullValue()) {
+    return llvm::ConstantAggregateZero::get(llvmType);
+  }
+  return llvm::ConstantArray::get(
+    llvmType, vector<llvm::Constant*>(m_elementCnt, llvmElement));
+}
+
+const ObjTypeArray& AstObjTypeArray::objType() const {
+  assert(m_objType);
+  return *m_objType;
+}
+
+shared_ptr<const ObjType> AstObjTypeArray::objTypeAsSp() const {
+  return m_objType;
+}
+
+void AstObjTypeArray::createAndSetObjType() {
+  assert(m_element->objTypeAsSp());
+  assert(!m_objType); // it doesn't make sense to set it twice
+  m_objType =
+    make_shared<ObjTypeArray>(m_elementCnt, m_element->objTypeAsSp());
+}
+
+AstClassDef::AstClassDef(string name, vector<AstDataDef*>* dataMembers,
+  ObjTypeCompound::Layout layout, Location loc)
+  : AstObjType{EKind::eClassDef, move(loc)}
   , m_name{move(name)}
+  , m_layout{layout}
   , m_dataMembers{toUniquePtrs(dataMembers)} {
   for (const auto& dataMember : m_dataMembers) { assert(dataMember); }
 }
 
 AstClassDef::AstClassDef(
   string name, AstDataDef* m1, AstDataDef* m2, AstDataDef* m3)
-  : m_name{move(name)}, m_dataMembers{toUniquePtrs(m1, m2, m3)} {
+  : AstObjType{EKind::eClassDef}
+  , m_name{move(name)}
+  , m_layout{ObjTypeCompound::eOptimizedLayout}
+  , m_dataMembers{toUniquePtrs(m1, m2, m3)} {
 }
 
-void AstClassDef::printValueTo(ostream& /*os*/, GeneralValue /*value*/) const {
-  // The liskov substitution principle is broken here
-  assert(false);
+AstClassDef::~AstClassDef() { deleteChildsLater(m_dataMembers); }
+
+void AstClassDef::printValueTo(ostream& os, GeneralValue value) const {
+  os << m_name << "(" << value << ")";
 }
 
-bool AstClassDef::isValueInRange(GeneralValue /*value*/) const {
-  // The liskov substitution principle is broken here
-  assert(false);
+bool AstClassDef::isValueInRange(GeneralValue value) const {
+  // An object of class type can only be zero-initialized
+  return value == 0.0;
 }
 
 AstObject* AstClassDef::createDefaultAstObjectForSemanticAnalizer(
-  Location) const {
-  // The liskov substitution principle is broken here
-  assert(false);
+  Location loc) const {
+  // What parser, EnvInserter and TemplateInstanciator do
+  const auto newAstObjType = new AstObjTypeSymbol{m_name, loc};
+  newAstObjType->setObjType(m_objType);
+  const auto newAstNode = new AstNumber{0, newAstObjType, loc};
+
+  // What SemanticAnalizer does: to be done by caller
+  return newAstNode;
 }
 
-llvm::Value* AstClassDef::createLlvmValueFrom(GeneralValue /*value*/) const {
-  // not yet implemented
-  assert(false);
+llvm::Value* AstClassDef::createLlvmValueFrom(GeneralValue value) const {
+  assert(value == 0.0);
+  return llvm::ConstantAggregateZero::get(objType().llvmType());
 }
 
 const ObjTypeCompound& AstClassDef::objType() const {
@@ -926,6 +1347,11 @@ const ObjTypeCompound& AstClassDef::objType() const {
   return *m_objType;
 }
 
+ObjTypeCompound& AstClassDef::objType() {
+  assert(m_objType);
+  return *m_objType;
+}
+
 shared_ptr<const ObjType> AstClassDef::objTypeAsSp() const {
   return m_objType;
 }
@@ -933,17 +1359,20 @@ shared_ptr<const ObjType> AstClassDef::objTypeAsSp() const {
 void AstClassDef::createAndSetObjType() {
   assert(!m_objType); // it doesn't make sense to set it twice
   vector<shared_ptr<const ObjType>> dataMembersCopy{};
+  vector<string> dataMemberNames{};
   for (const auto& dataMember : m_dataMembers) {
     assert(dataMember);
     assert(dataMember->objTypeAsSp());
     dataMembersCopy.emplace_back(dataMember->objTypeAsSp());
+    dataMemberNames.emplace_back(dataMember->name());
   }
-  m_objType = make_shared<ObjTypeCompound>(m_name, move(dataMembersCopy));
+  m_objType = make_shared<ObjTypeCompound>(
+    m_name, move(dataMembersCopy), move(dataMemberNames), m_layout);
 }
 
 /** The vectors's elements must be non-null */
 AstCtList::AstCtList(vector<AstObject*>* childs, Location loc)
-  : AstNode{move(loc)}
+  : AstNode{EKind::eCtList, move(loc)}
   , m_childs{childs != nullptr ? childs : new vector<AstObject*>{}} {
   assert(m_childs);
   for (const auto& child : *m_childs) { assert(child); }
@@ -968,7 +1397,7 @@ AstCtList::AstCtList(AstObject* child1, AstObject* child2, AstObject* child3,
 
 AstCtList::~AstCtList() {
   if (m_owner) {
-    for (const auto& child : *m_childs) { delete (child); }
+    for (const auto& child : *m_childs) { deleteLater(child); }
   }
   delete m_childs;
 }
@@ -994,42 +1423,144 @@ AstCtList* AstCtList::Add(
 
 // clang-format off
 
-void AstNop::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstBlock::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstCast::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstFunDef::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstDataDef::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstNumber::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstSymbol::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstFunCall::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstOperator::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstSeq::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstIf::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstObjTypeSymbol::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstObjTypeQuali::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstObjTypePtr::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstClassDef::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstLoop::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstReturn::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-void AstCtList::accept(AstConstVisitor& visitor) const { visitor.visit(*this); }
-
-void AstNop::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstBlock::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstCast::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstFunDef::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstDataDef::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstNumber::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstSymbol::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstFunCall::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstOperator::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstSeq::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstIf::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstObjTypeSymbol::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstObjTypeQuali::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstObjTypePtr::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstClassDef::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstLoop::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstReturn::accept(AstVisitor& visitor) { visitor.visit(*this); }
-void AstCtList::accept(AstVisitor& visitor) { visitor.visit(*this); }
+void AstNop::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstBlock::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstCast::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstFunDef::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstDataDef::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstNumber::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstSymbol::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstFunCall::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstOperator::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstSeq::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstIf::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstObjTypeSymbol::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstObjTypeQuali::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstObjTypePtr::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstObjTypeSimd::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstObjTypeArray::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstClassDef::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstLoop::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstReturn::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstRawNew::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstRawDelete::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstMemberAccess::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstCtList::accept(AstConstVisitor& visitor) const {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+
+void AstNop::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstBlock::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstCast::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstFunDef::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstDataDef::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstNumber::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstSymbol::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstFunCall::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstOperator::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstSeq::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstIf::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstObjTypeSymbol::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstObjTypeQuali::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstObjTypePtr::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstObjTypeSimd::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstObjTypeArray::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstClassDef::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstLoop::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstReturn::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstRawNew::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstRawDelete::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstMemberAccess::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
+void AstCtList::accept(AstVisitor& visitor) {
+  callWithSufficientStack([&] { visitor.visit(*this); });
+}
 
 // clang-format on
@@ -5,6 +5,7 @@
 #include "declutils.h"
 #include "generalvalue.h"
 #include "location.h"
+#include "loophints.h"
 #include "object.h"
 #include "objtype.h"
 #include "storageduration.h"
@@ -45,9 +46,42 @@ private:
 
 class AstNode {
 public:
-  AstNode(Location loc = s_nullLoc);
-  virtual ~AstNode() = default;
+  /** Identifies the concrete class of an AST node, one enumerator per
+  concrete class. Allows dispatching via a switch instead of via the virtual
+  accept methods, see AstStaticVisitor. */
+  enum class EKind : unsigned char {
+    eNop,
+    eBlock,
+    eCast,
+    eCtList,
+    eOperator,
+    eSeq,
+    eNumber,
+    eSymbol,
+    eFunCall,
+    eFunDef,
+    eDataDef,
+    eIf,
+    eLoop,
+    eReturn,
+    eRawNew,
+    eRawDelete,
+    eMemberAccess,
+    eObjTypeSymbol,
+    eObjTypeQuali,
+    eObjTypePtr,
+    eObjTypeSimd,
+    eObjTypeArray,
+    eClassDef
+  };
+
+  AstNode(EKind kind, Location loc = s_nullLoc);
+  /** Also deletes the childs passed to deleteLater, see there. */
+  virtual ~AstNode();
 
+  /** Visitors recursively descending into the childs via accept can handle
+  arbitrarily deep ASTs, since accept continues on a fresh stack segment if the
+  stack is nearly exhausted, see callWithSufficientStack. */
   virtual void accept(AstVisitor& visitor) = 0;
   virtual void accept(AstConstVisitor& visitor) const = 0;
 
@@ -66,18 +100,38 @@ public:
   std::string toStr() const;
 
   const Location& loc() const { return m_loc; }
+  EKind kind() const { return m_kind; }
 
 protected:
-  AstNode() = default;
+  /** To be called by the destructor of AST nodes for each of their childs.
+  Instead of being deleted recursively, which for deep ASTs, e.g. long operator
+  chains in machine-generated code, would overflow the C++ stack, the child is
+  deleted in a loop by the destructor of the outermost AST node currently being
+  destructed. null childs are ignored. */
+  static void deleteLater(AstNode* child);
+  template<typename T>
+  static void deleteLater(const std::unique_ptr<T>& child) {
+    // const semantics no longer apply to an object being destructed
+    deleteLater(const_cast<std::unique_ptr<T>&>(child).release());
+  }
+  template<typename T>
+  static void deleteLater(const std::vector<std::unique_ptr<T>>& childs) {
+    for (const auto& child : childs) { deleteLater(child); }
+  }
+  template<typename... Childs>
+  static void deleteChildsLater(const Childs&... childs) {
+    (deleteLater(childs), ...);
+  }
 
 private:
   NEITHER_COPY_NOR_MOVEABLE(AstNode);
   const Location m_loc;
+  const EKind m_kind;
 };
 
 class AstObject : public AstNode, public virtual Object {
 public:
-  AstObject(Location loc = s_nullLoc);
+  AstObject(EKind kind, Location loc = s_nullLoc);
 
   // -- overrides for AstNode
   bool isObjTypeNoReturn() const override;
@@ -109,7 +163,7 @@ public:
   }
 
 protected:
-  AstObjDef(Location loc = s_nullLoc);
+  AstObjDef(EKind kind, Location loc = s_nullLoc);
 
 private:
   /** Relative to program order, which equals AST post-order traversal, childs
@@ -132,6 +186,7 @@ public:
 class AstBlock : public AstObject, public ConcreteObject {
 public:
   AstBlock(AstObject* body, Location loc = s_nullLoc);
+  ~AstBlock() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -157,6 +212,7 @@ public:
   AstCast(AstObjType* specifiedNewAstObjType, AstCtList* args,
     Location loc = s_nullLoc);
   AstCast(ObjTypeFunda::EType specifiedNewOjType, AstObject* child);
+  ~AstCast() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -181,8 +237,10 @@ private:
 
 class AstFunDef : public AstObjDef, public ConcreteObject {
 public:
+  /** body is nullptr for a host function, see isHostFunction */
   AstFunDef(const std::string& name, std::vector<AstDataDef*>* args,
     AstObjType* ret, AstObject* body, Location loc = s_nullLoc);
+  ~AstFunDef() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -200,9 +258,15 @@ public:
   // name() is in EnvNode
   virtual std::vector<std::unique_ptr<AstDataDef>> const& declaredArgs() const;
   virtual AstObjType& ret() const;
+  /** Must not be called for a host function */
   virtual AstObject& body() const;
 
   // -- misc
+  /** True if this is only the declaration of a function defined by the C++
+  host embedding the EF compiler, see EfModule. Such a function has no
+  body. */
+  bool isHostFunction() const { return m_body == nullptr; }
+
   static std::vector<AstDataDef*>* createArgs(AstDataDef* arg1 = nullptr,
     AstDataDef* arg2 = nullptr, AstDataDef* arg3 = nullptr);
   void createAndSetObjType();
@@ -218,7 +282,7 @@ private:
   const std::vector<std::unique_ptr<AstDataDef>> m_args;
   /** Is garanteed to be non-null. */
   const std::unique_ptr<AstObjType> m_ret;
-  /** Is garanteed to be non-null.
+  /** Is garanteed to be non-null, except for host functions.
   @todo: replace pointee type with AstBlock. Then all visitors for AstFunDef
   don't need to care about Env anymore an can leave handling Env to
   AstBlock. */
@@ -241,6 +305,7 @@ public:
   AstDataDef(const std::string& name,
     ObjTypeFunda::EType declaredObjType = ObjTypeFunda::eInt,
     AstObject* initObj = nullptr, Location loc = s_nullLoc);
+  ~AstDataDef() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -297,6 +362,7 @@ public:
     Location loc = s_nullLoc);
   AstNumber(
     GeneralValue value, ObjTypeFunda::EType eType, Location loc = s_nullLoc);
+  ~AstNumber() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -353,8 +419,32 @@ private:
 
 class AstFunCall : public AstObject, public ConcreteObject {
 public:
+  /** Builtin functions. A call whose address is a symbol naming one of them,
+  and which does not refer to a user defined object, is a call to that
+  builtin. The type of the result and, unless noted otherwise, of all
+  arguments is the type of the first argument. The math functions are lowered
+  directly to LLVM intrinsics. The branch hints evaluate to their first
+  argument; used directly as condition of an if or while they attach branch
+  weights to the conditional branch. */
+  enum EBuiltin {
+    eNoBuiltin,
+    eSqrt, // square root, floating point only
+    eFma, // fused multiply add x*y+z, floating point only
+    eFloor, // floating point only
+    eCeil, // floating point only
+    eTrunc, // round towards zero, floating point only
+    eRound, // round half away from zero, floating point only
+    eAbs, // absolute value
+    eMin, // minimum of two values
+    eMax, // maximum of two values
+    eLikely, // branch hint: the bool argument is likely true
+    eUnlikely, // branch hint: the bool argument is likely false
+    eExpectTrips // branch hint: loop condition, integral literal trip count
+  };
+
   AstFunCall(
     AstObject* address, AstCtList* args = nullptr, Location loc = s_nullLoc);
+  ~AstFunCall() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -369,7 +459,25 @@ public:
   virtual AstObject& address() const { return *m_address; }
   AstCtList& args() const { return *m_args; }
 
+  // -- misc
+  EBuiltin builtin() const { return m_builtin; }
+  void setBuiltin(EBuiltin builtin);
+  /** Returns eNoBuiltin if the given name names no builtin function */
+  static EBuiltin toBuiltin(const std::string& name);
+  /** The number of arguments the given builtin function takes */
+  static size_t arityOf(EBuiltin builtin);
+  /** Whether the callee's value is directly the caller's value and the callee
+  can't access the caller's stack frame, see TailCallAnalizer */
+  bool isTailCall() const { return m_isTailCall; }
+  void setIsTailCall() { m_isTailCall = true; }
+
 private:
+  static const std::map<const std::string, const EBuiltin> m_builtinMap;
+
+  // -- associated object
+  EBuiltin m_builtin;
+  bool m_isTailCall;
+
   // -- childs of this node
   /** Is garanteed to be non-null */
   const std::unique_ptr<AstObject> m_address;
@@ -385,6 +493,9 @@ public:
     eSub = '-',
     eMul = '*', // '*' is ambigous. can also mean eDeref
     eDiv = '/',
+    eLess = '<',
+    eBitOr = '|',
+    eXor = '^',
     eNot = '!',
     eAddrOf = '&',
     // see m_opMap for the mapping to "and", "or" etc.
@@ -392,14 +503,28 @@ public:
     eOr,
     eEqualTo,
     eAssign, // type of expr is the lhs object
-    eDeref
+    eDeref,
+    eLane, // lane of simd object at given index
+    eWithLane, // copy of simd object, with lane at given index replaced
+    eHAdd, // horizontal add, i.e. the sum of all lanes of a simd object
+    eHMul, // horizontal multiply, i.e. the product of all lanes
+    eIndex, // element of array at given index
+    eBitAnd, // '&' is ambigous. can also mean eAddrOf
+    eShl,
+    eShr, // arithmetic shift for signed types, logical for unsigned types
+    eCtpop, // number of set bits
+    eCtlz, // number of leading zero bits
+    eCttz, // number of trailing zero bits
+    eBswap // operand with the order of its bytes reversed
   };
   enum EClass {
     eAssignment,
     eArithmetic,
     eLogical,
+    eBitwise,
     eComparison,
     eMemberAccess,
+    eSimd,
     eOther
   };
 
@@ -412,6 +537,7 @@ public:
     AstObject* operand2 = nullptr, Location loc = s_nullLoc);
   AstOperator(EOperation op, AstObject* operand1 = nullptr,
     AstObject* operand2 = nullptr, Location loc = s_nullLoc);
+  ~AstOperator() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -429,12 +555,20 @@ public:
 
   // -- misc
   EClass class_() const;
-  bool isBinaryLogicalShortCircuit() const;
+  bool isLogicalShortCircuit() const;
   /** See m_referencedAstObj */
   void setReferencedObjAndPropagateAccess(std::unique_ptr<Object>);
   void setReferencedObjAndPropagateAccess(Object&);
   void setObjType(std::shared_ptr<const ObjType>);
+  /** Only meaningful for eIndex. See m_isIndexProvablyInRange */
+  bool isIndexProvablyInRange() const { return m_isIndexProvablyInRange; }
+  void setIndexIsProvablyInRange(bool isInRange);
   static EClass classOf(AstOperator::EOperation op);
+  /** Whether a chain of the given operator, e.g. a+b+c, is represented by a
+  single AstOperator having all operands of the chain as args, opposed to by a
+  tree of binary AstOperators. The operands are nevertheless evaluated and
+  combined left to right, as in the left associative tree. */
+  static bool isNAry(EOperation op);
   /** In case of ambiguity, chooses the binary operator */
   static EOperation toEOperationPreferingBinary(const std::string& op);
   /** In case of ambiguity asserts */
@@ -457,6 +591,12 @@ private:
   /** Is only set if returnsByRef() is false */
   std::unique_ptr<FullConcreteObject> m_obj;
 
+  // -- decorations
+  /** Set by RangeAnalizer. True if the index is known to be within the
+  bounds of the array in every execution, in which case IrGen doesn't need to
+  emit a bounds check. */
+  bool m_isIndexProvablyInRange = false;
+
   // -- childs of this node
   const EOperation m_op;
   /** Is garanteed to be non-null */
@@ -484,6 +624,7 @@ public:
   AstSeq(std::vector<AstNode*>* operands);
   AstSeq(AstNode* op1 = nullptr, AstNode* op2 = nullptr, AstNode* op3 = nullptr,
     AstNode* op4 = nullptr, AstNode* op5 = nullptr);
+  ~AstSeq() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -515,6 +656,11 @@ private:
   analizer to report the proper error. Until then, to fulfill the contract,
   m_dummyObj serves as dummt object. */
   static FullConcreteObject m_dummyObj;
+  /** The object of the last operand. If that is an AstSeq itself, it's the
+  object that AstSeq refers to, so accessing the object of deeply nested
+  sequences, e.g. of many nested parentheses, doesn't walk the whole chain.
+  Garanteed to be non null. */
+  Object* m_referencedObj;
 };
 
 /* If flow control expression */
@@ -522,6 +668,7 @@ class AstIf : public AstObject, public ConcreteObject {
 public:
   AstIf(AstObject* cond, AstObject* action, AstObject* elseAction = nullptr,
     Location loc = s_nullLoc);
+  ~AstIf() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -556,6 +703,9 @@ private:
 class AstLoop : public AstObject, public ConcreteObject {
 public:
   AstLoop(AstObject* cond, AstObject* body, Location loc = s_nullLoc);
+  AstLoop(AstObject* cond, AstObject* body, LoopHints hints,
+    Location loc = s_nullLoc);
+  ~AstLoop() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -570,7 +720,12 @@ public:
   AstObject& condition() const { return *m_condition; }
   AstObject& body() const { return *m_body; }
 
+  // -- misc
+  const LoopHints& hints() const { return m_hints; }
+
 private:
+  const LoopHints m_hints;
+
   // -- childs of this node
   /** Is garanteed to be non-null */
   const std::unique_ptr<AstObject> m_condition;
@@ -582,6 +737,7 @@ class AstReturn : public AstObject, public ConcreteObject {
 public:
   AstReturn(AstObject* retVal = nullptr, Location loc = s_nullLoc);
   AstReturn(AstCtList* ctorArgs, Location loc = s_nullLoc);
+  ~AstReturn() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -601,11 +757,121 @@ private:
   const std::unique_ptr<AstCtList> m_ctorArgs;
 };
 
+/** Creates a new data object on the heap, see raw_new in the language
+reference. Its value is a raw pointer to the new data object. */
+class AstRawNew : public AstObject, public ConcreteObject {
+public:
+  AstRawNew(AstObjType* specifiedAstObjType, AstCtList* args,
+    Location loc = s_nullLoc);
+  ~AstRawNew() override;
+
+  // -- overrides for AstNode
+  void accept(AstVisitor& visitor) override;
+  void accept(AstConstVisitor& visitor) const override;
+
+  // -- overrides for Object
+  const ObjType& objType() const override;
+  std::shared_ptr<const ObjType> objTypeAsSp() const override;
+  StorageDuration storageDuration() const override;
+
+  // -- childs of this node
+  AstObjType& specifiedAstObjType() const { return *m_specifiedAstObjType; }
+  AstCtList& args() const { return *m_args; }
+
+  // -- misc
+  /** Whether the new data object provably never escapes the function, so it
+  can live on the stack instead, see EscapeAnalizer */
+  bool isStackPromoted() const { return m_isStackPromoted; }
+  void setIsStackPromoted() { m_isStackPromoted = true; }
+
+private:
+  // -- associated object
+  /** Pointer to the type of the new data object */
+  mutable std::shared_ptr<const ObjType> m_objType;
+
+  bool m_isStackPromoted;
+
+  // -- childs of this node
+  /** Is guaranteed to be non-null */
+  const std::unique_ptr<AstObjType> m_specifiedAstObjType;
+  /** Is guaranteed to be non-null */
+  const std::unique_ptr<AstCtList> m_args;
+};
+
+/** Deletes a data object created by raw_new, see raw_delete in the language
+reference */
+class AstRawDelete : public AstObject, public ConcreteObject {
+public:
+  AstRawDelete(AstObject* ptr, Location loc = s_nullLoc);
+  ~AstRawDelete() override;
+
+  // -- overrides for AstNode
+  void accept(AstVisitor& visitor) override;
+  void accept(AstConstVisitor& visitor) const override;
+
+  // -- overrides for Object
+  const ObjType& objType() const override;
+  std::shared_ptr<const ObjType> objTypeAsSp() const override;
+  StorageDuration storageDuration() const override;
+
+  // -- childs of this node
+  AstObject& ptr() const { return *m_ptr; }
+
+  // -- misc
+  /** Whether the deleted data object was created by a stack promoted
+  AstRawNew, in which case there is nothing to free */
+  bool isStackPromoted() const { return m_isStackPromoted; }
+  void setIsStackPromoted() { m_isStackPromoted = true; }
+
+private:
+  bool m_isStackPromoted;
+
+  // -- childs of this node
+  /** Is guaranteed to be non-null */
+  const std::unique_ptr<AstObject> m_ptr;
+};
+
+/** Data member of a class object, e.g. obj.x. The data member is mutable if
+and only if the class object is. */
+class AstMemberAccess : public AstObject, public ObjectDelegate {
+public:
+  AstMemberAccess(
+    AstObject* obj, std::string memberName, Location loc = s_nullLoc);
+  ~AstMemberAccess() override;
+
+  // -- overrides for AstNode
+  void accept(AstVisitor& visitor) override;
+  void accept(AstConstVisitor& visitor) const override;
+
+  // -- overrides for ObjectDelegate
+  void addAccess(Access access) override;
+  Object& referencedObj() const override;
+
+  // -- childs of this node
+  AstObject& obj() const { return *m_obj; }
+  const std::string& memberName() const { return m_memberName; }
+
+  // -- misc
+  /** See m_referencedObj */
+  void setReferencedObjAndPropagateAccess(std::unique_ptr<Object> object);
+
+private:
+  // -- associated object
+  /** The data member. Is set by SemanticAnalizer */
+  std::unique_ptr<Object> m_referencedObj;
+
+  // -- childs of this node
+  /** Is guaranteed to be non-null */
+  const std::unique_ptr<AstObject> m_obj;
+  const std::string m_memberName;
+};
+
 /** Represents a object type template instanciation. See also ObjType and
 TemplateInstanciator. */
 class AstObjType : public AstNode {
 public:
-  AstObjType(Location loc = s_nullLoc) : AstNode{std::move(loc)} {}
+  AstObjType(EKind kind, Location loc = s_nullLoc)
+    : AstNode{kind, std::move(loc)} {}
 
   void setAccessFromAstParent(Access access) override {
     assert(access == Access::eIgnoreValueAndAddr);
@@ -648,10 +914,17 @@ public:
   const ObjType& objType() const override;
   std::shared_ptr<const ObjType> objTypeAsSp() const override;
   void createAndSetObjType() override;
+  /** The alternative to createAndSetObjType if the name doesn't denote a
+  fundamental type but a class. The given type is the class's type the name
+  refers to. */
+  void setObjType(std::shared_ptr<const ObjType> objType);
 
   // -- childs of this node
   const std::string name() const { return m_name; }
 
+  // -- misc
+  bool denotesFundaType() const;
+
 private:
   friend class TestingAstObjTypeSymbol;
 
@@ -678,6 +951,7 @@ class AstObjTypeQuali : public AstObjType {
 public:
   AstObjTypeQuali(ObjType::Qualifiers qualifiers, AstObjType* targetType,
     Location loc = s_nullLoc);
+  ~AstObjTypeQuali() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -714,6 +988,7 @@ public:
 class AstObjTypePtr : public AstObjType {
 public:
   AstObjTypePtr(AstObjType* pointee, Location loc = s_nullLoc);
+  ~AstObjTypePtr() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -745,13 +1020,94 @@ public:
   llvm::Value* createLlvmValueFrom(GeneralValue value) const override;
 };
 
+/** Fixed width simd vector, e.g. "simd[4]double". See also ObjTypeSimd */
+class AstObjTypeSimd : public AstObjType {
+public:
+  AstObjTypeSimd(int laneCnt, AstObjType* element, Location loc = s_nullLoc);
+  ~AstObjTypeSimd() override;
+
+  // -- overrides for AstNode
+  void accept(AstVisitor& visitor) override;
+  void accept(AstConstVisitor& visitor) const override;
+
+  // -- overrides for AstObjType
+  void printValueTo(std::ostream& os, GeneralValue value) const override;
+  bool isValueInRange(GeneralValue value) const override;
+  AstObject* createDefaultAstObjectForSemanticAnalizer(
+    Location loc) const override;
+
+  const ObjTypeSimd& objType() const override;
+  std::shared_ptr<const ObjType> objTypeAsSp() const override;
+  void createAndSetObjType() override;
+
+  // -- childs of this node
+  int laneCnt() const { return m_laneCnt; }
+  AstObjType& element() const { return *m_element; }
+
+private:
+  // -- to implement overrides
+  std::shared_ptr<const ObjTypeSimd> m_objType;
+
+  // -- childs of this node
+  const int m_laneCnt;
+  /** Guaranteed to be non-null */
+  const std::unique_ptr<AstObjType> m_element;
+
+  // decorations for IrGen
+public:
+  /** Splats the scalar value to all lanes */
+  llvm::Value* createLlvmValueFrom(GeneralValue value) const override;
+};
+
+/** Fixed size raw array, e.g. "raw[4]int". See also ObjTypeArray */
+class AstObjTypeArray : public AstObjType {
+public:
+  AstObjTypeArray(
+    int elementCnt, AstObjType* element, Location loc = s_nullLoc);
+  ~AstObjTypeArray() override;
+
+  // -- overrides for AstNode
+  void accept(AstVisitor& visitor) override;
+  void accept(AstConstVisitor& visitor) const override;
+
+  // -- overrides for AstObjType
+  void printValueTo(std::ostream& os, GeneralValue value) const override;
+  bool isValueInRange(GeneralValue value) const override;
+  AstObject* createDefaultAstObjectForSemanticAnalizer(
+    Location loc) const override;
+
+  const ObjTypeArray& objType() const override;
+  std::shared_ptr<const ObjType> objTypeAsSp() const override;
+  void createAndSetObjType() override;
+
+  // -- childs of this node
+  int elementCnt() const { return m_elementCnt; }
+  AstObjType& element() const { return *m_element; }
+
+private:
+  // -- to implement overrides
+  std::shared_ptr<const ObjTypeArray> m_objType;
+
+  // -- childs of this node
+  const int m_elementCnt;
+  /** Guaranteed to be non-null */
+  const std::unique_ptr<AstObjType> m_element;
+
+  // decorations for IrGen
+public:
+  /** Each element is initialized with the given value */
+  llvm::Value* createLlvmValueFrom(GeneralValue value) const override;
+};
+
 /** Definition of a class. See also ObjTypeClass */
 class AstClassDef : public AstObjType {
 public:
   AstClassDef(std::string name, std::vector<AstDataDef*>* dataMembers,
+    ObjTypeCompound::Layout layout = ObjTypeCompound::eOptimizedLayout,
     Location loc = s_nullLoc);
   AstClassDef(std::string name, AstDataDef* m1 = nullptr,
     AstDataDef* m2 = nullptr, AstDataDef* m3 = nullptr);
+  ~AstClassDef() override;
 
   // -- overrides for AstNode
   void accept(AstVisitor& visitor) override;
@@ -764,6 +1120,8 @@ public:
     Location loc) const override;
 
   const ObjTypeCompound& objType() const override;
+  /** Non-const since the class's type is inserted into the environment */
+  ObjTypeCompound& objType();
   std::shared_ptr<const ObjType> objTypeAsSp() const override;
   void createAndSetObjType() override;
 
@@ -772,12 +1130,14 @@ public:
   const std::vector<std::unique_ptr<AstDataDef>>& dataMembers() const {
     return m_dataMembers;
   }
+  ObjTypeCompound::Layout layout() const { return m_layout; }
 
 private:
   std::shared_ptr<ObjTypeCompound> m_objType;
 
   // -- childs of this node
   const std::string m_name;
+  const ObjTypeCompound::Layout m_layout;
   /** Pointers are garanteed to be non null.*/
   const std::vector<std::unique_ptr<AstDataDef>> m_dataMembers;
 
@@ -54,7 +54,7 @@ void AstDefaultIterator::visit(AstFunDef& funDef) {
   if (m_visitor != nullptr) { funDef.accept(*m_visitor); }
   for (const auto& arg : funDef.declaredArgs()) { arg->accept(*this); }
   funDef.ret().accept(*this);
-  funDef.body().accept(*this);
+  if (!funDef.isHostFunction()) { funDef.body().accept(*this); }
 }
 
 void AstDefaultIterator::visit(AstDataDef& dataDef) {
@@ -81,6 +81,22 @@ void AstDefaultIterator::visit(AstReturn& return_) {
   return_.ctorArgs().accept(*this);
 }
 
+void AstDefaultIterator::visit(AstRawNew& rawNew) {
+  if (m_visitor != nullptr) { rawNew.accept(*m_visitor); }
+  rawNew.args().accept(*this);
+  rawNew.specifiedAstObjType().accept(*this);
+}
+
+void AstDefaultIterator::visit(AstRawDelete& rawDelete) {
+  if (m_visitor != nullptr) { rawDelete.accept(*m_visitor); }
+  rawDelete.ptr().accept(*this);
+}
+
+void AstDefaultIterator::visit(AstMemberAccess& memberAccess) {
+  if (m_visitor != nullptr) { memberAccess.accept(*m_visitor); }
+  memberAccess.obj().accept(*this);
+}
+
 void AstDefaultIterator::visit(AstObjTypeSymbol& symbol) {
   if (m_visitor != nullptr) { symbol.accept(*m_visitor); }
 }
@@ -95,6 +111,16 @@ void AstDefaultIterator::visit(AstObjTypePtr& ptr) {
   ptr.pointee().accept(*this);
 }
 
+void AstDefaultIterator::visit(AstObjTypeSimd& simd) {
+  if (m_visitor != nullptr) { simd.accept(*m_visitor); }
+  simd.element().accept(*this);
+}
+
+void AstDefaultIterator::visit(AstObjTypeArray& array) {
+  if (m_visitor != nullptr) { array.accept(*m_visitor); }
+  array.element().accept(*this);
+}
+
 void AstDefaultIterator::visit(AstClassDef& class_) {
   if (m_visitor != nullptr) { class_.accept(*m_visitor); }
   for (const auto& dataMember : class_.dataMembers()) {
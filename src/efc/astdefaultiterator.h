@@ -2,7 +2,9 @@
 #include "astvisitor.h"
 
 /** Traverses AST: at each node, call its accept method and pass the vistor
-given in the ctor. Currently it's only pre order traversal. */
+given in the ctor. Currently it's only pre order traversal. Recurses on the C++
+stack, so derived classes can wrap work around the traversal of a node's
+childs. See also AstTraversal, which doesn't recurse. */
 class AstDefaultIterator : public AstVisitor {
 public:
   AstDefaultIterator(AstVisitor* visitor = nullptr) : m_visitor{visitor} {}
@@ -21,9 +23,14 @@ public:
   void visit(AstIf& if_) override;
   void visit(AstLoop& loop) override;
   void visit(AstReturn& return_) override;
+  void visit(AstRawNew& rawNew) override;
+  void visit(AstRawDelete& rawDelete) override;
+  void visit(AstMemberAccess& memberAccess) override;
   void visit(AstObjTypeSymbol& symbol) override;
   void visit(AstObjTypeQuali& quali) override;
   void visit(AstObjTypePtr& ptr) override;
+  void visit(AstObjTypeSimd& simd) override;
+  void visit(AstObjTypeArray& array) override;
   void visit(AstClassDef& class_) override;
 
 private:
@@ -15,8 +15,13 @@ class AstDataDef;
 class AstIf;
 class AstLoop;
 class AstReturn;
+class AstRawNew;
+class AstRawDelete;
+class AstMemberAccess;
 class AstObjType;
 class AstObjTypeSymbol;
 class AstObjTypeQuali;
 class AstObjTypePtr;
+class AstObjTypeSimd;
+class AstObjTypeArray;
 class AstClassDef;
@@ -106,8 +106,10 @@ void AstPrinter::visit(const AstFunDef& funDef) {
   }
   m_os << ") ";
   funDef.ret().accept(*this);
-  m_os << " ";
-  funDef.body().accept(*this);
+  if (!funDef.isHostFunction()) {
+    m_os << " ";
+    funDef.body().accept(*this);
+  }
   m_os << ")";
 }
 
@@ -130,7 +132,27 @@ void AstPrinter::visit(const AstIf& if_) {
 }
 
 void AstPrinter::visit(const AstLoop& loop) {
-  m_os << "while(";
+  m_os << "while";
+  const auto& hints = loop.hints();
+  if (!hints.isEmpty()) {
+    auto sep = "";
+    m_os << "[";
+    if (hints.m_vectorizeWidth) {
+      m_os << sep << "vectorize=" << hints.m_vectorizeWidth;
+      sep = " ";
+    }
+    if (hints.m_interleaveCount) {
+      m_os << sep << "interleave=" << hints.m_interleaveCount;
+      sep = " ";
+    }
+    if (hints.m_unrollCount) {
+      m_os << sep << "unroll=" << hints.m_unrollCount;
+      sep = " ";
+    }
+    if (hints.m_isIndependent) { m_os << sep << "independent"; }
+    m_os << "]";
+  }
+  m_os << "(";
   loop.condition().accept(*this);
   m_os << " ";
   loop.body().accept(*this);
@@ -143,6 +165,26 @@ void AstPrinter::visit(const AstReturn& return_) {
   m_os << ")";
 }
 
+void AstPrinter::visit(const AstRawNew& rawNew) {
+  m_os << "raw_new(";
+  rawNew.specifiedAstObjType().accept(*this);
+  m_os << " (";
+  rawNew.args().accept(*this);
+  m_os << "))";
+}
+
+void AstPrinter::visit(const AstRawDelete& rawDelete) {
+  m_os << "raw_delete(";
+  rawDelete.ptr().accept(*this);
+  m_os << ")";
+}
+
+void AstPrinter::visit(const AstMemberAccess& memberAccess) {
+  m_os << ".(";
+  memberAccess.obj().accept(*this);
+  m_os << " " << memberAccess.memberName() << ")";
+}
+
 void AstPrinter::visit(const AstObjTypeSymbol& symbol) {
   m_os << symbol.name();
 }
@@ -162,8 +204,21 @@ void AstPrinter::visit(const AstObjTypePtr& ptr) {
   ptr.pointee().accept(*this);
 }
 
+void AstPrinter::visit(const AstObjTypeSimd& simd) {
+  m_os << "simd[" << simd.laneCnt() << "]";
+  simd.element().accept(*this);
+}
+
+void AstPrinter::visit(const AstObjTypeArray& array) {
+  m_os << "raw[" << array.elementCnt() << "]";
+  array.element().accept(*this);
+}
+
 void AstPrinter::visit(const AstClassDef& class_) {
   m_os << "class(" << class_.name();
+  if (class_.layout() == ObjTypeCompound::eFixedLayout) {
+    m_os << " fixed_layout";
+  }
   for (const auto& dataMember : class_.dataMembers()) {
     m_os << " ";
     dataMember->accept(*this);
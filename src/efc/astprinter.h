@@ -32,9 +32,14 @@ private:
   void visit(const AstIf& if_) override;
   void visit(const AstLoop& loop) override;
   void visit(const AstReturn& return_) override;
+  void visit(const AstRawNew& rawNew) override;
+  void visit(const AstRawDelete& rawDelete) override;
+  void visit(const AstMemberAccess& memberAccess) override;
   void visit(const AstObjTypeSymbol& symbol) override;
   void visit(const AstObjTypeQuali& quali) override;
   void visit(const AstObjTypePtr& ptr) override;
+  void visit(const AstObjTypeSimd& simd) override;
+  void visit(const AstObjTypeArray& array) override;
   void visit(const AstClassDef& class_) override;
 
   void printNakedDataDef(
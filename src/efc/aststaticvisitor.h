@@ -0,0 +1,102 @@
+#pragma once
+#include "ast.h"
+#include "stackgrowth.h"
+
+/** Alternative to AstVisitor for passes which want to avoid the virtual
+double dispatch of AstNode::accept / AstVisitor::visit. dispatch switches on
+AstNode::kind and calls Derived's visit method for the concrete node class
+directly, so the compiler can inline it.
+
+Uses CRTP: Derived derives from AstStaticVisitor<Derived> and provides a visit
+method for each concrete AST node class; the visit methods need not be
+virtual. Derived calls dispatch where an AstVisitor would call accept. Derived
+must befriend AstStaticVisitor<Derived> if its visit methods are private. */
+template<typename Derived>
+class AstStaticVisitor {
+public:
+  /** Continues on a fresh stack segment if the stack is nearly exhausted, see
+  callWithSufficientStack */
+  void dispatch(AstNode& node) {
+    callWithSufficientStack([&] { dispatchOnCurrentStack(node); });
+  }
+
+private:
+  void dispatchOnCurrentStack(AstNode& node) {
+    auto& derived = static_cast<Derived&>(*this);
+    switch (node.kind()) {
+    case AstNode::EKind::eNop:
+      derived.visit(static_cast<AstNop&>(node));
+      break;
+    case AstNode::EKind::eBlock:
+      derived.visit(static_cast<AstBlock&>(node));
+      break;
+    case AstNode::EKind::eCast:
+      derived.visit(static_cast<AstCast&>(node));
+      break;
+    case AstNode::EKind::eCtList:
+      derived.visit(static_cast<AstCtList&>(node));
+      break;
+    case AstNode::EKind::eOperator:
+      derived.visit(static_cast<AstOperator&>(node));
+      break;
+    case AstNode::EKind::eSeq:
+      derived.visit(static_cast<AstSeq&>(node));
+      break;
+    case AstNode::EKind::eNumber:
+      derived.visit(static_cast<AstNumber&>(node));
+      break;
+    case AstNode::EKind::eSymbol:
+      derived.visit(static_cast<AstSymbol&>(node));
+      break;
+    case AstNode::EKind::eFunCall:
+      derived.visit(static_cast<AstFunCall&>(node));
+      break;
+    case AstNode::EKind::eFunDef:
+      derived.visit(static_cast<AstFunDef&>(node));
+      break;
+    case AstNode::EKind::eDataDef:
+      derived.visit(static_cast<AstDataDef&>(node));
+      break;
+    case AstNode::EKind::eIf:
+      derived.visit(static_cast<AstIf&>(node));
+      break;
+    case AstNode::EKind::eLoop:
+      derived.visit(static_cast<AstLoop&>(node));
+      break;
+    case AstNode::EKind::eReturn:
+      derived.visit(static_cast<AstReturn&>(node));
+      break;
+    case AstNode::EKind::eRawNew:
+      derived.visit(static_cast<AstRawNew&>(node));
+      break;
+    case AstNode::EKind::eRawDelete:
+      derived.visit(static_cast<AstRawDelete&>(node));
+      break;
+    case AstNode::EKind::eMemberAccess:
+      derived.visit(static_cast<AstMemberAccess&>(node));
+      break;
+    case AstNode::EKind::eObjTypeSymbol:
+      derived.visit(static_cast<AstObjTypeSymbol&>(node));
+      break;
+    case AstNode::EKind::eObjTypeQuali:
+      derived.visit(static_cast<AstObjTypeQuali&>(node));
+      break;
+    case AstNode::EKind::eObjTypePtr:
+      derived.visit(static_cast<AstObjTypePtr&>(node));
+      break;
+    case AstNode::EKind::eObjTypeSimd:
+      derived.visit(static_cast<AstObjTypeSimd&>(node));
+      break;
+    case AstNode::EKind::eObjTypeArray:
+      derived.visit(static_cast<AstObjTypeArray&>(node));
+      break;
+    case AstNode::EKind::eClassDef:
+      derived.visit(static_cast<AstClassDef&>(node));
+      break;
+    }
+  }
+
+protected:
+  AstStaticVisitor() = default;
+  ~AstStaticVisitor() = default;
+};
@@ -0,0 +1,141 @@
+#include "asttraversal.h"
+
+#include "ast.h"
+
+using namespace std;
+
+namespace {
+/** Appends the childs of the visited node to the given vector, in the order
+AstDefaultIterator visits them. Doesn't descend. */
+class ChildCollector : public AstVisitor {
+public:
+  ChildCollector(vector<AstNode*>& childs) : m_childs{childs} {}
+
+  void visit(AstNop& /*nop*/) override {}
+
+  void visit(AstBlock& block) override { m_childs.push_back(&block.body()); }
+
+  void visit(AstCast& cast) override {
+    m_childs.push_back(&cast.args());
+    m_childs.push_back(&cast.specifiedNewAstObjType());
+  }
+
+  void visit(AstCtList& ctList) override {
+    for (const auto& child : ctList.childs()) { m_childs.push_back(child); }
+  }
+
+  void visit(AstOperator& op) override { m_childs.push_back(&op.args()); }
+
+  void visit(AstSeq& seq) override {
+    for (const auto& op : seq.operands()) { m_childs.push_back(op.get()); }
+  }
+
+  void visit(AstNumber& number) override {
+    m_childs.push_back(&number.declaredAstObjType());
+  }
+
+  void visit(AstSymbol& /*symbol*/) override {}
+
+  void visit(AstFunCall& funCall) override {
+    m_childs.push_back(&funCall.address());
+    m_childs.push_back(&funCall.args());
+  }
+
+  void visit(AstFunDef& funDef) override {
+    for (const auto& arg : funDef.declaredArgs()) {
+      m_childs.push_back(arg.get());
+    }
+    m_childs.push_back(&funDef.ret());
+    if (!funDef.isHostFunction()) { m_childs.push_back(&funDef.body()); }
+  }
+
+  void visit(AstDataDef& dataDef) override {
+    m_childs.push_back(&dataDef.declaredAstObjType());
+    m_childs.push_back(&dataDef.ctorArgs());
+  }
+
+  void visit(AstIf& if_) override {
+    m_childs.push_back(&if_.condition());
+    m_childs.push_back(&if_.action());
+    if (if_.elseAction() != nullptr) { m_childs.push_back(if_.elseAction()); }
+  }
+
+  void visit(AstLoop& loop) override {
+    m_childs.push_back(&loop.condition());
+    m_childs.push_back(&loop.body());
+  }
+
+  void visit(AstReturn& return_) override {
+    m_childs.push_back(&return_.ctorArgs());
+  }
+
+  void visit(AstRawNew& rawNew) override {
+    m_childs.push_back(&rawNew.args());
+    m_childs.push_back(&rawNew.specifiedAstObjType());
+  }
+
+  void visit(AstRawDelete& rawDelete) override {
+    m_childs.push_back(&rawDelete.ptr());
+  }
+
+  void visit(AstMemberAccess& memberAccess) override {
+    m_childs.push_back(&memberAccess.obj());
+  }
+
+  void visit(AstObjTypeSymbol& /*symbol*/) override {}
+
+  void visit(AstObjTypeQuali& quali) override {
+    m_childs.push_back(&quali.targetType());
+  }
+
+  void visit(AstObjTypePtr& ptr) override {
+    m_childs.push_back(&ptr.pointee());
+  }
+
+  void visit(AstObjTypeSimd& simd) override {
+    m_childs.push_back(&simd.element());
+  }
+
+  void visit(AstObjTypeArray& array) override {
+    m_childs.push_back(&array.element());
+  }
+
+  void visit(AstClassDef& class_) override {
+    for (const auto& dataMember : class_.dataMembers()) {
+      m_childs.push_back(dataMember.get());
+    }
+  }
+
+private:
+  vector<AstNode*>& m_childs;
+};
+}
+
+AstTraversal::AstTraversal(
+  AstVisitor* preOrderVisitor, AstVisitor* postOrderVisitor)
+  : m_preOrderVisitor{preOrderVisitor}, m_postOrderVisitor{postOrderVisitor} {
+}
+
+void AstTraversal::operator()(AstNode& root) {
+  ChildCollector childCollector{m_childs};
+  m_stack.clear();
+  m_stack.push_back(Frame{&root, false});
+  while (!m_stack.empty()) {
+    auto& frame = m_stack.back();
+    const auto node = frame.m_node;
+    if (frame.m_isExpanded) {
+      m_stack.pop_back();
+      if (m_postOrderVisitor != nullptr) { node->accept(*m_postOrderVisitor); }
+      continue;
+    }
+
+    frame.m_isExpanded = true;
+    if (m_preOrderVisitor != nullptr) { node->accept(*m_preOrderVisitor); }
+    m_childs.clear();
+    node->accept(childCollector);
+    // reversed, so the first child is on top of the stack
+    for (auto child = m_childs.rbegin(); child != m_childs.rend(); ++child) {
+      m_stack.push_back(Frame{*child, false});
+    }
+  }
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "astvisitor.h"
+
+#include <vector>
+
+class AstNode;
+
+/** Traverses the AST in the same order as AstDefaultIterator, however with an
+explicit stack on the heap instead of recursing on the C++ stack. Thus the depth
+of the AST is only limited by memory, e.g. machine-generated EF code can contain
+very long operator chains.
+
+At each node, first the node's accept method is called with the pre-order
+visitor, then the node's childs are traversed, then the node's accept method is
+called with the post-order visitor. Both visitors are optional. The visitors
+must not themselves descend into the childs, and must not modify the AST
+structure. */
+class AstTraversal {
+public:
+  AstTraversal(
+    AstVisitor* preOrderVisitor, AstVisitor* postOrderVisitor = nullptr);
+
+  void operator()(AstNode& root);
+
+private:
+  /** An AST node whose childs are or are about to be traversed */
+  struct Frame {
+    AstNode* m_node;
+    /** Whether the childs have already been pushed onto the stack */
+    bool m_isExpanded;
+  };
+
+  AstVisitor* const m_preOrderVisitor;
+  AstVisitor* const m_postOrderVisitor;
+  std::vector<Frame> m_stack;
+  /** Reused buffer for the childs of the current node */
+  std::vector<AstNode*> m_childs;
+};
@@ -20,9 +20,14 @@ public:
   virtual void visit(AstIf& if_) = 0;
   virtual void visit(AstLoop& loop) = 0;
   virtual void visit(AstReturn& return_) = 0;
+  virtual void visit(AstRawNew& rawNew) = 0;
+  virtual void visit(AstRawDelete& rawDelete) = 0;
+  virtual void visit(AstMemberAccess& memberAccess) = 0;
   virtual void visit(AstObjTypeSymbol& symbol) = 0;
   virtual void visit(AstObjTypeQuali& quali) = 0;
   virtual void visit(AstObjTypePtr& ptr) = 0;
+  virtual void visit(AstObjTypeSimd& simd) = 0;
+  virtual void visit(AstObjTypeArray& array) = 0;
   virtual void visit(AstClassDef& class_) = 0;
 
 protected:
@@ -50,9 +55,14 @@ public:
   virtual void visit(const AstIf& if_) = 0;
   virtual void visit(const AstLoop& loop) = 0;
   virtual void visit(const AstReturn& return_) = 0;
+  virtual void visit(const AstRawNew& rawNew) = 0;
+  virtual void visit(const AstRawDelete& rawDelete) = 0;
+  virtual void visit(const AstMemberAccess& memberAccess) = 0;
   virtual void visit(const AstObjTypeSymbol& symbol) = 0;
   virtual void visit(const AstObjTypeQuali& quali) = 0;
   virtual void visit(const AstObjTypePtr& ptr) = 0;
+  virtual void visit(const AstObjTypeSimd& simd) = 0;
+  virtual void visit(const AstObjTypeArray& array) = 0;
   virtual void visit(const AstClassDef& class_) = 0;
 
 protected:
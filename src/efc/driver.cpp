@@ -8,6 +8,7 @@
 #include "parser.h"
 #include "scanner.h"
 #include "semanticanalizer.h"
+#include "threadedtokenstream.h"
 #include "tokenfilter.h"
 
 #include "llvm/ExecutionEngine/ExecutionEngine.h"
@@ -15,15 +16,48 @@
 
 using namespace std;
 
-/** \param osstream caller keeps ownership */
-Driver::Driver(string fileName, basic_ostream<char>* ostream)
+namespace {
+IrGen::Options irGenOptionsOf(const Driver::Options& options) {
+  IrGen::Options res;
+  res.m_isBoundsCheckEnabled = !options.m_isReleaseMode;
+  res.m_isArenaAllocEnabled = options.m_isArenaAllocEnabled;
+  res.m_isVerifyEnabled = options.m_isVerifyEnabled;
+  return res;
+}
+}
+
+Driver::Options::Options() = default;
+
+Driver::Driver(
+  string fileName, basic_ostream<char>* ostream, const Options& options)
+  : Driver{move(fileName), nullptr, ostream, options} {
+}
+
+Driver::Driver(string fileName, string_view source,
+  basic_ostream<char>* ostream, const Options& options)
+  : Driver{move(fileName), &source, ostream, options} {
+}
+
+Driver::Driver(string fileName, const string_view* source,
+  basic_ostream<char>* ostream, const Options& options)
   : m_errorHandler{make_unique<ErrorHandler>()}
   , m_env{make_unique<Env>()}
   , m_ostream{ostream != nullptr ? *ostream : cerr}
-  , m_scanner{Scanner::create(move(fileName), *m_errorHandler)}
+  , m_scannerErrorHandler{
+      options.m_isScanThreadEnabled ? make_unique<ErrorHandler>() : nullptr}
+  , m_scanner{source != nullptr
+        ? Scanner::create(move(fileName), *source, scannerErrorHandler())
+        : Scanner::create(move(fileName), scannerErrorHandler())}
   , m_tokenFilter{make_unique<TokenFilter>(*m_scanner.get())}
-  , m_parser{make_unique<Parser>(*m_tokenFilter, *m_env, *m_errorHandler)}
-  , m_irGen{make_unique<IrGen>(*m_errorHandler)}
+  , m_threadedTokenStream{options.m_isScanThreadEnabled
+        ? make_unique<ThreadedTokenStream>(
+            *m_tokenFilter, *m_scannerErrorHandler, *m_errorHandler)
+        : nullptr}
+  , m_parser{make_unique<Parser>(m_threadedTokenStream
+        ? static_cast<TokenStream&>(*m_threadedTokenStream)
+        : *m_tokenFilter,
+      *m_env, *m_errorHandler)}
+  , m_irGen{make_unique<IrGen>(*m_errorHandler, irGenOptionsOf(options))}
   , m_semanticAnalizer{make_unique<SemanticAnalizer>(*m_env, *m_errorHandler)} {
   assert(m_errorHandler);
   assert(m_env);
@@ -44,12 +78,24 @@ ErrorHandler& Driver::errorHandler() {
   return *m_errorHandler;
 }
 
+ErrorHandler& Driver::scannerErrorHandler() {
+  return m_scannerErrorHandler ? *m_scannerErrorHandler : *m_errorHandler;
+}
+
+void Driver::addHostFunction(HostFunction hostFunction) {
+  assert(hostFunction.m_address);
+  m_hostFunctions.push_back(move(hostFunction));
+}
+
 /** Compile = scann & parse & do semantic analysis & generate IR. */
 void Driver::compile() {
   try {
     Env::AutoLetLooseNodes dummy(*m_env);
 
     auto astAfterParse = scanAndParse();
+    if (!m_hostFunctions.empty()) {
+      astAfterParse = addHostFunctionDecls(move(astAfterParse));
+    }
 
     // It's currently implied that the module wants an implicit main method
     const auto astAfterImplicitMain =
@@ -57,16 +103,97 @@ void Driver::compile() {
 
     doSemanticAnalysis(*astAfterImplicitMain);
 
+    m_hostSymbols.clear();
+    m_exportedFunctions.clear();
+    assert(astAfterImplicitMain->kind() == AstNode::EKind::eFunDef);
+    collectTopLevelFunctions(
+      static_cast<AstFunDef&>(*astAfterImplicitMain).body());
+
     generateIr(*astAfterImplicitMain);
   }
   catch (BuildError& e) {
     // nop -- BuildError exception is handled below by printing any errors
   }
-  if (!m_errorHandler->errors().empty()) {
+  if (!m_errorHandler->errors().empty() ||
+    !m_errorHandler->warnings().empty()) {
     m_ostream << *m_errorHandler << "\n";
   }
 }
 
+/** Returns a sequence of the declarations of the host functions followed by
+the given AST, so the host functions are in scope of the whole source. */
+unique_ptr<AstNode> Driver::addHostFunctionDecls(unique_ptr<AstNode> ast) {
+  // note that valid Locations are created, opposed to passing s_nullLoc
+  auto operands = new vector<AstNode*>{};
+  for (const auto& hostFunction : m_hostFunctions) {
+    auto args = new vector<AstDataDef*>{};
+    for (const auto& arg : hostFunction.m_args) {
+      args->push_back(new AstDataDef{
+        "arg" + to_string(args->size()), arg, nullptr, Location{}});
+    }
+    operands->push_back(new AstFunDef{hostFunction.m_name, args,
+      new AstObjTypeSymbol{hostFunction.m_ret, Location{}}, nullptr,
+      Location{}});
+  }
+  operands->push_back(ast.release());
+  return make_unique<AstSeq>(operands);
+}
+
+/** Descends into the blocks and sequences at the top level of the body of
+main, e.g. the block of the whole program, and records the host function
+declarations in m_hostSymbols and the other function definitions in
+m_exportedFunctions. Uses an explicit stack, since sequences, e.g.
+parentheses, can be nested arbitrarily deep. */
+void Driver::collectTopLevelFunctions(const AstNode& root) {
+  vector<const AstNode*> pending{&root};
+  while (!pending.empty()) {
+    const auto& node = *pending.back();
+    pending.pop_back();
+    if (node.kind() == AstNode::EKind::eBlock) {
+      pending.push_back(&static_cast<const AstBlock&>(node).body());
+    }
+    else if (node.kind() == AstNode::EKind::eSeq) {
+      // reversed, so the operands are popped in source order
+      const auto& operands = static_cast<const AstSeq&>(node).operands();
+      for (auto op = operands.rbegin(); op != operands.rend(); ++op) {
+        pending.push_back(op->get());
+      }
+    }
+    else if (node.kind() == AstNode::EKind::eFunDef) {
+      collectFunction(static_cast<const AstFunDef&>(node));
+    }
+  }
+}
+
+void Driver::collectFunction(const AstFunDef& funDef) {
+  if (funDef.isHostFunction()) {
+    for (const auto& hostFunction : m_hostFunctions) {
+      if (hostFunction.m_name == funDef.name()) {
+        m_hostSymbols.emplace_back(funDef.fqName(), hostFunction.m_address);
+      }
+    }
+  }
+  else {
+    m_exportedFunctions.push_back(ExportedFunction{funDef.name(),
+      funDef.fqName(),
+      static_pointer_cast<const ObjTypeFun>(funDef.objTypeAsSp())});
+  }
+}
+
+void Driver::releaseFrontEnd() {
+  // users first, since e.g. the parser refers to the token stream
+  m_semanticAnalizer.reset();
+  m_irGen.reset();
+  m_parser.reset();
+  m_threadedTokenStream.reset();
+  m_tokenFilter.reset();
+  m_scanner.reset();
+  m_scannerErrorHandler.reset();
+  m_env.reset();
+  m_hostFunctions.clear();
+  m_hostSymbols.clear();
+}
+
 unique_ptr<AstNode> Driver::scanAndParse() {
   // the parser internally drives the scanner
   auto res = m_parser->parse_();
@@ -86,6 +213,9 @@ void Driver::doSemanticAnalysis(AstNode& ast) {
 void Driver::generateIr(AstNode& ast) {
   auto module = m_irGen->genIr(ast);
   m_executionEngine = std::make_unique<ExecutionEngineApater>(move(module));
+  for (const auto& symbol : m_hostSymbols) {
+    m_executionEngine->addGlobalMapping(symbol.first, symbol.second);
+  }
 }
 
 int Driver::jitExecMain() {
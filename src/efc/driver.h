@@ -2,9 +2,13 @@
 
 #include "astforwards.h"
 #include "declutils.h"
+#include "objtype.h"
 
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 class Parser;
 class Location;
@@ -14,6 +18,7 @@ class SemanticAnalizer;
 class IrGen;
 class ExecutionEngineApater;
 class Scanner;
+class ThreadedTokenStream;
 class TokenFilter;
 
 /* Hosts the scanner, parser, semantic analyizer, IR builder etc. and drives
@@ -21,12 +26,57 @@ those. The scanner has no own class; it is driven by it's global function
 yylex.*/
 class Driver {
 public:
-  Driver(std::string fileName, std::basic_ostream<char>* ostream = nullptr);
+  /** A function defined by the C++ host embedding the EF compiler, callable
+  from the compiled EF code by m_name. */
+  struct HostFunction {
+    std::string m_name;
+    std::vector<ObjTypeFunda::EType> m_args;
+    ObjTypeFunda::EType m_ret;
+    /** Points to a function whose signature matches m_args and m_ret */
+    void* m_address;
+  };
+
+  /** A function defined at the top level of the compiled source */
+  struct ExportedFunction {
+    std::string m_name;
+    std::string m_fqName;
+    /** Guaranteed to be non-null */
+    std::shared_ptr<const ObjTypeFun> m_objType;
+  };
+
+  struct Options {
+    /** Defined out of line, so Options{} can be a default argument of
+    Driver's constructors */
+    Options();
+
+    /** See IrGen::Options::m_isArenaAllocEnabled */
+    bool m_isArenaAllocEnabled = false;
+    /** See IrGen::Options::m_isVerifyEnabled */
+    bool m_isVerifyEnabled = true;
+    /** Whether scanning runs on a thread of its own, concurrently to parsing,
+    see ThreadedTokenStream */
+    bool m_isScanThreadEnabled = false;
+    /** In release mode, array indices are not bounds checked, see
+    IrGen::Options::m_isBoundsCheckEnabled */
+    bool m_isReleaseMode = false;
+  };
+
+  /** ostream: caller keeps ownership */
+  Driver(std::string fileName, std::basic_ostream<char>* ostream = nullptr,
+    const Options& options = Options{});
+  /** Analogous, but compiles the given source instead of reading the file
+  fileName. fileName is only used as file name in diagnostics. */
+  Driver(std::string fileName, std::string_view source,
+    std::basic_ostream<char>* ostream = nullptr,
+    const Options& options = Options{});
   virtual ~Driver();
 
   Scanner& scanner();
   ErrorHandler& errorHandler();
 
+  /** Must be called before compile */
+  void addHostFunction(HostFunction hostFunction);
+
   void compile();
   /** Guarantess to return non-null */
   std::unique_ptr<AstNode> scanAndParse();
@@ -34,25 +84,60 @@ public:
   void generateIr(AstNode& ast);
   int jitExecMain();
 
+  /** Destroys the scanner, parser, semantic analizer, IR generator and the
+  AST, keeping only errorHandler, exportedFunctions and executionEngine. Frees
+  the scanner singleton, see Scanner::create, so further Drivers can be
+  created. Must be called after compile; afterwards only the kept parts may be
+  used. */
+  void releaseFrontEnd();
+
+  /** Only valid after compile succeeded */
+  const std::vector<ExportedFunction>& exportedFunctions() const {
+    return m_exportedFunctions;
+  }
+  /** nullptr until compile succeeded */
+  ExecutionEngineApater* executionEngine() { return m_executionEngine.get(); }
+
 private:
   friend class TestingDriver;
 
   NEITHER_COPY_NOR_MOVEABLE(Driver);
 
+  /** If source is nullptr, the file fileName is compiled, else source */
+  Driver(std::string fileName, const std::string_view* source,
+    std::basic_ostream<char>* ostream, const Options& options);
+
+  ErrorHandler& scannerErrorHandler();
+  std::unique_ptr<AstNode> addHostFunctionDecls(std::unique_ptr<AstNode> ast);
+  void collectTopLevelFunctions(const AstNode& root);
+  /** Part of collectTopLevelFunctions, for one function */
+  void collectFunction(const AstFunDef& funDef);
+
   /** Guaranteed to be non-null */
   std::unique_ptr<ErrorHandler> m_errorHandler;
-  /** Guaranteed to be non-null */
+  /** Non-null until releaseFrontEnd */
   std::unique_ptr<Env> m_env;
   std::basic_ostream<char>& m_ostream;
-  /** Guaranteed to be non-nullptr */
+  /** The error handler of the scanner if the scanner runs on a thread of its
+  own, nullptr otherwise. See ThreadedTokenStream. */
+  std::unique_ptr<ErrorHandler> m_scannerErrorHandler;
+  /** Non-null until releaseFrontEnd */
   std::shared_ptr<Scanner> m_scanner;
-  /** Guaranteed to be non-nullptr */
+  /** Non-null until releaseFrontEnd */
   std::unique_ptr<TokenFilter> m_tokenFilter;
-  /** Guaranteed to be non-nullptr */
+  /** Runs the scanner and m_tokenFilter on a thread of their own, if that is
+  enabled, nullptr otherwise */
+  std::unique_ptr<ThreadedTokenStream> m_threadedTokenStream;
+  /** Non-null until releaseFrontEnd */
   std::unique_ptr<Parser> m_parser;
-  /** Guaranteed to be non-nullptr */
+  /** Non-null until releaseFrontEnd */
   std::unique_ptr<IrGen> m_irGen;
-  /** Guaranteed to be non-nullptr */
+  /** Non-null until releaseFrontEnd */
   std::unique_ptr<SemanticAnalizer> m_semanticAnalizer;
   std::unique_ptr<ExecutionEngineApater> m_executionEngine;
+  std::vector<HostFunction> m_hostFunctions;
+  /** Fully qualified name and address of each host function, see
+  collectTopLevelFunctions */
+  std::vector<std::pair<std::string, void*>> m_hostSymbols;
+  std::vector<ExportedFunction> m_exportedFunctions;
 };
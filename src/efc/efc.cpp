@@ -4,17 +4,65 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <string>
 
 using namespace std;
 
 int main(int argc, char** argv) {
-  if (argc != 2) {
-    cerr << "Only exactly one argument, the EF program file name, is allowed.";
+  // -Wnon-tail-recursion enables reporting recursive calls which are no tail
+  // calls. -farena-alloc lets raw_new allocate from an arena released when
+  // main returns, see IrGen::Options::m_isArenaAllocEnabled. -frelease
+  // compiles faster by not naming LLVM values and by not verifying the
+  // generated IR, the latter unless -fverify is given or efc itself is a debug
+  // build. Also array indices are not bounds checked in release mode.
+  // -fscan-thread scans on a thread of its own, concurrently to parsing.
+  auto isNonTailRecursionReported = false;
+  auto isArenaAllocEnabled = false;
+  auto isReleaseMode = false;
+  auto isScanThreadEnabled = false;
+#ifdef NDEBUG
+  auto isVerifyRequested = false;
+#else
+  auto isVerifyRequested = true;
+#endif
+  auto argi = 1;
+  for (/*nop*/; argi < argc - 1; ++argi) {
+    const string option{argv[argi]};
+    if (option == "-Wnon-tail-recursion") { isNonTailRecursionReported = true; }
+    else if (option == "-farena-alloc") {
+      isArenaAllocEnabled = true;
+    }
+    else if (option == "-frelease") {
+      isReleaseMode = true;
+    }
+    else if (option == "-fverify") {
+      isVerifyRequested = true;
+    }
+    else if (option == "-fscan-thread") {
+      isScanThreadEnabled = true;
+    }
+    else {
+      break;
+    }
+  }
+  if (argi != argc - 1) {
+    cerr << "Usage: efc [-Wnon-tail-recursion] [-farena-alloc] [-frelease] "
+            "[-fverify] [-fscan-thread] file\n"
+         << "Exactly one EF program file name is required.";
     exit(1);
   }
   try {
     IrGen::staticOneTimeInit();
-    Driver driver{argv[1]};
+    llvmContext.setDiscardValueNames(isReleaseMode);
+    Driver::Options options;
+    options.m_isArenaAllocEnabled = isArenaAllocEnabled;
+    options.m_isVerifyEnabled = !isReleaseMode || isVerifyRequested;
+    options.m_isScanThreadEnabled = isScanThreadEnabled;
+    options.m_isReleaseMode = isReleaseMode;
+    Driver driver{argv[argi], nullptr, options};
+    if (isNonTailRecursionReported) {
+      driver.errorHandler().enableReportingOf(Error::eNonTailRecursiveCall);
+    }
     driver.compile();
     if (driver.errorHandler().hasErrors()) { exit(1); }
     cout << driver.jitExecMain() << "\n";
@@ -0,0 +1,57 @@
+#include "efmodule.h"
+
+#include "errorhandler.h"
+#include "irgen.h"
+
+using namespace std;
+
+namespace {
+bool isFunda(const ObjType& objType, ObjTypeFunda::EType type) {
+  const auto funda =
+    dynamic_cast<const ObjTypeFunda*>(objType.unqualifiedObjType().get());
+  return funda && funda->type() == type;
+}
+}
+
+EfModule::EfModule(
+  string fileName, string_view source, basic_ostream<char>* ostream)
+  : m_fileName{move(fileName)}
+  , m_source{source}
+  , m_ostream{ostream}
+  , m_isCompiled{false} {
+  IrGen::staticOneTimeInit();
+}
+
+EfModule::~EfModule() = default;
+
+bool EfModule::compile() {
+  assert(!m_driver);
+  m_driver = make_unique<Driver>(move(m_fileName), m_source, m_ostream);
+  for (auto& hostFunction : m_hostFunctions) {
+    m_driver->addHostFunction(move(hostFunction));
+  }
+  m_hostFunctions.clear();
+  m_driver->compile();
+  m_driver->releaseFrontEnd();
+  m_source.clear();
+  m_source.shrink_to_fit();
+  m_isCompiled = !m_driver->errorHandler().hasErrors();
+  return m_isCompiled;
+}
+
+const string* EfModule::fqNameOfFunction(const string& name,
+  const vector<ObjTypeFunda::EType>& args, ObjTypeFunda::EType ret) const {
+  if (!m_isCompiled) { return nullptr; }
+  for (const auto& function : m_driver->exportedFunctions()) {
+    if (function.m_name != name) { continue; }
+    const auto& objType = *function.m_objType;
+    if (!isFunda(objType.ret(), ret) || objType.args().size() != args.size()) {
+      return nullptr;
+    }
+    for (size_t i = 0; i < args.size(); ++i) {
+      if (!isFunda(*objType.args()[i], args[i])) { return nullptr; }
+    }
+    return &function.m_fqName;
+  }
+  return nullptr;
+}
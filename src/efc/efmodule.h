@@ -0,0 +1,153 @@
+#pragma once
+#include "declutils.h"
+#include "driver.h"
+#include "executionengineadapter.h"
+#include "objtype.h"
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class ErrorHandler;
+
+/** The EF fundamental type having the same representation as the C++ type T.
+Only defined for the C++ types which have such an EF counterpart. */
+template<typename T>
+struct ObjTypeFundaOf;
+template<>
+struct ObjTypeFundaOf<void> {
+  static constexpr auto value = ObjTypeFunda::eVoid;
+};
+template<>
+struct ObjTypeFundaOf<unsigned char> {
+  static constexpr auto value = ObjTypeFunda::eChar;
+};
+template<>
+struct ObjTypeFundaOf<int> {
+  static constexpr auto value = ObjTypeFunda::eInt;
+};
+template<>
+struct ObjTypeFundaOf<bool> {
+  static constexpr auto value = ObjTypeFunda::eBool;
+};
+template<>
+struct ObjTypeFundaOf<double> {
+  static constexpr auto value = ObjTypeFunda::eDouble;
+};
+template<>
+struct ObjTypeFundaOf<std::int64_t> {
+  static constexpr auto value = ObjTypeFunda::eInt64;
+};
+template<>
+struct ObjTypeFundaOf<std::uint32_t> {
+  static constexpr auto value = ObjTypeFunda::eUInt32;
+};
+template<>
+struct ObjTypeFundaOf<std::uint64_t> {
+  static constexpr auto value = ObjTypeFunda::eUInt64;
+};
+template<>
+struct ObjTypeFundaOf<float> {
+  static constexpr auto value = ObjTypeFunda::eFloat;
+};
+
+/** The EF signature of the C++ function type TSig, see ObjTypeFundaOf */
+template<typename TSig>
+struct FunSignatureOf;
+template<typename TRet, typename... TArgs>
+struct FunSignatureOf<TRet(TArgs...)> {
+  static std::vector<ObjTypeFunda::EType> args() {
+    return {ObjTypeFundaOf<TArgs>::value...};
+  }
+  static constexpr auto ret = ObjTypeFundaOf<TRet>::value;
+};
+
+/** Embedding API: lets a C++ host compile an EF source once and then call
+its functions via native function pointers, e.g. from a hot loop, without
+going through the efc command line tool. The host can also provide functions
+of its own which the EF source calls by name.
+
+Usage: addHostFunction for each host function, compile, then lookup the EF
+functions of interest once and call the returned pointers as often as
+needed. Only fundamental types, see ObjTypeFundaOf, are supported in the
+signatures of host functions and looked up functions.
+
+The functions available to the host are the ones defined at the top level of
+the source. main is not run by compile; looked up functions thus must not
+depend on anything main does.
+
+The front end, see Driver::releaseFrontEnd, only lives during compile, so any
+number of EfModules can be alive at once. */
+class EfModule final {
+public:
+  /** fileName is only used as file name in diagnostics. Diagnostics are
+  printed to ostream, or to cerr if that is nullptr; caller keeps
+  ownership. */
+  EfModule(std::string fileName, std::string_view source,
+    std::basic_ostream<char>* ostream = nullptr);
+  ~EfModule();
+
+  /** Makes the given host function callable from EF code by the given name,
+  e.g. addHostFunction<int(int)>("square", &square). Must be called before
+  compile. */
+  template<typename TSig>
+  void addHostFunction(std::string name, TSig* address) {
+    assert(!m_driver);
+    m_hostFunctions.push_back(Driver::HostFunction{std::move(name),
+      FunSignatureOf<TSig>::args(), FunSignatureOf<TSig>::ret,
+      reinterpret_cast<void*>(reinterpret_cast<intptr_t>(address))});
+  }
+
+  /** Returns true if compilation succeeded, otherwise see errorHandler. Must
+  be called at most once. */
+  bool compile();
+  /** Only valid after compile */
+  ErrorHandler& errorHandler() {
+    assert(m_driver);
+    return m_driver->errorHandler();
+  }
+
+  /** The functions defined at the top level of the source, with their
+  signature. Only valid after compile succeeded. */
+  const std::vector<Driver::ExportedFunction>& functions() const {
+    assert(m_driver);
+    return m_driver->exportedFunctions();
+  }
+
+  /** Returns a native pointer to the function defined at the top level of the
+  source with the given name, e.g. lookup<int(int, int)>("foo"). Returns
+  nullptr if there is no such function, if its signature doesn't match TSig,
+  or if compile did not succeed. The pointer is valid as long as this EfModule
+  lives. */
+  template<typename TSig>
+  TSig* lookup(const std::string& name) {
+    const auto fqName = fqNameOfFunction(
+      name, FunSignatureOf<TSig>::args(), FunSignatureOf<TSig>::ret);
+    return fqName ? m_driver->executionEngine()->lookup<TSig>(*fqName)
+                  : nullptr;
+  }
+
+private:
+  NEITHER_COPY_NOR_MOVEABLE(EfModule);
+
+  /** Returns nullptr if there is no such function or compile did not
+  succeed */
+  const std::string* fqNameOfFunction(const std::string& name,
+    const std::vector<ObjTypeFunda::EType>& args,
+    ObjTypeFunda::EType ret) const;
+
+  std::string m_fileName;
+  /** Cleared by compile */
+  std::string m_source;
+  /** nullptr means cerr. We're _not_ the owner. */
+  std::basic_ostream<char>* m_ostream;
+  /** See addHostFunction. Handed over to m_driver by compile. */
+  std::vector<Driver::HostFunction> m_hostFunctions;
+  /** Created by compile, which also releases its front end. nullptr before
+  compile. */
+  std::unique_ptr<Driver> m_driver;
+  bool m_isCompiled;
+};
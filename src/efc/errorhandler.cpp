@@ -31,24 +31,39 @@ Error::Error(Error::No no, string message, string msgParam1, string msgParam2,
 void Error::throwError(ErrorHandler& errorHandler, No no, Location loc,
   string msgParam1, string msgParam2, string msgParam3) {
   if (!errorHandler.isReportingDisabledFor(no)) {
-    stringstream ss{};
-    if (!loc.isNull()) {
-      if (loc.begin.m_fileName != nullptr) { ss << *loc.begin.m_fileName; }
-      else {
-        ss << "<anonymous file>";
-      }
-      ss << ":" << loc.begin.m_line << ":" << loc.begin.m_column << ": ";
-    }
-    ss << "error: " << describe(no, msgParam1, msgParam2, msgParam3) << " ["
-       << no << "]";
-
-    auto error = shared_ptr<Error>{new Error{
-      no, ss.str(), move(msgParam1), move(msgParam2), move(msgParam3)}};
+    auto error = create(
+      "error", no, loc, move(msgParam1), move(msgParam2), move(msgParam3));
     errorHandler.add(error);
     throw BuildError{error};
   }
 }
 
+void Error::reportWarning(ErrorHandler& errorHandler, No no, Location loc,
+  string msgParam1, string msgParam2, string msgParam3) {
+  if (!errorHandler.isReportingDisabledFor(no)) {
+    errorHandler.addWarning(create(
+      "warning", no, loc, move(msgParam1), move(msgParam2), move(msgParam3)));
+  }
+}
+
+shared_ptr<Error> Error::create(const char* severity, No no,
+  const Location& loc, string msgParam1, string msgParam2, string msgParam3) {
+  stringstream ss{};
+  if (!loc.isNull()) {
+    const auto begin = loc.begin();
+    if (begin.m_fileName != nullptr) { ss << *begin.m_fileName; }
+    else {
+      ss << "<anonymous file>";
+    }
+    ss << ":" << begin.m_line << ":" << begin.m_column << ": ";
+  }
+  ss << severity << ": " << describe(no, msgParam1, msgParam2, msgParam3)
+     << " [" << no << "]";
+
+  return shared_ptr<Error>{new Error{
+    no, ss.str(), move(msgParam1), move(msgParam2), move(msgParam3)}};
+}
+
 string Error::describe(Error::No no, const string& msgParam1,
   const string& msgParam2, const string& /*msgParam3*/) {
   switch (no) {
@@ -66,6 +81,8 @@ string Error::describe(Error::No no, const string& msgParam1,
     // we take advantage of the fact that currently constructors only have one argument
   case Error::eNoSuchCtor: return "type '" + msgParam1 + "' has no constructor callable with (" + msgParam2 + ")";
   case Error::eNoSuchMemberFun: return "type '" + msgParam1 + "' has no member function '" + msgParam2 + "'";
+  case Error::eNoSuchMember: return "type '" + msgParam1 + "' has no data member '" + msgParam2 + "'";
+  case Error::eNoSuchBuiltinFunOverload: return "builtin function '" + msgParam1 + "' is not defined for type '" + msgParam2 + "'";
   case Error::eNotInFunBodyContext: return "return is not allowed outside a function definition";
   case Error::eUnreachableCode: return "leaves control flow and the following code is not reachable";
   case Error::eCTConstRequired: return "currently static objects can only be initialized with compile time const expressions (which in turn are currently limited to literals)";
@@ -77,6 +94,13 @@ string Error::describe(Error::No no, const string& msgParam1,
   case Error::eInvalidStorageDurationInDef: return "storage duration '" + msgParam1 + "' is invalid for this definition";
   case Error::eTypeInferenceIsNotYetSupported: return "currently type inference is not yet supported";
   case Error::eNonIgnoreAccessToLocalDataObjectBeforeItsInitialization: return "local object '" + msgParam1 + "' is accessed before it is initialized";
+  case Error::eInvalidSimdLaneCount: return "the lane count of a simd type must be a positive integral literal, but is '" + msgParam1 + "'";
+  case Error::eInvalidSimdElementType: return "the element type of a simd type must be an unqualified arithmetic type or bool, but is '" + msgParam1 + "'";
+  case Error::eInvalidArraySize: return "the size of an array type must be a positive integral literal, but is '" + msgParam1 + "'";
+  case Error::eInvalidArrayElementType: return "the element type of an array type must be an unqualified fundamental, simd or array type, but is '" + msgParam1 + "'";
+  case Error::eInvalidTripCount: return "the expected trip count must be a non-negative integral literal representable by 32 bits";
+  case Error::eInvalidLoopHint: return "invalid loop hint '" + msgParam1 + "', expecting vectorize=N, interleave=N or unroll=N with N being a positive integral literal, or independent";
+  case Error::eNonTailRecursiveCall: return "recursive call to function '" + msgParam1 + "' is not a tail call";
   case Error::eCnt: return "<unknown>";
     // clang-format on
   }
@@ -98,6 +122,8 @@ const char* toStr(Error::No no) {
   case Error::eInvalidArguments: return "eInvalidArguments";
   case Error::eNoSuchCtor: return "eNoSuchCtor";
   case Error::eNoSuchMemberFun: return "eNoSuchMemberFun";
+  case Error::eNoSuchMember: return "eNoSuchMember";
+  case Error::eNoSuchBuiltinFunOverload: return "eNoSuchBuiltinFunOverload";
   case Error::eNotInFunBodyContext: return "eNotInFunBodyContext";
   case Error::eUnreachableCode: return "eUnreachableCode";
   case Error::eCTConstRequired: return "eCTConstRequired";
@@ -109,6 +135,13 @@ const char* toStr(Error::No no) {
   case Error::eInvalidStorageDurationInDef: return "eInvalidStorageDurationInDef";
   case Error::eTypeInferenceIsNotYetSupported: return "eTypeInferenceIsNotYetSupported";
   case Error::eNonIgnoreAccessToLocalDataObjectBeforeItsInitialization: return "eNonIgnoreAccessToLocalDataObjectBeforeItsInitialization";
+  case Error::eInvalidSimdLaneCount: return "eInvalidSimdLaneCount";
+  case Error::eInvalidSimdElementType: return "eInvalidSimdElementType";
+  case Error::eInvalidArraySize: return "eInvalidArraySize";
+  case Error::eInvalidArrayElementType: return "eInvalidArrayElementType";
+  case Error::eInvalidTripCount: return "eInvalidTripCount";
+  case Error::eInvalidLoopHint: return "eInvalidLoopHint";
+  case Error::eNonTailRecursiveCall: return "eNonTailRecursiveCall";
   case Error::eCnt: return "<unknown>";
     // clang-format on
   }
@@ -124,16 +157,26 @@ ostream& operator<<(ostream& os, const Error& error) {
 }
 
 ErrorHandler::ErrorHandler() : m_disabledErrors{} {
+  // diagnostics the user has to opt in to
+  disableReportingOf(Error::eNonTailRecursiveCall);
 }
 
 void ErrorHandler::add(shared_ptr<Error> error) {
   m_errors.emplace_back(move(error));
 }
 
+void ErrorHandler::addWarning(shared_ptr<Error> warning) {
+  m_warnings.emplace_back(move(warning));
+}
+
 void ErrorHandler::disableReportingOf(Error::No no) {
   m_disabledErrors.at(no) = true;
 }
 
+void ErrorHandler::enableReportingOf(Error::No no) {
+  m_disabledErrors.at(no) = false;
+}
+
 bool ErrorHandler::isReportingDisabledFor(Error::No no) const {
   return m_disabledErrors.at(no);
 }
@@ -142,12 +185,13 @@ ErrorHandler::~ErrorHandler() = default;
 
 ostream& operator<<(ostream& os, const ErrorHandler& errorHandler) {
   auto isFirstIter = true;
-  for (const auto& e : errorHandler.errors()) {
-    if (!isFirstIter) {
-      os << "\n";
+  for (const auto container :
+    {&errorHandler.warnings(), &errorHandler.errors()}) {
+    for (const auto& e : *container) {
+      if (!isFirstIter) { os << "\n"; }
       isFirstIter = false;
+      os << *e;
     }
-    os << *e;
   }
   return os;
 }
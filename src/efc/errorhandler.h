@@ -27,6 +27,8 @@ public:
     eInvalidArguments,
     eNoSuchCtor,
     eNoSuchMemberFun,
+    eNoSuchMember,
+    eNoSuchBuiltinFunOverload,
     eNotInFunBodyContext,
     eUnreachableCode,
     eCTConstRequired,
@@ -38,6 +40,13 @@ public:
     eNonIgnoreAccessToLocalDataObjectBeforeItsInitialization,
     eParseFailed,
     eUnexpectedCharacter,
+    eInvalidSimdLaneCount,
+    eInvalidSimdElementType,
+    eInvalidArraySize,
+    eInvalidArrayElementType,
+    eInvalidTripCount,
+    eInvalidLoopHint,
+    eNonTailRecursiveCall,
     eCnt
   };
 
@@ -46,6 +55,12 @@ public:
   static void throwError(ErrorHandler& errorHandler, No no,
     Location loc = s_nullLoc, std::string msgParam1 = "",
     std::string msgParam2 = "", std::string msgParam3 = "");
+  /** Unless given error is disabled, adds a new Error as warning to
+  ErrorHandler. Opposed to throwError nothing is thrown, i.e. the build
+  continues. */
+  static void reportWarning(ErrorHandler& errorHandler, No no,
+    Location loc = s_nullLoc, std::string msgParam1 = "",
+    std::string msgParam2 = "", std::string msgParam3 = "");
 
   No no() const { return m_no; }
   const std::string& message() const { return m_message; }
@@ -63,6 +78,11 @@ private:
 
   Error(No no, std::string message, std::string msgParam1 = "",
     std::string msgParam2 = "", std::string msgParam3 = "");
+  /** severity is the word prefixing the description in the message, e.g.
+  "error" */
+  static std::shared_ptr<Error> create(const char* severity, No no,
+    const Location& loc, std::string msgParam1, std::string msgParam2,
+    std::string msgParam3);
 
   const No m_no;
   const std::string m_message;
@@ -88,9 +108,12 @@ public:
   ~ErrorHandler();
 
   void add(std::shared_ptr<Error> error);
+  void addWarning(std::shared_ptr<Error> warning);
   const Container& errors() const { return m_errors; }
+  const Container& warnings() const { return m_warnings; }
   bool hasErrors() const { return !m_errors.empty(); }
   void disableReportingOf(Error::No no);
+  void enableReportingOf(Error::No no);
   bool isReportingDisabledFor(Error::No no) const;
 
 private:
@@ -98,6 +121,8 @@ private:
 
   /** The ptrs are guaranteed to be non-nullptr */
   Container m_errors;
+  /** The ptrs are guaranteed to be non-nullptr */
+  Container m_warnings;
   std::array<bool, Error::eCnt> m_disabledErrors;
 };
 
@@ -0,0 +1,75 @@
+#include "escapeanalizer.h"
+
+#include "ast.h"
+
+using namespace std;
+
+void EscapeAnalizer::analyze(AstNode& root) {
+  m_candidates.clear();
+  m_harmlessUses.clear();
+  m_addrRevealingNodes.clear();
+  root.accept(*this);
+
+  for (const auto& candidate : m_candidates) {
+    if (candidate.second.m_escapes) { continue; }
+    candidate.second.m_rawNew->setIsStackPromoted();
+    for (const auto& rawDelete : candidate.second.m_rawDeletes) {
+      rawDelete->setIsStackPromoted();
+    }
+  }
+}
+
+void EscapeAnalizer::visit(AstOperator& op) {
+  const auto& args = op.args().childs();
+  const auto isAddrRevealed = op.accessFromAstParent() ==
+      Access::eTakeAddress ||
+    m_addrRevealingNodes.count(&op) != 0;
+  // The object denoted by a dot-assignment is its lhs
+  if (op.op() == AstOperator::eAssign && isAddrRevealed) {
+    m_addrRevealingNodes.insert(args.front());
+  }
+  else if (op.op() == AstOperator::eDeref && !isAddrRevealed) {
+    m_harmlessUses.insert(args.front());
+  }
+  AstDefaultIterator::visit(op);
+}
+
+void EscapeAnalizer::visit(AstSymbol& symbol) {
+  const auto candidate = m_candidates.find(&symbol.referencedObj());
+  if (candidate != m_candidates.end() && m_harmlessUses.count(&symbol) == 0) {
+    candidate->second.m_escapes = true;
+  }
+  AstDefaultIterator::visit(symbol);
+}
+
+void EscapeAnalizer::visit(AstFunCall& funCall) {
+  // The address of a call to a builtin function doesn't refer to an object
+  if (funCall.builtin() != AstFunCall::eNoBuiltin) {
+    funCall.args().accept(*this);
+    return;
+  }
+  AstDefaultIterator::visit(funCall);
+}
+
+void EscapeAnalizer::visit(AstDataDef& dataDef) {
+  const auto& ctorArgs = dataDef.ctorArgs().childs();
+  const auto rawNew = ctorArgs.size() == 1U
+    ? dynamic_cast<AstRawNew*>(ctorArgs.front())
+    : nullptr;
+  if (rawNew && dataDef.storageDuration() == StorageDuration::eLocal &&
+    !dataDef.isModifiedOrRevealsAddr()) {
+    m_candidates[&dataDef] = Candidate{rawNew, {}, false};
+  }
+  AstDefaultIterator::visit(dataDef);
+}
+
+void EscapeAnalizer::visit(AstRawDelete& rawDelete) {
+  if (const auto symbol = dynamic_cast<AstSymbol*>(&rawDelete.ptr())) {
+    const auto candidate = m_candidates.find(&symbol->referencedObj());
+    if (candidate != m_candidates.end()) {
+      candidate->second.m_rawDeletes.push_back(&rawDelete);
+      m_harmlessUses.insert(symbol);
+    }
+  }
+  AstDefaultIterator::visit(rawDelete);
+}
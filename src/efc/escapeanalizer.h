@@ -0,0 +1,46 @@
+#pragma once
+#include "astdefaultiterator.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+class Object;
+
+/** Finds data objects created by raw_new which provably never escape the
+function creating them, and marks those AstRawNew as stack promoted, see
+AstRawNew::isStackPromoted.
+
+Currently only a raw_new being the initializer of a local data object p is
+considered. The new data object escapes unless p is neither modified nor its
+address taken (see Object::isModifiedOrRevealsAddr), and every use of p is
+either the operand of a raw_delete or of a dereference whose address in turn
+is not taken. So p's value, the address of the new data object, is never
+stored, passed or returned.
+
+\pre SemanticAnalizer must have massaged the AST */
+class EscapeAnalizer : private AstDefaultIterator {
+public:
+  void analyze(AstNode& root);
+
+private:
+  /** What is known about a local data object initialized by a raw_new */
+  struct Candidate {
+    AstRawNew* m_rawNew;
+    std::vector<AstRawDelete*> m_rawDeletes;
+    bool m_escapes;
+  };
+
+  void visit(AstOperator& op) override;
+  void visit(AstSymbol& symbol) override;
+  void visit(AstFunCall& funCall) override;
+  void visit(AstDataDef& dataDef) override;
+  void visit(AstRawDelete& rawDelete) override;
+
+  /** Keys are the data objects initialized by a raw_new */
+  std::map<const Object*, Candidate> m_candidates;
+  /** Symbols whose use doesn't let the pointed-to object escape */
+  std::set<const AstNode*> m_harmlessUses;
+  /** Nodes whose object's address is revealed via an ancestor AST node */
+  std::set<const AstNode*> m_addrRevealingNodes;
+};
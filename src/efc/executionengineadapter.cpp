@@ -1,5 +1,7 @@
 #include "executionengineadapter.h"
 
+#include "runtime.h"
+
 #include "llvm/ExecutionEngine/MCJIT.h"
 
 using namespace std;
@@ -9,4 +11,24 @@ ExecutionEngineApater::ExecutionEngineApater(unique_ptr<Module> module)
   : m_module{(assert(module), *module)}
   , m_executionEngine{EngineBuilder(move(module)).create()} {
   assert(m_executionEngine);
+  for (const auto& symbol : runtimeSymbols()) {
+    m_executionEngine->addGlobalMapping(
+      symbol.first, reinterpret_cast<uint64_t>(symbol.second));
+  }
+}
+
+void ExecutionEngineApater::addGlobalMapping(
+  const string& fqName, void* address) {
+  assert(address);
+  m_executionEngine->addGlobalMapping(
+    fqName, reinterpret_cast<uint64_t>(address));
+}
+
+void* ExecutionEngineApater::pointerToFunction(const string& fqName) {
+  m_executionEngine->finalizeObject();
+  const auto function = m_module.getFunction(fqName);
+  if (!function) { return nullptr; }
+  const auto functionPtr = m_executionEngine->getPointerToFunction(function);
+  assert(functionPtr);
+  return functionPtr;
 }
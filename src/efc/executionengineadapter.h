@@ -20,22 +20,38 @@ public:
 
   llvm::Module& module() { return m_module; }
 
+  /** Makes the function declared with the given fully qualified name, but
+  not defined in the module, resolve to the given address. Must be called
+  before the first lookup. */
+  void addGlobalMapping(const std::string& fqName, void* address);
+
+  /** JIT executes the function with the given fully qualified name. Looks up
+  the function on each call, see lookup for repeated calls. */
   template<typename TRet = int, typename... TArgs>
   TRet jitExecFunction(const std::string& fqName, TArgs... args) {
-    m_executionEngine->finalizeObject();
-    const auto function = m_module.getFunction(fqName);
-    assert(function);
-    void* functionVoidPtr = m_executionEngine->getPointerToFunction(function);
-    assert(functionVoidPtr);
-    TRet (*functionPtr)(TArgs...) =
-      (TRet(*)(TArgs...))(intptr_t)functionVoidPtr;
+    const auto functionPtr = lookup<TRet(TArgs...)>(fqName);
     assert(functionPtr);
     return functionPtr(args...);
   }
 
+  /** Returns a pointer to the JIT compiled function with the given fully
+  qualified name, e.g. lookup<int(int, int)>(".foo"). TSig must match the
+  function's signature. The function is resolved only once, so calling the
+  returned pointer costs no more than a plain indirect call; meant for hosts
+  calling an EF function many times. The pointer is valid as long as this
+  ExecutionEngineApater lives. Returns nullptr if there is no such
+  function. */
+  template<typename TSig>
+  TSig* lookup(const std::string& fqName) {
+    return reinterpret_cast<TSig*>(
+      reinterpret_cast<intptr_t>(pointerToFunction(fqName)));
+  }
+
 private:
   NEITHER_COPY_NOR_MOVEABLE(ExecutionEngineApater);
 
+  void* pointerToFunction(const std::string& fqName);
+
   llvm::Module& m_module;
   /** Guaranteed to be non-null. We're _not_ the owner. */
   llvm::ExecutionEngine* m_executionEngine;
@@ -1,5 +1,9 @@
 #pragma once
+#include <limits>
 
 /** General type which is large enough for all currently supported EF scalar
-types. */
-using GeneralValue = double;
+types. long double is used since, unlike double, it can represent every 64 bit
+integer exactly. */
+using GeneralValue = long double;
+static_assert(std::numeric_limits<GeneralValue>::digits >= 64,
+  "GeneralValue can't represent all 64 bit integers exactly");
@@ -30,8 +30,11 @@
   /* Declarations and definitions needed to declare semantic value types used in
   tokens produced by scanner. */
   #include "../generalvalue.h"
+  #include "../loophints.h"
   #include "../objtype.h"
 
+  #include <string_view>
+
   enum class StorageDuration: int;
 
   struct NumberToken {
@@ -90,6 +93,17 @@
   using namespace std;
   using namespace yy;
 
+  /** As bison's default, but also sets the source file, see Location. */
+  #define YYLLOC_DEFAULT(Current, Rhs, N)                               \
+    do {                                                                \
+      if (N) { (Current) = YYRHSLOC(Rhs, 1) + YYRHSLOC(Rhs, N); }       \
+      else {                                                            \
+        const auto& previous = YYRHSLOC(Rhs, 0);                        \
+        (Current) =                                                     \
+          Location{previous.m_sourceFile, previous.m_end, previous.m_end}; \
+      }                                                                 \
+    } while (false)
+
   /** Returns the next token. It is called by the generated parser, which
   expects this method to be defined. The argument type is specified by the
   %lex-param directive. The definition is in the epilogue section of this
@@ -142,35 +156,47 @@
   OR "or"
   PIPE_PIPE "||"
   EQUAL_EQUAL "=="
+  LESS "<"
+  LESS_LESS "<<"
+  GREATER_GREATER ">>"
+  PIPE "|"
+  CARET "^"
   LPAREN_EQUAL "(="
   SLASH "/"
   LPAREN "("
   RPAREN ")"
   LBRACE "{"
   RBRACE "}"
+  LBRACKET "["
+  RBRACKET "]"
   ARROW "->"
   MUT "mut"
   IS "is"
   STATIC "static"
   LOCAL "local"
   NOINIT "noinit"
+  SIMD "simd"
 ;
 
 %token <ObjTypeFunda::EType> FUNDAMENTAL_TYPE
-%token <std::string> OP_NAME
-%token <std::string> ID "identifier"
+%token <std::string_view> OP_NAME
+%token <std::string_view> ID "identifier"
 %token <NumberToken> NUMBER "number"
 %precedence ASSIGNEMENT
 %right EQUAL EQUAL_LESS
 %left PIPE_PIPE OR
 %left AMPER_AMPER AND
-%left EQUAL_EQUAL
+%left EQUAL_EQUAL LESS
+%left PIPE
+%left CARET
+%left AMPER
+%left LESS_LESS GREATER_GREATER
 %left PLUS
       MINUS
 %left STAR
       SLASH
-%precedence EXCL NOT AMPER RETURN
-%precedence LPAREN
+%precedence EXCL NOT ADDROF RETURN
+%precedence LPAREN LBRACKET
 
 %token TOKENLISTEND "<TOKENLISTEND>"
 
@@ -189,6 +215,7 @@
 %type <AstFunDef*> naked_fun_def
 %type <AstObjType*> type opt_type type_arg
 %type <ConditionActionPair> condition_action_pair_then
+%type <LoopHints> opt_loop_hints loop_hint_list
 %type <std::string> opt_id
 %type <FunSignature> fun_signature_arg opt_fun_signature_arg
 
@@ -283,6 +310,8 @@ ct_list_arg
 type
   : FUNDAMENTAL_TYPE                                { $$ = new AstObjTypeSymbol{$1, @$}; }
   | STAR           opt_nl type                      { $$ = new AstObjTypePtr{$3, @$}; }
+  | SIMD LBRACKET NUMBER RBRACKET opt_nl type        { $$ = genParserExt.mkSimdType($3.m_value, $3.m_objType, $6, @$); }
+  | LBRACKET NUMBER RBRACKET opt_nl type             { $$ = genParserExt.mkArrayType($2.m_value, $2.m_objType, $5, @$); }
   | type_qualifier opt_nl type                      { $$ = new AstObjTypeQuali{$1, $3, @$}; }
   | ID                                              { assert(false); /* user defined names not yet supported; but I wanted to have ID already in grammar*/ }
   ;
@@ -382,14 +411,19 @@ expr
 operator_expr
   /* function call and cast (aka construction of temporary) */
   : expr             LPAREN ct_list RPAREN          { $$ = new AstFunCall{$1, $3, @2}; }
-  | OP_NAME          LPAREN ct_list RPAREN          { $$ = genParserExt.mkOperatorTree($1, $3, @2); }
+  | OP_NAME          LPAREN ct_list RPAREN          { $$ = genParserExt.mkOperatorTree(std::string{$1}, $3, @2); }
   | FUNDAMENTAL_TYPE LPAREN ct_list RPAREN          { $$ = new AstCast{new AstObjTypeSymbol{$1, @1}, $3, @2}; }
+  | SIMD LBRACKET NUMBER RBRACKET FUNDAMENTAL_TYPE LPAREN ct_list RPAREN
+                                                    { $$ = new AstCast{genParserExt.mkSimdType($3.m_value, $3.m_objType, new AstObjTypeSymbol{$5, @5}, @1), $7, @6}; }
+
+  /* subscript */
+  | expr             LBRACKET expr RBRACKET         { $$ = new AstOperator{AstOperator::eIndex, $1, $3, @2}; }
 
   /* unary prefix */
   | NOT    opt_nl expr                              { $$ = new AstOperator{AstOperator::eNot, $3, nullptr, @1}; }
   | EXCL   opt_nl expr                              { $$ = new AstOperator{AstOperator::eNot, $3, nullptr, @1}; }
   | STAR   opt_nl expr                              { $$ = new AstOperator{AstOperator::eDeref, $3, nullptr, @1}; }
-  | AMPER  opt_nl expr                              { $$ = new AstOperator{'&', $3, nullptr, @1}; }
+  | AMPER  opt_nl expr %prec ADDROF                 { $$ = new AstOperator{'&', $3, nullptr, @1}; }
   | MINUS  opt_nl expr                              { $$ = new AstOperator{'-', $3, nullptr, @1}; }
   | PLUS   opt_nl expr                              { $$ = new AstOperator{'+', $3, nullptr, @1}; }
   | RETURN        expr                              { $$ = new AstReturn{$2, @1}; }
@@ -398,15 +432,21 @@ operator_expr
   /* binary operators */
   | expr EQUAL       opt_nl expr                    { $$ = new AstOperator{'=', $1, $4, @2}; }
   | expr EQUAL_LESS  opt_nl expr                    { $$ = new AstOperator{"=<", $1, $4, @2}; }
-  | ID   COLON_EQUAL opt_nl expr %prec ASSIGNEMENT  { $$ = new AstDataDef{$1, genParserExt.mkDefaultType(@2), genParserExt.mkDefaultStorageDuration(), new AstCtList{@2, $4}, @2}; }
-  | expr OR          opt_nl expr                    { $$ = new AstOperator{AstOperator::eOr, $1, $4, @2}; }
-  | expr PIPE_PIPE   opt_nl expr                    { $$ = new AstOperator{AstOperator::eOr, $1, $4, @2}; }
-  | expr AND         opt_nl expr                    { $$ = new AstOperator{AstOperator::eAnd, $1, $4, @2}; }
-  | expr AMPER_AMPER opt_nl expr                    { $$ = new AstOperator{AstOperator::eAnd, $1, $4, @2}; }
+  | ID   COLON_EQUAL opt_nl expr %prec ASSIGNEMENT  { $$ = new AstDataDef{std::string{$1}, genParserExt.mkDefaultType(@2), genParserExt.mkDefaultStorageDuration(), new AstCtList{@2, $4}, @2}; }
+  | expr OR          opt_nl expr                    { $$ = genParserExt.mkBinaryOperator(AstOperator::eOr, $1, $4, @2); }
+  | expr PIPE_PIPE   opt_nl expr                    { $$ = genParserExt.mkBinaryOperator(AstOperator::eOr, $1, $4, @2); }
+  | expr AND         opt_nl expr                    { $$ = genParserExt.mkBinaryOperator(AstOperator::eAnd, $1, $4, @2); }
+  | expr AMPER_AMPER opt_nl expr                    { $$ = genParserExt.mkBinaryOperator(AstOperator::eAnd, $1, $4, @2); }
   | expr EQUAL_EQUAL opt_nl expr                    { $$ = new AstOperator{AstOperator::eEqualTo, $1, $4, @2}; }
-  | expr PLUS        opt_nl expr                    { $$ = new AstOperator{'+', $1, $4, @2}; }
+  | expr LESS        opt_nl expr                    { $$ = new AstOperator{'<', $1, $4, @2}; }
+  | expr PIPE        opt_nl expr                    { $$ = new AstOperator{'|', $1, $4, @2}; }
+  | expr CARET       opt_nl expr                    { $$ = new AstOperator{'^', $1, $4, @2}; }
+  | expr AMPER       opt_nl expr                    { $$ = new AstOperator{AstOperator::eBitAnd, $1, $4, @2}; }
+  | expr LESS_LESS   opt_nl expr                    { $$ = new AstOperator{AstOperator::eShl, $1, $4, @2}; }
+  | expr GREATER_GREATER opt_nl expr                { $$ = new AstOperator{AstOperator::eShr, $1, $4, @2}; }
+  | expr PLUS        opt_nl expr                    { $$ = genParserExt.mkBinaryOperator(AstOperator::eAdd, $1, $4, @2); }
   | expr MINUS       opt_nl expr                    { $$ = new AstOperator{'-', $1, $4, @2}; }
-  | expr STAR        opt_nl expr                    { $$ = new AstOperator{'*', $1, $4, @2}; }
+  | expr STAR        opt_nl expr                    { $$ = genParserExt.mkBinaryOperator(AstOperator::eMul, $1, $4, @2); }
   | expr SLASH       opt_nl expr                    { $$ = new AstOperator{'/', $1, $4, @2}; }
   ;
 
@@ -415,7 +455,7 @@ primary_expr
   | NUMBER                                          { $$ = new AstNumber{$1.m_value, $1.m_objType, @1}; }
   | LPAREN node_seq RPAREN                          { $$ = $2; }
   | LPAREN RPAREN                                   { $$ = new AstNop{@$}; }
-  | ID                                              { $$ = new AstSymbol{$1, @1}; }
+  | ID                                              { $$ = new AstSymbol{std::string{$1}, @1}; }
   | NOP                                             { $$ = new AstNop{@1}; }
   ;
 
@@ -428,10 +468,10 @@ list_expr
   | IF                naked_if             kwac     { std::swap($$,$2); }
   | WHILE_LPAREN      naked_while          RPAREN   { std::swap($$,$2); }
   | WHILE             naked_while          kwac     { std::swap($$,$2); }
-  | RAW_NEW_LPAREN    type initializer_arg RPAREN   { $$ = nullptr; }
-  | RAW_NEW           type initializer_arg kwac     { $$ = nullptr; }
-  | RAW_DELETE_LPAREN expr                 RPAREN   { $$ = nullptr; }
-  | RAW_DELETE        expr                 kwac     { $$ = nullptr; }
+  | RAW_NEW_LPAREN    type initializer_arg RPAREN   { $$ = new AstRawNew{$2, $3, @1}; }
+  | RAW_NEW           type initializer_arg kwac     { $$ = new AstRawNew{$2, $3, @1}; }
+  | RAW_DELETE_LPAREN expr                 RPAREN   { $$ = new AstRawDelete{$2, @1}; }
+  | RAW_DELETE        expr                 kwac     { $$ = new AstRawDelete{$2, @1}; }
   ;
 
 /* keyword argument list close delimiter */
@@ -457,7 +497,7 @@ naked_data_def
   ensures that at type or storage duration is specified. Now we ensure that
   either id or initializer is specified. */
   | opt_id initializer_special_arg                                                            { $$ = new RawAstDataDef{genParserExt.errorHandler(), $1, $2     , nullptr, genParserExt.mkDefaultType(@1), genParserExt.mkDefaultStorageDuration(), @1}; }
-  | ID                                                                                        { $$ = new RawAstDataDef{genParserExt.errorHandler(), $1, nullptr, nullptr, genParserExt.mkDefaultType(@1), genParserExt.mkDefaultStorageDuration(), @1}; }
+  | ID                                                                                        { $$ = new RawAstDataDef{genParserExt.errorHandler(), std::string{$1}, nullptr, nullptr, genParserExt.mkDefaultType(@1), genParserExt.mkDefaultStorageDuration(), @1}; }
   ;
 
 naked_fun_def
@@ -567,7 +607,19 @@ opt_else
 naked_while
   /* not ct_list_arg because do_sep allows newline as sep, which in ct_list_arg
   are seq_operator */
-  : standalone_expr do_sep block                                     { $$ = new AstBlock{new AstLoop{$1, $3, @1}, @1}; }
+  : opt_loop_hints standalone_expr do_sep block                      { $$ = new AstBlock{new AstLoop{$2, $4, $1, @2}, @2}; }
+  ;
+
+opt_loop_hints
+  : %empty                                                           { $$ = LoopHints{}; }
+  | LBRACKET loop_hint_list RBRACKET                                 { std::swap($$,$2); }
+  ;
+
+loop_hint_list
+  : ID                                                               { genParserExt.addLoopHint($$, std::string{$1}, @1); }
+  | ID EQUAL NUMBER                                                  { genParserExt.addLoopHint($$, std::string{$1}, $3.m_value, $3.m_objType, @$); }
+  | loop_hint_list COMMA ID                                          { std::swap($$,$1); genParserExt.addLoopHint($$, std::string{$3}, @3); }
+  | loop_hint_list COMMA ID EQUAL NUMBER                             { std::swap($$,$1); genParserExt.addLoopHint($$, std::string{$3}, $5.m_value, $5.m_objType, @3); }
   ;
 
 condition_action_pair_then
@@ -582,7 +634,7 @@ opt_nl
 
 opt_id
   : %empty                                                           { $$ = s_anonymousName; }
-  | ID                                                               { swap($$,$1); }
+  | ID                                                               { $$ = std::string{$1}; }
   ;
 
 /* Epilogue section
@@ -599,5 +651,6 @@ void yy::GenParser::error(const location_type& loc, const std::string& msg)
 
 // See declaration at the top of this file
 yy::GenParser::symbol_type yylex(TokenStream& tokenStream) {
-  return tokenStream.pop();
+  const auto token = tokenStream.pop();
+  return tokenStream.symbol(token);
 }
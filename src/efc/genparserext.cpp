@@ -5,6 +5,7 @@
 #include "errorhandler.h"
 
 #include <cassert>
+#include <sstream>
 #include <stdexcept>
 #include <utility>
 
@@ -55,12 +56,23 @@ ObjType::Qualifiers GenParserExt::mkDefaultObjectTypeQualifier() {
 
 /** Turns the AstCtList in an AstOperator tree with at most two childs per
 node.  The AstCtList object is deleted, its ex-childs are now owned by their
-respective AstOperator parent. */
+respective AstOperator parent. n-ary operators, see AstOperator::isNAry, need no
+tree, the AstCtList becomes the args of the single AstOperator. */
 AstOperator* GenParserExt::mkOperatorTree(
   const string& op_as_str, AstCtList* args, Location loc) {
   assert(args);
-  args->releaseOwnership();
   const auto op = AstOperator::toEOperationPreferingBinary(op_as_str);
+
+  // simd operators and the unary bitwise operators have a fixed arity and are
+  // not chainable, so no tree needs to be build
+  if (AstOperator::classOf(op) == AstOperator::eSimd ||
+    op == AstOperator::eCtpop || op == AstOperator::eCtlz ||
+    op == AstOperator::eCttz || op == AstOperator::eBswap ||
+    (AstOperator::isNAry(op) && args->childs().size() >= 2)) {
+    return new AstOperator{op, args, move(loc)};
+  }
+
+  args->releaseOwnership();
   AstOperator* tree = nullptr;
 
   // unary operator
@@ -98,6 +110,18 @@ AstOperator* GenParserExt::mkOperatorTree(
   return tree;
 }
 
+AstOperator* GenParserExt::mkBinaryOperator(
+  AstOperator::EOperation op, AstObject* lhs, AstObject* rhs, Location loc) {
+  if (AstOperator::isNAry(op)) {
+    const auto lhsOp = dynamic_cast<AstOperator*>(lhs);
+    if (lhsOp && lhsOp->op() == op && lhsOp->args().childs().size() >= 2) {
+      lhsOp->args().Add(rhs);
+      return lhsOp;
+    }
+  }
+  return new AstOperator{op, lhs, rhs, move(loc)};
+}
+
 AstOperator* GenParserExt::mkOperatorTree(const string& op, AstObject* child1,
   AstObject* child2, AstObject* child3, AstObject* child4, AstObject* child5,
   AstObject* child6) {
@@ -144,3 +168,46 @@ AstFunDef* GenParserExt::mkMainFunDef(AstObject* body) {
   return mkFunDef("main", new AstObjTypeSymbol{ObjTypeFunda::eInt, Location{}},
     body, Location{});
 }
+
+AstObjTypeSimd* GenParserExt::mkSimdType(GeneralValue laneCnt,
+  ObjTypeFunda::EType laneCntType, AstObjType* element, Location loc) {
+  if (laneCntType != ObjTypeFunda::eInt) {
+    ostringstream ss;
+    ss << laneCnt;
+    Error::throwError(
+      m_errorHandler, Error::eInvalidSimdLaneCount, loc, ss.str());
+  }
+  return new AstObjTypeSimd{static_cast<int>(laneCnt), element, move(loc)};
+}
+
+AstObjTypeArray* GenParserExt::mkArrayType(GeneralValue elementCnt,
+  ObjTypeFunda::EType elementCntType, AstObjType* element, Location loc) {
+  if (elementCntType != ObjTypeFunda::eInt) {
+    ostringstream ss;
+    ss << elementCnt;
+    Error::throwError(m_errorHandler, Error::eInvalidArraySize, loc, ss.str());
+  }
+  return new AstObjTypeArray{static_cast<int>(elementCnt), element, move(loc)};
+}
+
+void GenParserExt::addLoopHint(
+  LoopHints& hints, const string& name, Location loc) {
+  if (name != "independent") {
+    Error::throwError(m_errorHandler, Error::eInvalidLoopHint, loc, name);
+  }
+  hints.m_isIndependent = true;
+}
+
+void GenParserExt::addLoopHint(LoopHints& hints, const string& name,
+  GeneralValue value, ObjTypeFunda::EType valueType, Location loc) {
+  int* count = name == "vectorize" ? &hints.m_vectorizeWidth
+    : name == "interleave"         ? &hints.m_interleaveCount
+    : name == "unroll"             ? &hints.m_unrollCount
+                                   : nullptr;
+  if (!count || valueType != ObjTypeFunda::eInt || value <= 0) {
+    ostringstream ss;
+    ss << name << "=" << value;
+    Error::throwError(m_errorHandler, Error::eInvalidLoopHint, loc, ss.str());
+  }
+  *count = static_cast<int>(value);
+}
@@ -11,9 +11,12 @@ GenParser implementation extension. Has two related responsibilities:
    AST. Currently the design is that it is intentionally left open who is
    responsible for what, so that responsibilities can easily be moved between
    the two until the design is more stable.*/
+#include "ast.h"
 #include "astforwards.h"
 #include "declutils.h"
+#include "generalvalue.h"
 #include "location.h"
+#include "loophints.h"
 #include "objtype.h"
 #include "storageduration.h"
 
@@ -54,6 +57,11 @@ public:
 
   AstOperator* mkOperatorTree(
     const std::string& op, AstCtList* args, Location loc = s_nullLoc);
+  /** Returns lhs op rhs. If op is n-ary, see AstOperator::isNAry, and lhs is a
+  non-unary AstOperator of the same op, rhs is appended to lhs's args and lhs
+  is returned, so a chain like a+b+c becomes a single AstOperator. */
+  AstOperator* mkBinaryOperator(AstOperator::EOperation op, AstObject* lhs,
+    AstObject* rhs, Location loc = s_nullLoc);
   AstOperator* mkOperatorTree(const std::string& op, AstObject* child1,
     AstObject* child2, AstObject* child3 = nullptr, AstObject* child4 = nullptr,
     AstObject* child5 = nullptr, AstObject* child6 = nullptr);
@@ -70,6 +78,27 @@ public:
 
   AstFunDef* mkMainFunDef(AstObject* body);
 
+  /** laneCnt and laneCntType are the value and the type of the literal number
+  denoting the lane count. */
+  AstObjTypeSimd* mkSimdType(GeneralValue laneCnt,
+    ObjTypeFunda::EType laneCntType, AstObjType* element,
+    Location loc = s_nullLoc);
+
+  /** elementCnt and elementCntType are the value and the type of the literal
+  number denoting the number of elements. */
+  AstObjTypeArray* mkArrayType(GeneralValue elementCnt,
+    ObjTypeFunda::EType elementCntType, AstObjType* element,
+    Location loc = s_nullLoc);
+
+  /** Adds the loop hint without value with the given name to hints */
+  void addLoopHint(
+    LoopHints& hints, const std::string& name, Location loc = s_nullLoc);
+  /** Adds the loop hint name=value to hints. value and valueType are the
+  value and the type of the literal number. */
+  void addLoopHint(LoopHints& hints, const std::string& name,
+    GeneralValue value, ObjTypeFunda::EType valueType,
+    Location loc = s_nullLoc);
+
   ErrorHandler& errorHandler() { return m_errorHandler; }
 
 private:
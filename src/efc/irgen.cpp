@@ -4,8 +4,11 @@
 #include "errorhandler.h"
 #include "irgenforwarddeclarator.h"
 
+#include "llvm/Analysis/VectorUtils.h"
 #include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/Intrinsics.h"
 #include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/MDBuilder.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/Value.h"
 #include "llvm/IR/Verifier.h"
@@ -30,8 +33,10 @@ void IrGen::staticOneTimeInit() {
   InitializeNativeTargetAsmParser();
 }
 
-IrGen::IrGen(ErrorHandler& errorHandler)
-  : m_builder{llvmContext}, m_errorHandler{errorHandler} {
+IrGen::Options::Options() = default;
+
+IrGen::IrGen(ErrorHandler& errorHandler, const Options& options)
+  : m_builder{llvmContext}, m_errorHandler{errorHandler}, m_options{options} {
 }
 
 /** Using the given AST, generates LLVM IR code, appending it to the one
@@ -40,11 +45,13 @@ the AST, only declarations or definitions are allowed.
 \pre SemanticAnalizer must have massaged the AST and the Env */
 unique_ptr<Module> IrGen::genIr(AstNode& root) {
   m_module = std::make_unique<Module>("Main", llvmContext);
+  m_irParts = Object_IrParts{};
 
-  IrGenForwardDeclarator{m_errorHandler, *m_module}(root);
+  IrGenForwardDeclarator{m_errorHandler, *m_module, m_irParts}(root);
 
-  root.accept(*this);
+  dispatch(root);
 
+  if (!m_options.m_isVerifyEnabled) { return move(m_module); }
   stringstream ss{};
   llvm::raw_os_ostream llvmss{ss};
   if (verifyModule(*m_module, &llvmss)) {
@@ -59,8 +66,8 @@ unique_ptr<Module> IrGen::genIr(AstNode& root) {
 }
 
 llvm::Value* IrGen::callAcceptOn(AstObject& node) {
-  node.accept(*this);
-  return node.ir().irValueOfIrObject(m_builder);
+  dispatch(node);
+  return ir(node).irValueOfIrObject(m_builder);
 }
 
 void IrGen::visit(AstNop& nop) {
@@ -77,14 +84,33 @@ void IrGen::visit(AstCast& cast) {
   assert(childIr);
   llvm::Value* irResult = nullptr;
 
+  // Construction of a simd object: either a copy of another simd object, or a
+  // splat of a single element to all lanes.
+  const auto newSimdType =
+    dynamic_cast<const ObjTypeSimd*>(cast.objType().unqualifiedObjType().get());
+  if (newSimdType) {
+    const auto& oldtype = cast.args().childs().front()->objType();
+    if (newSimdType->matchesExceptQualifiers(oldtype)) {
+      irResult = childIr; // i.e. a nop
+    }
+    else {
+      irResult =
+        m_builder.CreateVectorSplat(newSimdType->laneCnt(), childIr, "splat");
+    }
+    allocateAndInitLocalIrObjectFor(cast, irResult, "splat");
+    return;
+  }
+
   // At this point, AstCast is always between fundamental types
   const auto& oldtype =
     dynamic_cast<const ObjTypeFunda&>(cast.args().childs().front()->objType());
   const auto& newtype = dynamic_cast<const ObjTypeFunda&>(cast.objType());
   auto oldsize = oldtype.size();
   auto newsize = newtype.size();
-  const auto irValueName =
-    childIr->getName().str() + "_as_" + newtype.completeName();
+  // Discarded names are not even built
+  const auto irValueName = llvmContext.shouldDiscardValueNames()
+    ? string{}
+    : childIr->getName().str() + "_as_" + newtype.completeName();
 
   // unity conversion
   if (newtype.type() == oldtype.type()) {
@@ -100,62 +126,59 @@ void IrGen::visit(AstCast& cast) {
     }
     // to bool
     else if (newsize == 1) {
-      assert(oldsize == 32);
-      irResult = m_builder.CreateICmpNE(
-        childIr, ConstantInt::get(llvmContext, APInt(oldsize, 0)), irValueName);
+      irResult = m_builder.CreateICmpNE(childIr,
+        ConstantInt::get(oldtype.llvmType(), 0), irValueName);
     }
-    // between non-bool integrals, smaller -> larger
+    // between non-bool integrals, smaller -> larger. Note that char is
+    // unsigned.
     else if (oldsize < newsize) {
-      assert(oldsize == 8); // implies char, which implies unsigned
-      assert(newsize == 32); //  implies int, which implies signed
-      irResult = m_builder.CreateZExt(childIr, newtype.llvmType(), irValueName);
+      irResult = oldtype.is(ObjType::eSigned)
+        ? m_builder.CreateSExt(childIr, newtype.llvmType(), irValueName)
+        : m_builder.CreateZExt(childIr, newtype.llvmType(), irValueName);
     }
     // between non-bool integrals, larger -> smaller
-    else {
-      assert(oldsize == 32); //  implies int, which implies signed
-      assert(newsize == 8); // implies char, which implies unsigned
+    else if (oldsize > newsize) {
       irResult =
         m_builder.CreateTrunc(childIr, newtype.llvmType(), irValueName);
     }
+    // between non-bool integrals of same size, only signedness differs, which
+    // is not a property of LLVM types
+    else {
+      irResult = childIr; // i.e. a nop
+    }
   }
 
-  // eStoredAsIntegral -> double
+  // eStoredAsIntegral -> floating point
   else if (oldtype.is(ObjType::eStoredAsIntegral) &&
-    newtype.type() == ObjTypeFunda::eDouble) {
-    // unsigned types: bool, char
-    if (oldsize == 1 || oldsize == 8) {
-      irResult =
-        m_builder.CreateUIToFP(childIr, newtype.llvmType(), irValueName);
-    }
-    // signed types: int
-    else {
-      assert(oldsize == 32);
-      irResult =
-        m_builder.CreateSIToFP(childIr, newtype.llvmType(), irValueName);
-    }
+    newtype.is(ObjType::eFloatingPoint)) {
+    irResult = oldtype.is(ObjType::eSigned)
+      ? m_builder.CreateSIToFP(childIr, newtype.llvmType(), irValueName)
+      : m_builder.CreateUIToFP(childIr, newtype.llvmType(), irValueName);
   }
 
-  // double -> eStoredAsIntegral
-  else if (oldtype.type() == ObjTypeFunda::eDouble &&
+  // floating point -> eStoredAsIntegral
+  else if (oldtype.is(ObjType::eFloatingPoint) &&
     newtype.is(ObjType::eStoredAsIntegral)) {
     // bool
     if (newsize == 1) {
       irResult = m_builder.CreateFCmpONE(
-        childIr, ConstantFP::get(llvmContext, APFloat(0.0)), irValueName);
-    }
-    // unsigned types: char
-    else if (newsize == 8) {
-      irResult =
-        m_builder.CreateFPToUI(childIr, newtype.llvmType(), irValueName);
+        childIr, ConstantFP::get(oldtype.llvmType(), 0.0), irValueName);
     }
-    // signed types: int
     else {
-      assert(newsize == 32);
-      irResult =
-        m_builder.CreateFPToSI(childIr, newtype.llvmType(), irValueName);
+      irResult = newtype.is(ObjType::eSigned)
+        ? m_builder.CreateFPToSI(childIr, newtype.llvmType(), irValueName)
+        : m_builder.CreateFPToUI(childIr, newtype.llvmType(), irValueName);
     }
   }
 
+  // floating point <-> floating point
+  else if (oldtype.is(ObjType::eFloatingPoint) &&
+    newtype.is(ObjType::eFloatingPoint)) {
+    irResult = oldsize < newsize
+      ? m_builder.CreateFPExt(childIr, newtype.llvmType(), irValueName)
+      : m_builder.CreateFPTrunc(childIr, newtype.llvmType(), irValueName);
+  }
+
   // invaid casts should be catched by semantic analizer
   else {
     assert(false);
@@ -177,60 +200,146 @@ void IrGen::visit(AstOperator& op) {
     llvmResult = m_builder.CreateNot(callAcceptOn(*astOperands.front()), "not");
   }
   else if (op.op() == AstOperator::eAddrOf) {
-    astOperands.front()->accept(*this);
-    llvmResult = astOperands.front()->ir().irAddrOfIrObject();
+    dispatch(*astOperands.front());
+    llvmResult = ir(*astOperands.front()).irAddrOfIrObject();
   }
   else if (op.op() == AstOperator::eDeref) {
-    op.ir().setAddrOfIrObject(
+    ir(op).setAddrOfIrObject(
       callAcceptOn(*astOperands.front()), EInitStatus::eInitialized);
   }
+  else if (op.op() == AstOperator::eIndex) {
+    auto& array = *astOperands.front();
+    const auto& arrayObjType =
+      static_cast<const ObjTypeArray&>(*array.objType().unqualifiedObjType());
+    dispatch(array);
+    auto llvmIndex = callAcceptOn(*astOperands.back());
+
+    // The unsigned comparison also catches negative indices
+    if (m_options.m_isBoundsCheckEnabled && !op.isIndexProvablyInRange()) {
+      Function* functionIr = m_builder.GetInsertBlock()->getParent();
+      BasicBlock* outOfBoundsBB =
+        BasicBlock::Create(llvmContext, "out_of_bounds", functionIr);
+      BasicBlock* inBoundsBB =
+        BasicBlock::Create(llvmContext, "in_bounds", functionIr);
+      auto llvmIsInBounds = m_builder.CreateICmpULT(llvmIndex,
+        m_builder.getInt32(arrayObjType.elementCnt()), "is_in_bounds");
+      m_builder.CreateCondBr(llvmIsInBounds, inBoundsBB, outOfBoundsBB);
+
+      m_builder.SetInsertPoint(outOfBoundsBB);
+      m_builder.CreateCall(
+        Intrinsic::getDeclaration(m_module.get(), Intrinsic::trap));
+      m_builder.CreateUnreachable();
+
+      m_builder.SetInsertPoint(inBoundsBB);
+    }
 
-  // binary logical short circuit operators
-  else if (op.isBinaryLogicalShortCircuit()) {
-    const auto opname =
-      op.op() == AstOperator::eAnd ? string{"and"} : string{"or"};
-    Function* functionIr = m_builder.GetInsertBlock()->getParent();
-    BasicBlock* rhsBB = BasicBlock::Create(llvmContext, opname + "_rhs");
-    BasicBlock* mergeBB = BasicBlock::Create(llvmContext, opname + "_merge");
+    ir(op).setAddrOfIrObject(
+      m_builder.CreateInBoundsGEP(arrayObjType.llvmType(),
+        ir(array).irAddrOfIrObject(), {m_builder.getInt32(0), llvmIndex},
+        "element"),
+      EInitStatus::eInitialized);
+  }
 
-    // current/lhs BB:
-    auto llvmLhs = callAcceptOn(*astOperands.front());
-    assert(llvmLhs);
-    if (op.op() == AstOperator::eAnd) {
-      m_builder.CreateCondBr(llvmLhs, rhsBB, mergeBB);
+  // simd operators
+  else if (op.class_() == AstOperator::eSimd) {
+    const auto& simdObjType = astOperands.front()->objType();
+    auto llvmSimd = callAcceptOn(*astOperands.front());
+    switch (op.op()) {
+    case AstOperator::eLane: {
+      auto llvmIndex = callAcceptOn(*astOperands.at(1));
+      llvmResult = m_builder.CreateExtractElement(llvmSimd, llvmIndex, "lane");
+      break;
     }
-    else if (op.op() == AstOperator::eOr) {
-      m_builder.CreateCondBr(llvmLhs, mergeBB, rhsBB);
+    case AstOperator::eWithLane: {
+      auto llvmIndex = callAcceptOn(*astOperands.at(1));
+      auto llvmValue = callAcceptOn(*astOperands.back());
+      llvmResult = m_builder.CreateInsertElement(
+        llvmSimd, llvmValue, llvmIndex, "withlane");
+      break;
     }
-    else {
-      assert(false);
+    case AstOperator::eHAdd:
+      if (simdObjType.is(ObjType::eStoredAsIntegral)) {
+        llvmResult = m_builder.CreateAddReduce(llvmSimd);
+      }
+      else {
+        const auto llvmNegZero = ConstantFP::getNegativeZero(
+          cast<VectorType>(llvmSimd->getType())->getElementType());
+        llvmResult = m_builder.CreateFAddReduce(llvmNegZero, llvmSimd);
+      }
+      break;
+    case AstOperator::eHMul:
+      if (simdObjType.is(ObjType::eStoredAsIntegral)) {
+        llvmResult = m_builder.CreateMulReduce(llvmSimd);
+      }
+      else {
+        const auto llvmOne = ConstantFP::get(
+          cast<VectorType>(llvmSimd->getType())->getElementType(), 1.0);
+        llvmResult = m_builder.CreateFMulReduce(llvmOne, llvmSimd);
+      }
+      break;
+    default: assert(false);
     }
-    BasicBlock* lhsLastBB = m_builder.GetInsertBlock();
+  }
 
-    // rhsBB:
-    functionIr->getBasicBlockList().push_back(rhsBB);
-    m_builder.SetInsertPoint(rhsBB);
-    auto llvmRhs = callAcceptOn(*astOperands.back());
+  // logical short circuit operators. The operands are evaluated left to right
+  // until the result is known.
+  else if (op.isLogicalShortCircuit()) {
+    const auto isAnd = op.op() == AstOperator::eAnd;
+    const auto opname = isAnd ? "and" : "or";
+    Function* functionIr = m_builder.GetInsertBlock()->getParent();
+    BasicBlock* mergeBB =
+      BasicBlock::Create(llvmContext, Twine{opname} + "_merge");
+    // The values of the operands, and the current SSA values, flowing into
+    // mergeBB
+    vector<pair<BasicBlock*, Value*>> incomings;
+    vector<pair<BasicBlock*, vector<Value*>>> ssaIncomings;
+
+    // current/lhs BB:
+    auto llvmOperand = callAcceptOn(*astOperands.front());
+    assert(llvmOperand);
+    const auto ssaCnt = m_mutableSSAObjects.size();
+    for (auto astRhs = next(astOperands.begin()); astRhs != astOperands.end();
+         ++astRhs) {
+      BasicBlock* rhsBB =
+        BasicBlock::Create(llvmContext, Twine{opname} + "_rhs");
+      if (isAnd) { m_builder.CreateCondBr(llvmOperand, rhsBB, mergeBB); }
+      else {
+        m_builder.CreateCondBr(llvmOperand, mergeBB, rhsBB);
+      }
+      incomings.emplace_back(m_builder.GetInsertBlock(), llvmOperand);
+      ssaIncomings.emplace_back(
+        m_builder.GetInsertBlock(), currentSSAValues(ssaCnt));
+
+      // rhsBB:
+      functionIr->getBasicBlockList().push_back(rhsBB);
+      m_builder.SetInsertPoint(rhsBB);
+      llvmOperand = callAcceptOn(**astRhs);
+      assert(llvmOperand);
+    }
     m_builder.CreateBr(mergeBB);
-    BasicBlock* rhsLastBB = m_builder.GetInsertBlock();
+    incomings.emplace_back(m_builder.GetInsertBlock(), llvmOperand);
+    ssaIncomings.emplace_back(
+      m_builder.GetInsertBlock(), currentSSAValues(ssaCnt));
 
     // mergeBB:
     functionIr->getBasicBlockList().push_back(mergeBB);
     m_builder.SetInsertPoint(mergeBB);
-    PHINode* phi = m_builder.CreatePHI(Type::getInt1Ty(llvmContext), 2, opname);
+    mergeSSAValues(ssaIncomings);
+    PHINode* phi = m_builder.CreatePHI(
+      Type::getInt1Ty(llvmContext), incomings.size(), opname);
     assert(phi);
-    phi->addIncoming(llvmLhs, lhsLastBB);
-    phi->addIncoming(llvmRhs, rhsLastBB);
+    for (const auto& incoming : incomings) {
+      phi->addIncoming(incoming.second, incoming.first);
+    }
     llvmResult = phi;
   }
 
   // assignment operators
   else if (op.op() == AstOperator::eAssign ||
     op.op() == AstOperator::eVoidAssign) {
-    astOperands.front()->accept(*this);
+    dispatch(*astOperands.front());
     auto llvmRhs = callAcceptOn(*astOperands.back());
-    m_builder.CreateStore(
-      llvmRhs, astOperands.front()->ir().irAddrOfIrObject());
+    ir(*astOperands.front()).setIrValueOfIrObject(llvmRhs, m_builder);
     if (op.op() == AstOperator::eVoidAssign) {
       llvmResult = m_abstractObject; // void
     }
@@ -240,35 +349,97 @@ void IrGen::visit(AstOperator& op) {
     }
   }
 
-  // binary arithmetic operators
-  else if (astOperands.size() == 2) {
+  // unary bitwise operators, lowered to the respective LLVM intrinsics
+  else if (op.class_() == AstOperator::eBitwise && astOperands.size() == 1) {
+    auto llvmOperand = callAcceptOn(*astOperands.front());
+    switch (op.op()) {
+    case AstOperator::eCtpop:
+      llvmResult = m_builder.CreateUnaryIntrinsic(Intrinsic::ctpop, llvmOperand);
+      break;
+    // The 2nd argument being false defines the result for a zero operand to
+    // be the bit width
+    case AstOperator::eCtlz:
+      llvmResult = m_builder.CreateBinaryIntrinsic(
+        Intrinsic::ctlz, llvmOperand, m_builder.getFalse());
+      break;
+    case AstOperator::eCttz:
+      llvmResult = m_builder.CreateBinaryIntrinsic(
+        Intrinsic::cttz, llvmOperand, m_builder.getFalse());
+      break;
+    case AstOperator::eBswap:
+      llvmResult = m_builder.CreateUnaryIntrinsic(Intrinsic::bswap, llvmOperand);
+      break;
+    default: assert(false);
+    }
+  }
+
+  // binary arithmetic and bitwise operators, and n-ary arithmetic operators,
+  // see AstOperator::isNAry, whose operands are combined left to right
+  else if (astOperands.size() >= 2) {
     auto llvmLhs = callAcceptOn(*astOperands.front());
-    auto llvmRhs = callAcceptOn(*astOperands.back());
-    if (astOperands.front()->objType().is(ObjType::eStoredAsIntegral)) {
-      switch (op.op()) {
-        // clang-format off
-      case AstOperator::eSub      : llvmResult = m_builder.CreateSub   (llvmLhs, llvmRhs, "sub"); break;
-      case AstOperator::eAdd      : llvmResult = m_builder.CreateAdd   (llvmLhs, llvmRhs, "add"); break;
-      case AstOperator::eMul      : llvmResult = m_builder.CreateMul   (llvmLhs, llvmRhs, "mul"); break;
-      case AstOperator::eDiv      : llvmResult = m_builder.CreateSDiv  (llvmLhs, llvmRhs, "div"); break;
-      case AstOperator::eEqualTo  : llvmResult = m_builder.CreateICmpEQ(llvmLhs, llvmRhs, "cmp"); break;
-      default: assert(false);
-        // clang-format on
+    for (auto astRhs = next(astOperands.begin()); astRhs != astOperands.end();
+         ++astRhs) {
+      auto llvmRhs = callAcceptOn(**astRhs);
+      if (astOperands.front()->objType().is(ObjType::eStoredAsIntegral)) {
+        // Note that e.g. char, bool and pointers are unsigned
+        const auto isSigned =
+          astOperands.front()->objType().is(ObjType::eSigned);
+        switch (op.op()) {
+          // clang-format off
+        case AstOperator::eSub      : llvmResult = m_builder.CreateSub   (llvmLhs, llvmRhs, "sub"); break;
+        case AstOperator::eAdd      : llvmResult = m_builder.CreateAdd   (llvmLhs, llvmRhs, "add"); break;
+        case AstOperator::eMul      : llvmResult = m_builder.CreateMul   (llvmLhs, llvmRhs, "mul"); break;
+        case AstOperator::eDiv      :
+          llvmResult = isSigned
+            ? m_builder.CreateSDiv(llvmLhs, llvmRhs, "div")
+            : m_builder.CreateUDiv(llvmLhs, llvmRhs, "div");
+          break;
+        case AstOperator::eEqualTo  : llvmResult = m_builder.CreateICmpEQ(llvmLhs, llvmRhs, "cmp"); break;
+        case AstOperator::eBitAnd   : llvmResult = m_builder.CreateAnd   (llvmLhs, llvmRhs, "bitand"); break;
+        case AstOperator::eBitOr    : llvmResult = m_builder.CreateOr    (llvmLhs, llvmRhs, "bitor"); break;
+        case AstOperator::eXor      : llvmResult = m_builder.CreateXor   (llvmLhs, llvmRhs, "xor"); break;
+        case AstOperator::eShl      :
+        case AstOperator::eShr      : {
+          // The shift amount is taken modulo the bit width, since LLVM's result
+          // would be poison for amounts greater or equal the bit width
+          const auto bitWidth = llvmLhs->getType()->getScalarSizeInBits();
+          const auto llvmAmount = m_builder.CreateAnd(llvmRhs,
+            ConstantInt::get(llvmRhs->getType(), bitWidth - 1), "amount");
+          if (op.op() == AstOperator::eShl) {
+            llvmResult = m_builder.CreateShl(llvmLhs, llvmAmount, "shl");
+          }
+          else {
+            llvmResult = isSigned
+              ? m_builder.CreateAShr(llvmLhs, llvmAmount, "shr")
+              : m_builder.CreateLShr(llvmLhs, llvmAmount, "shr");
+          }
+          break;
+        }
+        case AstOperator::eLess     :
+          llvmResult = isSigned
+            ? m_builder.CreateICmpSLT(llvmLhs, llvmRhs, "cmp")
+            : m_builder.CreateICmpULT(llvmLhs, llvmRhs, "cmp");
+          break;
+        default: assert(false);
+          // clang-format on
+        }
       }
-    }
-    else {
-      switch (op.op()) {
-        // clang-format off
-      case AstOperator::eSub      : llvmResult = m_builder.CreateFSub   (llvmLhs, llvmRhs, "fsub"); break;
-      case AstOperator::eAdd      : llvmResult = m_builder.CreateFAdd   (llvmLhs, llvmRhs, "add"); break;
-      case AstOperator::eMul      : llvmResult = m_builder.CreateFMul   (llvmLhs, llvmRhs, "mul"); break;
-      case AstOperator::eDiv      : llvmResult = m_builder.CreateFDiv   (llvmLhs, llvmRhs, "div"); break;
-      case AstOperator::eEqualTo  : llvmResult = m_builder.CreateFCmpOEQ(llvmLhs, llvmRhs, "cmp"); break;
-      default: assert(false);
-        // clang-format on
+      else {
+        switch (op.op()) {
+          // clang-format off
+        case AstOperator::eSub      : llvmResult = m_builder.CreateFSub   (llvmLhs, llvmRhs, "fsub"); break;
+        case AstOperator::eAdd      : llvmResult = m_builder.CreateFAdd   (llvmLhs, llvmRhs, "add"); break;
+        case AstOperator::eMul      : llvmResult = m_builder.CreateFMul   (llvmLhs, llvmRhs, "mul"); break;
+        case AstOperator::eDiv      : llvmResult = m_builder.CreateFDiv   (llvmLhs, llvmRhs, "div"); break;
+        case AstOperator::eEqualTo  : llvmResult = m_builder.CreateFCmpOEQ(llvmLhs, llvmRhs, "cmp"); break;
+        case AstOperator::eLess     : llvmResult = m_builder.CreateFCmpOLT(llvmLhs, llvmRhs, "cmp"); break;
+        default: assert(false);
+          // clang-format on
+        }
       }
+      assert(llvmResult);
+      llvmLhs = llvmResult;
     }
-    assert(llvmResult);
   }
 
   // unary arithmetic operators
@@ -279,7 +450,7 @@ void IrGen::visit(AstOperator& op) {
     auto llvmOperand = callAcceptOn(*operand);
 
     if (objType.is(ObjType::eStoredAsIntegral)) {
-      auto llvmZero = ConstantInt::get(llvmContext, APInt(objType.size(), 0));
+      auto llvmZero = Constant::getNullValue(objType.llvmType());
       switch (op.op()) {
       case '-':
         llvmResult = m_builder.CreateSub(llvmZero, llvmOperand, "neg");
@@ -289,7 +460,7 @@ void IrGen::visit(AstOperator& op) {
       }
     }
     else {
-      auto llvmZero = ConstantFP::get(llvmContext, APFloat(0.0));
+      auto llvmZero = Constant::getNullValue(objType.llvmType());
       switch (op.op()) {
       case '-':
         llvmResult = m_builder.CreateFSub(llvmZero, llvmOperand, "fneg");
@@ -308,7 +479,7 @@ void IrGen::visit(AstSeq& seq) {
   // evaluate all operands, but ignore all results but the result of the
   // last operand. seq.object() is the same as seq.operands.last().object(), so
   // 'returning the result' is a nop.
-  for (const auto& op : seq.operands()) { op->accept(*this); }
+  for (const auto& op : seq.operands()) { dispatch(*op); }
 }
 
 void IrGen::visit(AstNumber& number) {
@@ -324,33 +495,60 @@ void IrGen::visit(AstSymbol& symbol) {
 
 void IrGen::visit(AstFunDef& funDef) {
   const auto functionIr =
-    static_cast<llvm::Function*>(funDef.ir().irAddrOfIrObject());
+    static_cast<llvm::Function*>(ir(funDef).irAddrOfIrObject());
   assert(functionIr);
+  // The forward declaration is all there is, the host defines the function
+  if (funDef.isHostFunction()) { return; }
 
   if (m_builder.GetInsertBlock()) {
     m_BasicBlockStack.push(m_builder.GetInsertBlock());
   }
   m_builder.SetInsertPoint(
     BasicBlock::Create(llvmContext, "entry", functionIr));
+  auto outerMutableSSAObjects = move(m_mutableSSAObjects);
+  m_mutableSSAObjects.clear();
 
   // Add all arguments to the symbol table and create their allocas. Also tell
-  // llvm the name of each arg.
+  // llvm the name of each arg. The sret parameter has no counterpart in the
+  // AST, see createRet.
   Function::arg_iterator llvmArgIter = functionIr->arg_begin();
+  if (functionIr->hasStructRetAttr()) {
+    llvmArgIter->setName("sret");
+    ++llvmArgIter;
+  }
   auto astArgIter = funDef.declaredArgs().cbegin();
   for (/*nop*/; llvmArgIter != functionIr->arg_end();
        ++llvmArgIter, ++astArgIter) {
-    allocateAndInitLocalIrObjectFor(
-      **astArgIter, llvmArgIter, (*astArgIter)->name());
-    llvmArgIter->setName((*astArgIter)->name());
+    auto& astArg = **astArgIter;
+    llvmArgIter->setName(astArg.name());
+    if (!IrGenForwardDeclarator::isPassedByPointer(
+          astArg.objType(), m_module->getDataLayout())) {
+      allocateAndInitLocalIrObjectFor(astArg, llvmArgIter, astArg.name());
+    }
+    // The pointed-to immutable copy of the argument can directly be used as
+    // the parameter's IR object
+    else if (!ir(astArg).isSSAValue()) {
+      ir(astArg).setAddrOfIrObject(llvmArgIter, EInitStatus::eInitialized);
+    }
+    else {
+      allocateAndInitLocalIrObjectFor(astArg,
+        m_builder.CreateLoad(
+          astArg.objType().llvmType(), llvmArgIter, astArg.name()),
+        astArg.name());
+    }
   }
 
   Value* bodyVal = callAcceptOn(funDef.body());
   assert(bodyVal);
   if (funDef.body().objType().isVoid()) { m_builder.CreateRetVoid(); }
   else if (!funDef.body().objType().isNoreturn()) {
-    m_builder.CreateRet(bodyVal);
+    createRet(bodyVal);
+  }
+  if (m_options.m_isArenaAllocEnabled && funDef.fqName() == ".main") {
+    createArenaReleaseBeforeReturns(functionIr);
   }
 
+  m_mutableSSAObjects = move(outerMutableSSAObjects);
   if (!m_BasicBlockStack.empty()) {
     m_builder.SetInsertPoint(m_BasicBlockStack.top());
     m_BasicBlockStack.pop();
@@ -358,33 +556,195 @@ void IrGen::visit(AstFunDef& funDef) {
 }
 
 void IrGen::visit(AstFunCall& funCall) {
-  funCall.address().accept(*this);
+  if (funCall.builtin() != AstFunCall::eNoBuiltin) {
+    allocateAndInitLocalIrObjectFor(funCall, createBuiltinFunCall(funCall));
+    return;
+  }
+
+  dispatch(funCall.address());
   auto callee =
-    static_cast<Function*>(funCall.address().ir().irAddrOfIrObject());
+    static_cast<Function*>(ir(funCall.address()).irAddrOfIrObject());
   assert(callee);
 
   const auto& astArgs = funCall.args().childs();
+  const auto& objTypeFun =
+    dynamic_cast<const ObjTypeFun&>(funCall.address().objType());
+  const auto functionIr = m_builder.GetInsertBlock()->getParent();
 
+  // Whether memory of the caller's stack frame is passed to the callee, see
+  // IrGenForwardDeclarator::isPassedByPointer and isReturnedViaSret
+  auto isCallerMemoryPassed = false;
   vector<Value*> llvmArgs{};
+  AllocaInst* sretIr = nullptr;
+  if (IrGenForwardDeclarator::isReturnedViaSret(
+        objTypeFun.ret(), m_module->getDataLayout())) {
+    sretIr = createAllocaInEntryBlock(
+      functionIr, callee->getName(), objTypeFun.ret().llvmType());
+    llvmArgs.push_back(sretIr);
+    isCallerMemoryPassed = true;
+  }
+  auto paramObjTypeIter = objTypeFun.args().cbegin();
   for (const auto& astArg : astArgs) {
-    Value* llvmArg = callAcceptOn(*astArg);
-    assert(llvmArg);
-    llvmArgs.push_back(llvmArg);
+    const auto& paramObjType = **paramObjTypeIter++;
+    if (!IrGenForwardDeclarator::isPassedByPointer(
+          paramObjType, m_module->getDataLayout())) {
+      Value* llvmArg = callAcceptOn(*astArg);
+      assert(llvmArg);
+      llvmArgs.push_back(llvmArg);
+      continue;
+    }
+
+    // An immutable argument already residing in memory can be passed as it is,
+    // else it's copied to a temporary
+    dispatch(*astArg);
+    if (!ir(*astArg).isSSAValue() &&
+      !(astArg->objType().qualifiers() & ObjType::eMutable)) {
+      llvmArgs.push_back(ir(*astArg).irAddrOfIrObject());
+    }
+    else {
+      const auto copyIr = createAllocaInEntryBlock(
+        functionIr, "arg_copy", paramObjType.llvmType());
+      m_builder.CreateStore(ir(*astArg).irValueOfIrObject(m_builder), copyIr);
+      llvmArgs.push_back(copyIr);
+    }
+    isCallerMemoryPassed = true;
   }
 
-  const auto& objTypeFun =
-    dynamic_cast<const ObjTypeFun&>(funCall.address().objType());
   Value* llvmResult{};
-  if (objTypeFun.ret().isVoid()) {
-    m_builder.CreateCall(callee, llvmArgs);
+  CallInst* call{};
+  if (objTypeFun.ret().isVoid() || sretIr) {
+    call = m_builder.CreateCall(callee, llvmArgs);
     llvmResult = m_abstractObject;
   }
   else {
-    llvmResult = m_builder.CreateCall(callee, llvmArgs, callee->getName());
+    call = m_builder.CreateCall(callee, llvmArgs, callee->getName());
+    llvmResult = call;
+  }
+
+  // A tail call is only guaranteed to reuse the caller's stack frame via
+  // musttail, which requires the prototypes of caller and callee to be
+  // identical. Else tail is only a hint. Neither is allowed when the callee
+  // accesses the caller's stack frame.
+  if (funCall.isTailCall() && !isCallerMemoryPassed) {
+    const auto isMustTail =
+      callee->getFunctionType() == functionIr->getFunctionType() &&
+      !objTypeFun.ret().isNoreturn();
+    call->setTailCallKind(
+      isMustTail ? CallInst::TCK_MustTail : CallInst::TCK_Tail);
+    if (isMustTail) {
+      // musttail must be immediately followed by the return. The code the
+      // parent AST nodes generate after it is thus unreachable.
+      if (objTypeFun.ret().isVoid()) { m_builder.CreateRetVoid(); }
+      else {
+        m_builder.CreateRet(call);
+      }
+      m_builder.SetInsertPoint(
+        BasicBlock::Create(llvmContext, "after_tail_call", functionIr));
+    }
+  }
+
+  // The object returned via sret can directly be used as the IR object of
+  // the call
+  if (sretIr) {
+    if (!ir(funCall).isSSAValue()) {
+      ir(funCall).setAddrOfIrObject(sretIr, EInitStatus::eInitialized);
+      return;
+    }
+    llvmResult = m_builder.CreateLoad(
+      objTypeFun.ret().llvmType(), sretIr, callee->getName());
   }
   allocateAndInitLocalIrObjectFor(funCall, llvmResult);
 }
 
+void IrGen::createRet(Value* retVal) {
+  const auto functionIr = m_builder.GetInsertBlock()->getParent();
+  if (functionIr->hasStructRetAttr()) {
+    m_builder.CreateStore(retVal, functionIr->getArg(0));
+    m_builder.CreateRetVoid();
+  }
+  else {
+    m_builder.CreateRet(retVal);
+  }
+}
+
+Value* IrGen::createBuiltinFunCall(AstFunCall& funCall) {
+  vector<Value*> llvmArgs{};
+  for (const auto& astArg : funCall.args().childs()) {
+    llvmArgs.push_back(callAcceptOn(*astArg));
+  }
+  const auto& objType = funCall.objType();
+  const auto isFloatingPoint = objType.is(ObjType::eFloatingPoint);
+  const auto isSigned = objType.is(ObjType::eSigned);
+  switch (funCall.builtin()) {
+  case AstFunCall::eSqrt:
+    return m_builder.CreateUnaryIntrinsic(Intrinsic::sqrt, llvmArgs[0]);
+  case AstFunCall::eFma:
+    return m_builder.CreateIntrinsic(
+      Intrinsic::fma, {objType.llvmType()}, llvmArgs);
+  case AstFunCall::eFloor:
+    return m_builder.CreateUnaryIntrinsic(Intrinsic::floor, llvmArgs[0]);
+  case AstFunCall::eCeil:
+    return m_builder.CreateUnaryIntrinsic(Intrinsic::ceil, llvmArgs[0]);
+  case AstFunCall::eTrunc:
+    return m_builder.CreateUnaryIntrinsic(Intrinsic::trunc, llvmArgs[0]);
+  case AstFunCall::eRound:
+    return m_builder.CreateUnaryIntrinsic(Intrinsic::round, llvmArgs[0]);
+  case AstFunCall::eAbs:
+    if (isFloatingPoint) {
+      return m_builder.CreateUnaryIntrinsic(Intrinsic::fabs, llvmArgs[0]);
+    }
+    if (!isSigned) { return llvmArgs[0]; }
+    // The 2nd argument being false defines the absolute value of the minimal
+    // value to be the minimal value itself
+    return m_builder.CreateBinaryIntrinsic(
+      Intrinsic::abs, llvmArgs[0], m_builder.getFalse());
+  case AstFunCall::eMin:
+    return m_builder.CreateBinaryIntrinsic(isFloatingPoint ? Intrinsic::minnum
+        : isSigned                                         ? Intrinsic::smin
+                                                           : Intrinsic::umin,
+      llvmArgs[0], llvmArgs[1]);
+  case AstFunCall::eMax:
+    return m_builder.CreateBinaryIntrinsic(isFloatingPoint ? Intrinsic::maxnum
+        : isSigned                                         ? Intrinsic::smax
+                                                           : Intrinsic::umax,
+      llvmArgs[0], llvmArgs[1]);
+  case AstFunCall::eLikely:
+  case AstFunCall::eUnlikely:
+  case AstFunCall::eExpectTrips:
+    // the branch weights are attached by the if or while using the hint as
+    // condition, see branchWeightsOf
+    return llvmArgs[0];
+  case AstFunCall::eNoBuiltin: break;
+  }
+  assert(false);
+  return nullptr;
+}
+
+MDNode* IrGen::branchWeightsOf(const AstObject& cond) {
+  // same weights as clang uses for __builtin_expect
+  const uint32_t likelyBranchWeight = 2000;
+  const uint32_t unlikelyBranchWeight = 1;
+  const auto funCall = dynamic_cast<const AstFunCall*>(&cond);
+  if (!funCall) { return nullptr; }
+  MDBuilder mdBuilder{llvmContext};
+  switch (funCall->builtin()) {
+  case AstFunCall::eLikely:
+    return mdBuilder.createBranchWeights(
+      likelyBranchWeight, unlikelyBranchWeight);
+  case AstFunCall::eUnlikely:
+    return mdBuilder.createBranchWeights(
+      unlikelyBranchWeight, likelyBranchWeight);
+  case AstFunCall::eExpectTrips: {
+    // with a trip count of n, the condition is true n times and false once
+    const auto& tripCount =
+      dynamic_cast<const AstNumber&>(*funCall->args().childs().back());
+    return mdBuilder.createBranchWeights(
+      static_cast<uint32_t>(tripCount.value()), 1);
+  }
+  default: return nullptr;
+  }
+}
+
 void IrGen::visit(AstDataDef& dataDef) {
   // note that AstDataDef being function parameters are _not_ handled here but
   // in visit of AstFunDef
@@ -404,7 +764,7 @@ void IrGen::visit(AstDataDef& dataDef) {
 
   // allocate, if not allready done, and initialize.
   if (dataDef.storageDuration() == StorageDuration::eStatic) {
-    dataDef.ir().initializeIrObject(initObj, m_builder);
+    ir(dataDef).initializeIrObject(initObj, m_builder);
   }
   else if (dataDef.storageDuration() == StorageDuration::eLocal) {
     allocateAndInitLocalIrObjectFor(dataDef, initObj, dataDef.name());
@@ -418,18 +778,28 @@ void IrGen::visit(AstIf& if_) {
     BasicBlock::Create(llvmContext, "if_then", functionIr);
   BasicBlock* ElseFirstBB = BasicBlock::Create(llvmContext, "if_else");
   BasicBlock* MergeBB = BasicBlock::Create(llvmContext, "if_merge");
+  // The current SSA values of the branches flowing into mergeBB
+  vector<pair<BasicBlock*, vector<Value*>>> ssaIncomings;
 
   // current BB:
   Value* condIr = callAcceptOn(if_.condition());
   assert(condIr);
-  m_builder.CreateCondBr(condIr, ThenFirstBB, ElseFirstBB);
+  m_builder.CreateCondBr(
+    condIr, ThenFirstBB, ElseFirstBB, branchWeightsOf(if_.condition()));
+  const auto ssaCnt = m_mutableSSAObjects.size();
+  const auto condSSAValues = currentSSAValues(ssaCnt);
 
   // thenFirstBB:
   m_builder.SetInsertPoint(ThenFirstBB);
   Value* thenValue = callAcceptOn(if_.action());
   assert(thenValue);
-  if (!if_.action().objType().isNoreturn()) { m_builder.CreateBr(MergeBB); }
+  if (!if_.action().objType().isNoreturn()) {
+    m_builder.CreateBr(MergeBB);
+    ssaIncomings.emplace_back(
+      m_builder.GetInsertBlock(), currentSSAValues(ssaCnt));
+  }
   BasicBlock* ThenLastBB = m_builder.GetInsertBlock();
+  setCurrentSSAValues(condSSAValues);
 
   // elseFirstBB:
   functionIr->getBasicBlockList().push_back(ElseFirstBB);
@@ -440,18 +810,23 @@ void IrGen::visit(AstIf& if_) {
     assert(elseValue);
     if (!if_.elseAction()->objType().isNoreturn()) {
       m_builder.CreateBr(MergeBB);
+      ssaIncomings.emplace_back(
+        m_builder.GetInsertBlock(), currentSSAValues(ssaCnt));
     }
   }
   else {
     elseValue = m_abstractObject;
     m_builder.CreateBr(MergeBB);
+    ssaIncomings.emplace_back(m_builder.GetInsertBlock(), condSSAValues);
   }
   BasicBlock* ElseLastBB = m_builder.GetInsertBlock();
+  setCurrentSSAValues(condSSAValues);
 
   // mergeBB:
   // also sets IrValue of this AstIf
   functionIr->getBasicBlockList().push_back(MergeBB);
   m_builder.SetInsertPoint(MergeBB);
+  mergeSSAValues(ssaIncomings);
   if (thenValue != m_abstractObject && elseValue != m_abstractObject) {
     PHINode* phi = m_builder.CreatePHI(thenValue->getType(), 2, "if_phi");
     assert(phi);
@@ -470,22 +845,65 @@ void IrGen::visit(AstLoop& loop) {
   BasicBlock* condBB = BasicBlock::Create(llvmContext, "loop_cond");
   BasicBlock* bodyBB = BasicBlock::Create(llvmContext, "loop_body");
   BasicBlock* afterBB = BasicBlock::Create(llvmContext, "after_loop");
+  const auto ssaCnt = m_mutableSSAObjects.size();
 
   // current BB:
   m_builder.CreateBr(condBB);
+  BasicBlock* preheaderBB = m_builder.GetInsertBlock();
 
   // condBB:
+  // Which objects the loop modifies is only known after the loop has been
+  // generated. So each object gets a phi, and the redundant ones are removed
+  // afterwards.
   functionIr->getBasicBlockList().push_back(condBB);
   m_builder.SetInsertPoint(condBB);
+  vector<PHINode*> ssaPhis;
+  for (const auto& object : m_mutableSSAObjects) {
+    const auto value = ir(*object).irValueOfIrObject(m_builder);
+    const auto phi = m_builder.CreatePHI(value->getType(), 2, object->name());
+    phi->addIncoming(value, preheaderBB);
+    ir(*object).setIrValueOfIrObject(phi, m_builder);
+    ssaPhis.push_back(phi);
+  }
   Value* condIr = callAcceptOn(loop.condition());
   assert(condIr);
-  m_builder.CreateCondBr(condIr, bodyBB, afterBB);
+  m_builder.CreateCondBr(
+    condIr, bodyBB, afterBB, branchWeightsOf(loop.condition()));
+  auto afterSSAValues = currentSSAValues(ssaCnt);
 
   // bodyBB:
   functionIr->getBasicBlockList().push_back(bodyBB);
   m_builder.SetInsertPoint(bodyBB);
   callAcceptOn(loop.body());
-  if (!loop.body().objType().isNoreturn()) { m_builder.CreateBr(condBB); }
+  if (!loop.body().objType().isNoreturn()) {
+    const auto backEdgeSSAValues = currentSSAValues(ssaCnt);
+    for (size_t i = 0; i < ssaCnt; ++i) {
+      ssaPhis[i]->addIncoming(backEdgeSSAValues[i], m_builder.GetInsertBlock());
+    }
+    const auto backEdge = m_builder.CreateBr(condBB);
+    if (!loop.hints().isEmpty()) {
+      backEdge->setMetadata(
+        LLVMContext::MD_loop, createLoopMetadata(loop.hints(), condBB));
+    }
+  }
+
+  // Remove the phis of objects the loop doesn't modify. Removing one phi can
+  // make another one redundant, thus iterate until nothing changes anymore.
+  for (auto isChanged = true; isChanged; /*nop*/) {
+    isChanged = false;
+    for (auto& phi : ssaPhis) {
+      if (!phi) { continue; }
+      if (const auto value = phi->hasConstantValue()) {
+        phi->replaceAllUsesWith(value);
+        replace(afterSSAValues.begin(), afterSSAValues.end(),
+          static_cast<Value*>(phi), value);
+        phi->eraseFromParent();
+        phi = nullptr;
+        isChanged = true;
+      }
+    }
+  }
+  setCurrentSSAValues(afterSSAValues);
 
   // afterBB:
   functionIr->getBasicBlockList().push_back(afterBB);
@@ -495,6 +913,54 @@ void IrGen::visit(AstLoop& loop) {
   allocateAndInitLocalIrObjectFor(loop, m_abstractObject);
 }
 
+MDNode* IrGen::createLoopMetadata(
+  const LoopHints& hints, BasicBlock* loopFirstBB) {
+  // The first operand is a self reference, which makes the loop ID unique
+  vector<Metadata*> operands{nullptr};
+  const auto addHint = [&](const char* name, Constant* value) {
+    operands.push_back(MDNode::get(llvmContext,
+      {MDString::get(llvmContext, name), ConstantAsMetadata::get(value)}));
+  };
+  if (hints.m_vectorizeWidth) {
+    if (hints.m_vectorizeWidth > 1) {
+      addHint("llvm.loop.vectorize.enable", m_builder.getTrue());
+    }
+    addHint(
+      "llvm.loop.vectorize.width", m_builder.getInt32(hints.m_vectorizeWidth));
+  }
+  if (hints.m_interleaveCount) {
+    addHint("llvm.loop.interleave.count",
+      m_builder.getInt32(hints.m_interleaveCount));
+  }
+  if (hints.m_unrollCount) {
+    addHint(
+      "llvm.loop.unroll.count", m_builder.getInt32(hints.m_unrollCount));
+  }
+  if (hints.m_isIndependent) {
+    // All memory accesses of the loop, i.e. of the basic blocks from the
+    // loop's first up to the current one, are put into one access group which
+    // is declared to be free of loop carried dependencies. Accesses of an inner
+    // loop stay in the inner loop's access group too.
+    const auto accessGroup = MDNode::getDistinct(llvmContext, {});
+    const auto functionIr = loopFirstBB->getParent();
+    for (auto bb = loopFirstBB->getIterator(); bb != functionIr->end(); ++bb) {
+      for (auto& inst : *bb) {
+        if (inst.mayReadOrWriteMemory()) {
+          inst.setMetadata(LLVMContext::MD_access_group,
+            uniteAccessGroups(
+              inst.getMetadata(LLVMContext::MD_access_group), accessGroup));
+        }
+      }
+    }
+    operands.push_back(MDNode::get(llvmContext,
+      {MDString::get(llvmContext, "llvm.loop.parallel_accesses"),
+        accessGroup}));
+  }
+  const auto loopId = MDNode::getDistinct(llvmContext, operands);
+  loopId->replaceOperandWith(0, loopId);
+  return loopId;
+}
+
 void IrGen::visit(AstReturn& return_) {
   auto&& ctorArgs = return_.ctorArgs().childs();
   assert(ctorArgs.size() == 1U);
@@ -502,11 +968,57 @@ void IrGen::visit(AstReturn& return_) {
   assert(retVal);
   if (ctorArgs.front()->objType().isVoid()) { m_builder.CreateRetVoid(); }
   else {
-    m_builder.CreateRet(retVal);
+    createRet(retVal);
   }
   allocateAndInitLocalIrObjectFor(return_, m_abstractObject);
 }
 
+void IrGen::visit(AstRawNew& rawNew) {
+  const auto initIr = callAcceptOn(*rawNew.args().childs().front());
+  assert(initIr);
+  const auto newLlvmType = rawNew.specifiedAstObjType().objType().llvmType();
+  Value* ptrIr = nullptr;
+  if (rawNew.isStackPromoted()) {
+    const auto functionIr = m_builder.GetInsertBlock()->getParent();
+    ptrIr = createAllocaInEntryBlock(functionIr, "new", newLlvmType);
+  }
+  else {
+    const auto storageIr = m_builder.CreateCall(
+      runtimeFunction(
+        m_options.m_isArenaAllocEnabled ? "efrt_arena_alloc" : "efrt_alloc"),
+      {ConstantExpr::getSizeOf(newLlvmType)});
+    ptrIr = m_builder.CreatePointerCast(
+      storageIr, newLlvmType->getPointerTo(), "new");
+  }
+  m_builder.CreateStore(initIr, ptrIr);
+  allocateAndInitLocalIrObjectFor(rawNew, ptrIr, "new");
+}
+
+void IrGen::visit(AstRawDelete& rawDelete) {
+  const auto ptrIr = callAcceptOn(rawDelete.ptr());
+  assert(ptrIr);
+  if (!rawDelete.isStackPromoted() && !m_options.m_isArenaAllocEnabled) {
+    const auto& ptrObjType = static_cast<const ObjTypePtr&>(
+      *rawDelete.ptr().objType().unqualifiedObjType());
+    m_builder.CreateCall(runtimeFunction("efrt_free"),
+      {m_builder.CreatePointerCast(ptrIr, m_builder.getInt8PtrTy()),
+        ConstantExpr::getSizeOf(ptrObjType.pointee()->llvmType())});
+  }
+  allocateAndInitLocalIrObjectFor(rawDelete, m_abstractObject);
+}
+
+void IrGen::visit(AstMemberAccess& memberAccess) {
+  auto& obj = memberAccess.obj();
+  const auto& class_ =
+    static_cast<const ObjTypeCompound&>(*obj.objType().unqualifiedObjType());
+  dispatch(obj);
+  const auto memberIndex = class_.memberIndexOf(memberAccess.memberName());
+  ir(memberAccess).setAddrOfIrObject(
+    m_builder.CreateStructGEP(class_.llvmType(), ir(obj).irAddrOfIrObject(),
+      class_.fieldIndexOf(memberIndex), memberAccess.memberName()),
+    EInitStatus::eInitialized);
+}
+
 void IrGen::visit(AstObjTypeSymbol& symbol) {
   assert(false); // not yet implemented
 }
@@ -519,17 +1031,62 @@ void IrGen::visit(AstObjTypePtr& ptr) {
   assert(false); // not yet implemented
 }
 
-void IrGen::visit(AstClassDef& class_) {
+void IrGen::visit(AstObjTypeSimd& simd) {
   assert(false); // not yet implemented
 }
 
+void IrGen::visit(AstObjTypeArray& array) {
+  assert(false); // not yet implemented
+}
+
+void IrGen::visit(AstClassDef& class_) {
+  // nop - the class's LLVM type is created on demand by its ObjType
+}
+
+FunctionCallee IrGen::runtimeFunction(const string& name) {
+  const auto storageType = m_builder.getInt8PtrTy();
+  const auto sizeType = m_builder.getInt64Ty();
+  const auto voidType = m_builder.getVoidTy();
+  if (name == "efrt_alloc" || name == "efrt_arena_alloc") {
+    auto callee = m_module->getOrInsertFunction(
+      name, FunctionType::get(storageType, {sizeType}, false));
+    // Storage returned by the allocators aliases no other object
+    cast<Function>(callee.getCallee())->addRetAttr(Attribute::NoAlias);
+    return callee;
+  }
+  if (name == "efrt_free") {
+    return m_module->getOrInsertFunction(
+      name, FunctionType::get(voidType, {storageType, sizeType}, false));
+  }
+  assert(name == "efrt_arena_release");
+  return m_module->getOrInsertFunction(
+    name, FunctionType::get(voidType, false));
+}
+
+void IrGen::createArenaReleaseBeforeReturns(Function* functionIr) {
+  vector<ReturnInst*> returns;
+  for (auto& bb : *functionIr) {
+    if (const auto ret = dyn_cast<ReturnInst>(bb.getTerminator())) {
+      returns.push_back(ret);
+    }
+  }
+  for (const auto ret : returns) {
+    // A musttail call must directly precede the return, and the callee must
+    // not run after the release anyway, so it has to become an ordinary call.
+    if (const auto call = dyn_cast_or_null<CallInst>(ret->getPrevNode())) {
+      if (call->isMustTailCall()) { call->setTailCallKind(CallInst::TCK_None); }
+    }
+    CallInst::Create(runtimeFunction("efrt_arena_release"), "", ret);
+  }
+}
+
 void IrGen::allocateAndInitLocalIrObjectFor(
-  AstObject& astObject, Value* irInitializer, const string& name) {
-  if (!astObject.ir().isSSAValue()) {
+  AstObject& astObject, Value* irInitializer, const Twine& name) {
+  if (!ir(astObject).isSSAValue()) {
     const auto functionIr = m_builder.GetInsertBlock()->getParent();
     const auto addr = createAllocaInEntryBlock(
       functionIr, name, astObject.objType().llvmType());
-    astObject.ir().setAddrOfIrObject(addr);
+    ir(astObject).setAddrOfIrObject(addr);
   }
   else {
     // nop: the IR object is stored in an SSA value which will be defined in
@@ -537,15 +1094,60 @@ void IrGen::allocateAndInitLocalIrObjectFor(
     // Note that the name is ignored, i.e. the SSA value will not have the
     // name of the local, but the name as defined by the IR instruction having
     // defined the SSA value.
+    if (astObject.isModifiedOrRevealsAddr() &&
+      irInitializer != m_abstractObject) {
+      m_mutableSSAObjects.push_back(&astObject);
+    }
+  }
+  ir(astObject).initializeIrObject(irInitializer, m_builder);
+}
+
+vector<Value*> IrGen::currentSSAValues(size_t cnt) {
+  m_mutableSSAObjects.resize(cnt);
+  vector<Value*> values;
+  for (const auto& object : m_mutableSSAObjects) {
+    values.push_back(ir(*object).irValueOfIrObject(m_builder));
+  }
+  return values;
+}
+
+void IrGen::setCurrentSSAValues(const vector<Value*>& values) {
+  m_mutableSSAObjects.resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    ir(*m_mutableSSAObjects[i]).setIrValueOfIrObject(values[i], m_builder);
+  }
+}
+
+void IrGen::mergeSSAValues(
+  const vector<pair<BasicBlock*, vector<Value*>>>& incomings) {
+  // No incomings means the current basic block is unreachable
+  if (incomings.empty()) { return; }
+  const auto& firstValues = incomings.front().second;
+  vector<Value*> mergedValues;
+  for (size_t i = 0; i < firstValues.size(); ++i) {
+    const auto isSame = all_of(incomings.begin(), incomings.end(),
+      [&](const auto& incoming) {
+        return incoming.second[i] == firstValues[i];
+      });
+    if (isSame) {
+      mergedValues.push_back(firstValues[i]);
+      continue;
+    }
+    const auto phi = m_builder.CreatePHI(firstValues[i]->getType(),
+      incomings.size(), m_mutableSSAObjects[i]->name());
+    for (const auto& incoming : incomings) {
+      phi->addIncoming(incoming.second[i], incoming.first);
+    }
+    mergedValues.push_back(phi);
   }
-  astObject.ir().initializeIrObject(irInitializer, m_builder);
+  setCurrentSSAValues(mergedValues);
 }
 
 /** \internal We want allocas in the entry block to facilitate llvm's mem2reg
 pass.*/
 AllocaInst* IrGen::createAllocaInEntryBlock(
-  Function* functionIr, const string& varName, llvm::Type* type) {
+  Function* functionIr, const Twine& varName, llvm::Type* type) {
   IRBuilder<> irBuilder{
     &functionIr->getEntryBlock(), functionIr->getEntryBlock().begin()};
-  return irBuilder.CreateAlloca(type, nullptr, varName.c_str());
+  return irBuilder.CreateAlloca(type, nullptr, varName);
 }
@@ -1,7 +1,9 @@
 #pragma once
 #include "access.h"
 #include "astforwards.h"
-#include "astvisitor.h"
+#include "aststaticvisitor.h"
+#include "loophints.h"
+#include "object_irpart.h"
 #include "objtype.h"
 
 #include "llvm/IR/IRBuilder.h"
@@ -10,57 +12,125 @@
 #include <memory>
 #include <stack>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace llvm {
 class Module;
 class BasicBlock;
 }
 class ErrorHandler;
+class Object;
 
 /** IR Generator -- Generates LLVM intermediate representation from a given
 AST. */
-class IrGen : private AstVisitor {
+class IrGen : private AstStaticVisitor<IrGen> {
 public:
+  struct Options {
+    /** Defined out of line, so Options{} can be a default argument of IrGen's
+    constructor */
+    Options();
+
+    /** Whether index operators whose index is not provably in range trap at
+    run time when the index is out of the array's bounds. */
+    bool m_isBoundsCheckEnabled = true;
+    /** Whether raw_new allocates from the arena, in which case raw_delete is
+    a nop and the arena is released when .main returns. Else raw_new and
+    raw_delete use the pooled allocator. See runtime.h. */
+    bool m_isArenaAllocEnabled = false;
+    /** Whether genIr verifies the generated module. Without verification,
+    invalid IR, i.e. a bug in efc, is only noticed later by LLVM, if at all. */
+    bool m_isVerifyEnabled = true;
+  };
+
   static void staticOneTimeInit();
-  IrGen(ErrorHandler& errorHandler);
+  IrGen(ErrorHandler& errorHandler, const Options& options = Options{});
 
   std::unique_ptr<llvm::Module> genIr(AstNode& root);
 
 private:
+  friend class AstStaticVisitor<IrGen>;
   friend class TestingIrGen;
 
-  void visit(AstNop& nop) override;
-  void visit(AstBlock& block) override;
-  void visit(AstCast& cast) override;
-  void visit(AstCtList& ctList) override;
-  void visit(AstOperator& op) override;
-  void visit(AstSeq& seq) override;
-  void visit(AstNumber& number) override;
-  void visit(AstSymbol& symbol) override;
-  void visit(AstFunCall& funCall) override;
-  void visit(AstFunDef& funDef) override;
-  void visit(AstDataDef& dataDef) override;
-  void visit(AstIf& if_) override;
-  void visit(AstLoop& loop) override;
-  void visit(AstReturn& return_) override;
-  void visit(AstObjTypeSymbol& symbol) override;
-  void visit(AstObjTypeQuali& quali) override;
-  void visit(AstObjTypePtr& ptr) override;
-  void visit(AstClassDef& class_) override;
+  void visit(AstNop& nop);
+  void visit(AstBlock& block);
+  void visit(AstCast& cast);
+  void visit(AstCtList& ctList);
+  void visit(AstOperator& op);
+  void visit(AstSeq& seq);
+  void visit(AstNumber& number);
+  void visit(AstSymbol& symbol);
+  void visit(AstFunCall& funCall);
+  void visit(AstFunDef& funDef);
+  void visit(AstDataDef& dataDef);
+  void visit(AstIf& if_);
+  void visit(AstLoop& loop);
+  void visit(AstReturn& return_);
+  void visit(AstRawNew& rawNew);
+  void visit(AstRawDelete& rawDelete);
+  void visit(AstMemberAccess& memberAccess);
+  void visit(AstObjTypeSymbol& symbol);
+  void visit(AstObjTypeQuali& quali);
+  void visit(AstObjTypePtr& ptr);
+  void visit(AstObjTypeSimd& simd);
+  void visit(AstObjTypeArray& array);
+  void visit(AstClassDef& class_);
 
+  Object_IrPart ir(Object& obj) { return m_irParts[obj]; }
   llvm::Value* callAcceptOn(AstObject&);
+  llvm::Value* createBuiltinFunCall(AstFunCall& funCall);
+  /** Returns the branch weights for a conditional branch on the given
+  condition, or nullptr if the condition is not a branch hint */
+  static llvm::MDNode* branchWeightsOf(const AstObject& cond);
+  /** Returns the llvm.loop metadata for the loop starting at the given basic
+  block, which must extend up to the current basic block */
+  llvm::MDNode* createLoopMetadata(
+    const LoopHints& hints, llvm::BasicBlock* loopFirstBB);
+
+  /** Returns the declaration of the given function of the runtime library,
+  see runtime.h */
+  llvm::FunctionCallee runtimeFunction(const std::string& name);
+  /** Releases the arena before each return of the given function */
+  void createArenaReleaseBeforeReturns(llvm::Function* functionIr);
+
+  /** Returns the given value from the current function. If the function has
+  an sret parameter, the value is stored to it, see
+  IrGenForwardDeclarator::isReturnedViaSret. */
+  void createRet(llvm::Value* retVal);
+
+  /** Current IR values of the first cnt objects of m_mutableSSAObjects. The
+  objects beyond are dropped, they were defined within a branch or a loop body
+  and are now out of scope. */
+  std::vector<llvm::Value*> currentSSAValues(std::size_t cnt);
+  /** Makes the given values the current IR values of the first objects of
+  m_mutableSSAObjects, and drops the objects beyond. */
+  void setCurrentSSAValues(const std::vector<llvm::Value*>& values);
+  /** At a control flow join, i.e. at the start of the current basic block,
+  merges the current IR values of m_mutableSSAObjects flowing in from the given
+  predecessor basic blocks. A phi is only created for objects whose values
+  differ. */
+  void mergeSSAValues(const std::vector<
+    std::pair<llvm::BasicBlock*, std::vector<llvm::Value*>>>& incomings);
 
   void allocateAndInitLocalIrObjectFor(AstObject& astObject,
-    llvm::Value* irInitializer, const std::string& name = "");
+    llvm::Value* irInitializer, const llvm::Twine& name = "");
   llvm::AllocaInst* createAllocaInEntryBlock(
-    llvm::Function* functionIr, const std::string& varName, llvm::Type* type);
+    llvm::Function* functionIr, const llvm::Twine& varName, llvm::Type* type);
 
   llvm::IRBuilder<> m_builder;
   /** Is non-null during execution of IrGen, that is practically 'always'
   from the view point of member functions. */
   std::unique_ptr<llvm::Module> m_module;
   std::stack<llvm::BasicBlock*> m_BasicBlockStack;
+  /** The modified local objects of the current function which are SSA values,
+  see Object_IrPart::isSSAValue, in order of their definition. Their IR value
+  is the one valid at the current insertion point; phis are inserted at the
+  joins of control flow. */
+  std::vector<Object*> m_mutableSSAObjects;
+  /** The IR parts of the objects of the AST passed to genIr */
+  Object_IrParts m_irParts;
   ErrorHandler& m_errorHandler;
+  const Options m_options;
   /** For abstract obj types like void or noreturn. Contrast this with nullptr
   which means '(accidentaly) not (yet) set)'. */
   static llvm::Value* const m_abstractObject;
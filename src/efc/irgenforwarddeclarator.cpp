@@ -1,6 +1,9 @@
 #include "irgenforwarddeclarator.h"
 
 #include "ast.h"
+#include "asttraversal.h"
+#include "object_irpart.h"
+#include "objtype.h"
 
 #include "llvm/IR/Module.h"
 
@@ -10,35 +13,78 @@ using namespace std;
 using namespace llvm;
 
 IrGenForwardDeclarator::IrGenForwardDeclarator(
-  ErrorHandler& /*errorHandler*/, llvm::Module& module)
-  : m_module{module} {
+  ErrorHandler& /*errorHandler*/, llvm::Module& module, Object_IrParts& irParts)
+  : m_module{module}, m_irParts{irParts} {
 }
 
 void IrGenForwardDeclarator::operator()(AstNode& root) {
-  root.accept(*this);
+  AstTraversal{nullptr, this}(root);
 }
 
-void IrGenForwardDeclarator::visit(AstDataDef& dataDef) {
-  AstDefaultIterator::visit(dataDef);
+namespace {
+/** Class objects up to that size in bits are passed and returned by value,
+which typically means in registers. */
+const uint64_t maxSizeOfClassPassedByValue = 128;
+
+/** The size is the one of the object in memory, i.e. including padding, as
+opposed to ObjType::size */
+bool isLargeClass(const ObjType& objType, const DataLayout& dataLayout) {
+  return dynamic_cast<const ObjTypeCompound*>(
+           objType.unqualifiedObjType().get()) &&
+    dataLayout.getTypeAllocSizeInBits(objType.llvmType()) >
+    maxSizeOfClassPassedByValue;
+}
+
+/** bool and char, i.e. i1 and i8, parameters and return values are zero
+extended to a full register, as the C ABI requires for C++'s bool and unsigned
+char. Thus host code can call EF functions and vice versa. */
+bool isZeroExtended(const ObjType& objType) {
+  const auto funda =
+    dynamic_cast<const ObjTypeFunda*>(objType.unqualifiedObjType().get());
+  return funda &&
+    (funda->type() == ObjTypeFunda::eBool ||
+      funda->type() == ObjTypeFunda::eChar);
+}
+}
+
+bool IrGenForwardDeclarator::isPassedByPointer(
+  const ObjType& paramObjType, const DataLayout& dataLayout) {
+  return isLargeClass(paramObjType, dataLayout) &&
+    !(paramObjType.qualifiers() & ObjType::eMutable);
+}
+
+bool IrGenForwardDeclarator::isReturnedViaSret(
+  const ObjType& retObjType, const DataLayout& dataLayout) {
+  return isLargeClass(retObjType, dataLayout);
+}
 
+void IrGenForwardDeclarator::visit(AstDataDef& dataDef) {
   if (dataDef.storageDuration() == StorageDuration::eStatic) {
     const auto addr = new GlobalVariable{m_module, dataDef.objType().llvmType(),
       !(dataDef.objType().qualifiers() & ObjType::eMutable),
       GlobalValue::InternalLinkage, nullptr, dataDef.fqName()};
-    dataDef.ir().setAddrOfIrObject(addr);
+    m_irParts[dataDef].setAddrOfIrObject(addr);
   }
 }
 
 void IrGenForwardDeclarator::visit(AstFunDef& funDef) {
-  AstDefaultIterator::visit(funDef);
-
   // create IR function with given name and signature
+  const auto& retObjType = funDef.ret().objType();
+  const auto& dataLayout = m_module.getDataLayout();
+  const auto isSret = isReturnedViaSret(retObjType, dataLayout);
   vector<Type*> llvmArgs{};
+  if (isSret) {
+    llvmArgs.push_back(PointerType::get(retObjType.llvmType(), 0));
+  }
   for (const auto& astArg : funDef.declaredArgs()) {
-    llvmArgs.push_back(astArg->objType().llvmType());
+    const auto llvmArg = astArg->objType().llvmType();
+    llvmArgs.push_back(isPassedByPointer(astArg->objType(), dataLayout)
+        ? PointerType::get(llvmArg, 0)
+        : llvmArg);
   }
-  auto llvmFunctionType =
-    FunctionType::get(funDef.ret().objType().llvmType(), llvmArgs, false);
+  auto llvmFunctionType = FunctionType::get(
+    isSret ? Type::getVoidTy(m_module.getContext()) : retObjType.llvmType(),
+    llvmArgs, false);
   auto functionIr = Function::Create(
     llvmFunctionType, Function::ExternalLinkage, funDef.fqName(), &m_module);
   assert(functionIr);
@@ -48,5 +94,36 @@ void IrGenForwardDeclarator::visit(AstFunDef& funDef) {
   // environment said the name is unique.
   assert(functionIr->getName() == funDef.fqName());
 
-  funDef.ir().setAddrOfIrObject(functionIr);
+  // The caller passes a fresh object to be initialized with the return value
+  unsigned argNo = 0;
+  if (isSret) {
+    functionIr->addParamAttr(argNo,
+      Attribute::getWithStructRetType(
+        m_module.getContext(), retObjType.llvmType()));
+    functionIr->addParamAttr(argNo, Attribute::NoAlias);
+    ++argNo;
+  }
+  else if (isZeroExtended(retObjType)) {
+    functionIr->addRetAttr(Attribute::ZExt);
+  }
+
+  // Pointer parameters whose pointee is immutable: the function can't write
+  // through them, and EF guarantees that the pointee isn't modified via other
+  // pointers during the call, thus they don't alias anything written to. The
+  // same holds for the pointers to immutable class objects passed by pointer.
+  for (const auto& astArg : funDef.declaredArgs()) {
+    const auto ptrType = dynamic_cast<const ObjTypePtr*>(
+      astArg->objType().unqualifiedObjType().get());
+    if ((ptrType && !(ptrType->pointee()->qualifiers() & ObjType::eMutable)) ||
+      isPassedByPointer(astArg->objType(), dataLayout)) {
+      functionIr->addParamAttr(argNo, Attribute::NoAlias);
+      functionIr->addParamAttr(argNo, Attribute::ReadOnly);
+    }
+    if (isZeroExtended(astArg->objType())) {
+      functionIr->addParamAttr(argNo, Attribute::ZExt);
+    }
+    ++argNo;
+  }
+
+  m_irParts[funDef].setAddrOfIrObject(functionIr);
 }
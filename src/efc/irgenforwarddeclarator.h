@@ -1,11 +1,14 @@
 #pragma once
-#include "astdefaultiterator.h"
 #include "astforwards.h"
+#include "nopastvisitor.h"
 
 namespace llvm {
+class DataLayout;
 class Module;
 }
 class ErrorHandler;
+class Object_IrParts;
+class ObjType;
 
 /** For each AST node representing an non-local object (data or function)
 definition, create an respective LLVM value, and set the IrAddr of the Object
@@ -14,16 +17,32 @@ associated to the AST node to the new entity.
   ASTNode ---->  Object --------> new LLVM entity
   being an                 IrAddr
   definition
-*/
-class IrGenForwardDeclarator : private AstDefaultIterator {
+
+The AST is traversed in post order, see AstTraversal. */
+class IrGenForwardDeclarator : private NopAstVisitor {
 public:
-  IrGenForwardDeclarator(ErrorHandler& errorHandler, llvm::Module& module);
+  IrGenForwardDeclarator(ErrorHandler& errorHandler, llvm::Module& module,
+    Object_IrParts& irParts);
 
   void operator()(AstNode& root);
 
+  /** Whether a parameter of the given type is passed as pointer to a copy of
+  the argument instead of as the argument's value. That is the case for large
+  immutable class objects, which are thus not copied when the caller's
+  argument is itself in memory. Large is meant as defined by dataLayout. */
+  static bool isPassedByPointer(
+    const ObjType& paramObjType, const llvm::DataLayout& dataLayout);
+  /** Whether an object of the given return type is returned via an additional
+  first parameter of type pointer to that object (LLVM's sret), instead of as
+  the function's value. That is the case for large class objects, large as
+  defined by dataLayout. */
+  static bool isReturnedViaSret(
+    const ObjType& retObjType, const llvm::DataLayout& dataLayout);
+
 private:
   void visit(AstDataDef& dataDef) override;
   void visit(AstFunDef& funDef) override;
 
   llvm::Module& m_module;
+  Object_IrParts& m_irParts;
 };
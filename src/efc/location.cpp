@@ -1,3 +1,4 @@
 #include "location.h"
 
-const Location s_nullLoc{Position{nullptr, 0, 0}, Position{nullptr, 0, 0}};
+const Location s_nullLoc{
+  nullptr, Location::sm_nullOffset, Location::sm_nullOffset};
@@ -1,53 +1,52 @@
 #pragma once
 
 #include "position.h"
+#include "sourcefile.h"
 
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <string>
 
-/** A losition in the EF source file. */
+/** A losition in the EF source file. To keep AST nodes small, it only stores
+the range of byte offsets [m_begin, m_end) into the source file. Line and column
+are decoded on demand via the source file's line table, see begin and end. */
 class Location {
 public:
   /** Initializes to a valid location pointing to the beginning of the
   input. I.e. does _not_ initialize to the 'null location'.  */
-  Location() : Location{Position{}} {}
-  Location(const Position& b, const Position& e) : begin{b}, end{e} {}
+  Location() : Location{nullptr, 0, 0} {}
+  Location(const SourceFile* sourceFile, std::uint32_t b, std::uint32_t e)
+    : m_sourceFile{sourceFile}, m_begin{b}, m_end{e} {}
 
-  explicit Location(const Position& p) : begin{p}, end{p} {}
-
-  explicit Location(std::string* f, unsigned int l = 1u, unsigned int c = 1u)
-    : begin{f, l, c}, end{f, l, c} {}
-
-  void initialize(
-    std::string* f = nullptr, unsigned int l = 1u, unsigned int c = 1u) {
-    begin.initialize(f, l, c);
-    end = begin;
-  }
-
-public:
-  /** Reset initial location to final location. */
-  void step() { begin = end; }
-
-  /** Extend the current location to the COUNT next columns. */
-  void columns(int count = 1) { end += count; }
-
-  /** Extend the current location to the COUNT next lines. */
-  void lines(int count = 1) { end.lines(count); }
-
-  /** True if this location compares equal to s_nullLoc */
-  bool isNull() const { return begin.isNull() || end.isNull(); }
-
-public:
   /** Beginning of the located region. */
-  Position begin;
+  Position begin() const { return position(m_begin); }
   /** End of the located region. */
-  Position end;
+  Position end() const { return position(m_end); }
+
+  /** True if this location compares equal to s_nullLoc */
+  bool isNull() const { return m_begin == sm_nullOffset; }
+
+  /** The source file the offsets refer to. nullptr for an anonymous file. */
+  const SourceFile* m_sourceFile;
+  /** Offset of the beginning of the located region */
+  std::uint32_t m_begin;
+  /** Offset one past the end of the located region */
+  std::uint32_t m_end;
+
+  static constexpr std::uint32_t sm_nullOffset = UINT32_MAX;
+
+private:
+  Position position(std::uint32_t offset) const {
+    if (isNull()) { return Position{nullptr, 0, 0}; }
+    if (m_sourceFile) { return m_sourceFile->position(offset); }
+    return Position{nullptr, 1, offset + 1};
+  }
 };
 
 /** Join two locations, in place. */
 inline Location& operator+=(Location& res, const Location& end) {
-  res.end = end.end;
+  res.m_end = end.m_end;
   return res;
 }
 
@@ -56,29 +55,9 @@ inline Location operator+(Location res, const Location& end) {
   return res += end;
 }
 
-/** Add \a width columns to the end position, in place. */
-inline Location& operator+=(Location& res, int width) {
-  res.columns(width);
-  return res;
-}
-
-/** Add \a width columns to the end position. */
-inline Location operator+(Location res, int width) {
-  return res += width;
-}
-
-/** Subtract \a width columns to the end position, in place. */
-inline Location& operator-=(Location& res, int width) {
-  return res += -width;
-}
-
-/** Subtract \a width columns to the end position. */
-inline Location operator-(Location res, int width) {
-  return res -= width;
-}
-
 inline bool operator==(const Location& loc1, const Location& loc2) {
-  return loc1.begin == loc2.begin && loc1.end == loc2.end;
+  return loc1.m_sourceFile == loc2.m_sourceFile &&
+    loc1.m_begin == loc2.m_begin && loc1.m_end == loc2.m_end;
 }
 
 inline bool operator!=(const Location& loc1, const Location& loc2) {
@@ -88,15 +67,13 @@ inline bool operator!=(const Location& loc1, const Location& loc2) {
 template<typename YYChar>
 inline std::basic_ostream<YYChar>& operator<<(
   std::basic_ostream<YYChar>& ostr, const Location& loc) {
-  unsigned int end_col = 0 < loc.end.m_column ? loc.end.m_column - 1 : 0;
-  ostr << loc.begin;
-  if (loc.end.m_fileName &&
-    (!loc.begin.m_fileName || *loc.begin.m_fileName != *loc.end.m_fileName))
-    ostr << '-' << loc.end.m_fileName << ':' << loc.end.m_line << '.'
-         << end_col;
-  else if (loc.begin.m_line < loc.end.m_line)
-    ostr << '-' << loc.end.m_line << '.' << end_col;
-  else if (loc.begin.m_column < end_col)
+  const auto begin = loc.begin();
+  const auto end = loc.end();
+  unsigned int end_col = 0 < end.m_column ? end.m_column - 1 : 0;
+  ostr << begin;
+  if (begin.m_line < end.m_line)
+    ostr << '-' << end.m_line << '.' << end_col;
+  else if (begin.m_column < end_col)
     ostr << '-' << end_col;
   return ostr;
 }
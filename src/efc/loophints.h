@@ -0,0 +1,20 @@
+#pragma once
+
+/** Optimization hints the programmer gave for a loop, see AstLoop. A count of
+zero means that no hint was given, i.e. that it's up to the optimizer. */
+struct LoopHints {
+  /** Number of lanes the loop shall be vectorized with */
+  int m_vectorizeWidth = 0;
+  /** Number of iterations whose instructions shall be interleaved */
+  int m_interleaveCount = 0;
+  /** Number of times the loop body shall be unrolled */
+  int m_unrollCount = 0;
+  /** Whether the programmer asserts that the memory accesses of different
+  iterations never alias, i.e. that the iterations could execute in parallel */
+  bool m_isIndependent = false;
+
+  bool isEmpty() const {
+    return m_vectorizeWidth == 0 && m_interleaveCount == 0 &&
+      m_unrollCount == 0 && !m_isIndependent;
+  }
+};
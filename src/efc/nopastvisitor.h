@@ -19,9 +19,14 @@ public:
   void visit(AstIf& if_) override{};
   void visit(AstLoop& loop) override{};
   void visit(AstReturn& return_) override{};
+  void visit(AstRawNew& rawNew) override{};
+  void visit(AstRawDelete& rawDelete) override{};
+  void visit(AstMemberAccess& memberAccess) override{};
   void visit(AstObjTypeSymbol& symbol) override{};
   void visit(AstObjTypeQuali& quali) override{};
   void visit(AstObjTypePtr& ptr) override{};
+  void visit(AstObjTypeSimd& simd) override{};
+  void visit(AstObjTypeArray& array) override{};
   void visit(AstClassDef& class_) override{};
 
 protected:
@@ -45,9 +50,14 @@ public:
   void visit(const AstIf& if_) override{};
   void visit(const AstLoop& loop) override{};
   void visit(const AstReturn& return_) override{};
+  void visit(const AstRawNew& rawNew) override{};
+  void visit(const AstRawDelete& rawDelete) override{};
+  void visit(const AstMemberAccess& memberAccess) override{};
   void visit(const AstObjTypeSymbol& symbol) override{};
   void visit(const AstObjTypeQuali& quali) override{};
   void visit(const AstObjTypePtr& ptr) override{};
+  void visit(const AstObjTypeSimd& simd) override{};
+  void visit(const AstObjTypeArray& array) override{};
   void visit(const AstClassDef& class_) override{};
 
 protected:
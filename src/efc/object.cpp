@@ -1,7 +1,12 @@
 #include "object.h"
 
+#include <cassert>
+
 ConcreteObject::ConcreteObject()
-  : m_isModifiedOrRevealsAddr{false}, m_ir{*this} {
+  : m_id{sm_noId}
+  , m_idSideTable{0}
+  , m_isModifiedOrRevealsAddr{false}
+  , m_revealsAddr{false} {
 }
 
 ConcreteObject::~ConcreteObject() = default;
@@ -9,8 +14,20 @@ ConcreteObject::~ConcreteObject() = default;
 void ConcreteObject::addAccess(Access access) {
   m_isModifiedOrRevealsAddr = m_isModifiedOrRevealsAddr ||
     access == Access::eWrite || access == Access::eTakeAddress;
+  m_revealsAddr = m_revealsAddr || access == Access::eTakeAddress;
+}
+
+void ConcreteObject::setId(ObjectId id, SideTableId sideTable) {
+  assert(id != sm_noId);
+  assert(sideTable != m_idSideTable); // it doesn't make sense to set it twice
+  m_id = id;
+  m_idSideTable = sideTable;
 }
 
 bool ConcreteObject::isModifiedOrRevealsAddr() const {
   return m_isModifiedOrRevealsAddr;
 }
+
+bool ConcreteObject::revealsAddr() const {
+  return m_revealsAddr;
+}
@@ -1,14 +1,19 @@
 #pragma once
 #include "access.h"
 #include "envnode.h"
-#include "object_irpart.h"
 #include "storageduration.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
 class ObjType;
 
+/** Dense id of an object, see Object::id */
+using ObjectId = std::uint32_t;
+/** Identifies the side table which assigned an ObjectId, see Object::id */
+using SideTableId = std::uint32_t;
+
 /** An Object is a region of storage. It is either a data object or a function
 (object). Note that deriving from EnvNode doesn't mean the EnvNode must be in
 the environment; e.g. the Object resulting from dereferencing a pointer might be
@@ -26,9 +31,20 @@ public:
 
   virtual void addAccess(Access access) = 0;
   virtual bool isModifiedOrRevealsAddr() const = 0;
+  /** Whether the object's address is taken, as opposed to only its value
+  being read or written */
+  virtual bool revealsAddr() const = 0;
+
+  /** Dense id of the object, used by passes as index into side tables
+  holding their per object data, see e.g. Object_IrParts. The id is only valid
+  in the side table which assigned it, identified by sideTable; for any other
+  side table sm_noId is returned, so the object can be added anew, e.g. when
+  a second IrGen runs over the same AST. For an object delegate it's the id of
+  the referenced object. */
+  virtual ObjectId id(SideTableId sideTable) const = 0;
+  virtual void setId(ObjectId id, SideTableId sideTable) = 0;
 
-  virtual const Object_IrPart& ir() const = 0;
-  virtual Object_IrPart& ir() = 0;
+  static constexpr ObjectId sm_noId = UINT32_MAX;
 };
 
 /** Concrete in the sense of not indirect. Some abstract methods are still left
@@ -43,14 +59,20 @@ public:
   AstObject::m_accessFromAstParent. */
   void addAccess(Access access) override;
   bool isModifiedOrRevealsAddr() const override;
+  bool revealsAddr() const override;
 
-  const Object_IrPart& ir() const override { return m_ir; }
-  Object_IrPart& ir() override { return m_ir; }
+  ObjectId id(SideTableId sideTable) const override {
+    return sideTable == m_idSideTable ? m_id : sm_noId;
+  }
+  void setId(ObjectId id, SideTableId sideTable) override;
 
 private:
+  ObjectId m_id;
+  /** The side table which assigned m_id */
+  SideTableId m_idSideTable;
   /** Combined accesses to the object associated with this AST node. */
   bool m_isModifiedOrRevealsAddr;
-  Object_IrPart m_ir;
+  bool m_revealsAddr;
 };
 
 /** Meant as convenience class so not each class wanting to implement the
@@ -85,7 +107,8 @@ public:
   StorageDuration storageDuration() const override { return referencedObj().storageDuration(); };
   void addAccess(Access access) override { return referencedObj().addAccess(access); };
   bool isModifiedOrRevealsAddr() const override { return referencedObj().isModifiedOrRevealsAddr(); };
-  const Object_IrPart& ir() const override { return referencedObj().ir(); };
-  Object_IrPart& ir() override { return referencedObj().ir(); };
+  bool revealsAddr() const override { return referencedObj().revealsAddr(); };
+  ObjectId id(SideTableId sideTable) const override { return referencedObj().id(sideTable); };
+  void setId(ObjectId id, SideTableId sideTable) override { referencedObj().setId(id, sideTable); };
   // clang-format on
 };
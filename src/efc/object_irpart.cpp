@@ -1,98 +1,155 @@
 #include "object_irpart.h"
 
 #include "object.h"
+#include "objtype.h"
 
 #include "llvm/IR/GlobalVariable.h"
 #include "llvm/IR/Value.h"
 
+#include <atomic>
 #include <cassert>
 
 using namespace std;
 using namespace llvm;
 
-Object_IrPart::Object_IrPart(const Object& obj)
-  : m_obj{obj}
-  , m_irAddrOfIrObject{nullptr}
-  , m_irValueOfObject{nullptr}
-  , m_phase{eStart} {
+namespace {
+/** Attaches TBAA metadata derived from the given object's type to the given
+load or store instruction. */
+Instruction* decorateWithTbaa(Instruction* inst, const Object& obj) {
+  if (const auto tag = obj.objType().llvmTbaaAccessTag()) {
+    inst->setMetadata(LLVMContext::MD_tbaa, tag);
+  }
+  return inst;
+}
+}
+
+Object_IrParts::Object_IrParts() {
+  // 0 is reserved for objects not yet added to any side table
+  static atomic<SideTableId> s_nextSideTableId{1};
+  m_sideTableId = s_nextSideTableId++;
+}
+
+Object_IrPart Object_IrParts::operator[](Object& obj) {
+  auto id = obj.id(m_sideTableId);
+  if (id == Object::sm_noId) {
+    id = static_cast<ObjectId>(m_objs.size());
+    obj.setId(id, m_sideTableId);
+    m_objs.push_back(&obj);
+    m_irAddrsOfIrObject.push_back(nullptr);
+    m_irValuesOfObject.push_back(nullptr);
+    m_phases.push_back(eStart);
+  }
+  assert(id < m_objs.size());
+  return Object_IrPart{*this, id};
+}
+
+Object_IrPart::Object_IrPart(Object_IrParts& irParts, ObjectId id)
+  : m_irParts{irParts}, m_id{id} {
 }
 
 bool Object_IrPart::isSSAValue() const {
-  const auto sd = m_obj.storageDuration();
+  const auto sd = obj().storageDuration();
   assert(sd != StorageDuration::eYetUndefined);
-  return sd == StorageDuration::eLocal && !m_obj.isModifiedOrRevealsAddr();
+  return sd == StorageDuration::eLocal && !obj().revealsAddr();
 }
 
 void Object_IrPart::setAddrOfIrObject(
   llvm::Value* irAddrOfIrObject, EInitStatus status) {
-  assert(eStart == m_phase);
+  auto& phase = phaseRef();
+  auto& irAddr = irAddrOfIrObjectRef();
+  assert(Object_IrParts::eStart == phase);
   assert(!isSSAValue());
   assert(irAddrOfIrObject);
-  assert(!m_irAddrOfIrObject); // doesn't make sense to set it twice
-  m_irAddrOfIrObject = irAddrOfIrObject;
-  m_phase = status == EInitStatus::eUNinitialized ? eAllocated : eInitialized;
+  assert(!irAddr); // doesn't make sense to set it twice
+  irAddr = irAddrOfIrObject;
+  phase = status == EInitStatus::eUNinitialized ? Object_IrParts::eAllocated
+                                                : Object_IrParts::eInitialized;
 }
 
 void Object_IrPart::initializeIrObject(Value* irValue, IRBuilder<>& builder) {
+  auto& phase = phaseRef();
   assert(irValue);
   if (!isSSAValue()) {
-    assert(eAllocated == m_phase);
-    assert(m_irAddrOfIrObject);
-    if (m_obj.storageDuration() == StorageDuration::eStatic) {
-      const auto globalVariable =
-        static_cast<GlobalVariable*>(m_irAddrOfIrObject);
+    const auto irAddr = irAddrOfIrObjectRef();
+    assert(Object_IrParts::eAllocated == phase);
+    assert(irAddr);
+    if (obj().storageDuration() == StorageDuration::eStatic) {
+      const auto globalVariable = static_cast<GlobalVariable*>(irAddr);
       const auto constantInitializer = static_cast<Constant*>(irValue);
       globalVariable->setInitializer(constantInitializer);
     }
-    else if (m_obj.storageDuration() == StorageDuration::eLocal) {
-      builder.CreateStore(irValue, m_irAddrOfIrObject);
+    else if (obj().storageDuration() == StorageDuration::eLocal) {
+      decorateWithTbaa(builder.CreateStore(irValue, irAddr), obj());
     }
   }
   else {
-    assert(m_phase == eStart); // there's no allocation phase for SSA values
-    assert(!m_irValueOfObject); // doesn't make sense to set it twice
-    m_irValueOfObject = irValue;
+    auto& irValueOfObject = irValueOfObjectRef();
+    // there's no allocation phase for SSA values
+    assert(phase == Object_IrParts::eStart);
+    assert(!irValueOfObject); // doesn't make sense to set it twice
+    irValueOfObject = irValue;
   }
-  m_phase = eInitialized;
+  phase = Object_IrParts::eInitialized;
 }
 
 Value* Object_IrPart::irValueOfIrObject(
   IRBuilder<>& builder, const string& name) const {
-  if (m_obj.storageDuration() == StorageDuration::eLocal) {
-    assert(eInitialized == m_phase);
+  if (obj().storageDuration() == StorageDuration::eLocal) {
+    assert(Object_IrParts::eInitialized == phaseRef());
   }
   else {
-    assert(eStart != m_phase);
+    assert(Object_IrParts::eStart != phaseRef());
   }
   if (!isSSAValue()) {
-    assert(m_irAddrOfIrObject);
-    return builder.CreateLoad(m_irAddrOfIrObject, name);
+    const auto irAddr = irAddrOfIrObjectRef();
+    assert(irAddr);
+    return decorateWithTbaa(builder.CreateLoad(irAddr, name), obj());
   }
-  assert(m_irValueOfObject);
-  return m_irValueOfObject;
+  assert(irValueOfObjectRef());
+  return irValueOfObjectRef();
 }
 
 void Object_IrPart::setIrValueOfIrObject(Value* irValue, IRBuilder<>& builder) {
-  if (m_obj.storageDuration() == StorageDuration::eLocal) {
-    assert(eInitialized == m_phase);
+  if (obj().storageDuration() == StorageDuration::eLocal) {
+    assert(Object_IrParts::eInitialized == phaseRef());
   }
   else {
-    assert(eStart != m_phase);
+    assert(Object_IrParts::eStart != phaseRef());
   }
-  assert(!isSSAValue());
-  assert(m_irAddrOfIrObject);
   assert(irValue);
-  builder.CreateStore(irValue, m_irAddrOfIrObject);
+  if (isSSAValue()) {
+    irValueOfObjectRef() = irValue;
+    return;
+  }
+  const auto irAddr = irAddrOfIrObjectRef();
+  assert(irAddr);
+  decorateWithTbaa(builder.CreateStore(irValue, irAddr), obj());
 }
 
 Value* Object_IrPart::irAddrOfIrObject() const {
-  if (m_obj.storageDuration() == StorageDuration::eLocal) {
-    assert(eInitialized == m_phase);
+  if (obj().storageDuration() == StorageDuration::eLocal) {
+    assert(Object_IrParts::eInitialized == phaseRef());
   }
   else {
-    assert(eStart != m_phase);
+    assert(Object_IrParts::eStart != phaseRef());
   }
   assert(!isSSAValue());
-  assert(m_irAddrOfIrObject);
-  return m_irAddrOfIrObject;
+  assert(irAddrOfIrObjectRef());
+  return irAddrOfIrObjectRef();
+}
+
+const Object& Object_IrPart::obj() const {
+  return *m_irParts.m_objs[m_id];
+}
+
+Value*& Object_IrPart::irAddrOfIrObjectRef() const {
+  return m_irParts.m_irAddrsOfIrObject[m_id];
+}
+
+Value*& Object_IrPart::irValueOfObjectRef() const {
+  return m_irParts.m_irValuesOfObject[m_id];
+}
+
+Object_IrParts::Phase& Object_IrPart::phaseRef() const {
+  return m_irParts.m_phases[m_id];
 }
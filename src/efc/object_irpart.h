@@ -1,21 +1,61 @@
 #pragma once
 
+#include "object.h"
+
 #include "llvm/IR/IRBuilder.h"
 
 #include <string>
+#include <vector>
 
-class Object;
+class Object_IrPart;
 
 enum class EInitStatus { eUNinitialized, eInitialized };
 
+/** Side table holding the data of the Object_IrPart of each object, as struct
+of arrays indexed by Object::id. Owned by IrGen, so AST nodes don't pay for IR
+data and IrGen's working set is contiguous. Assigns ids to objects which don't
+have one yet in this side table. An object's id is only valid in the side table
+which assigned it most recently, so two Object_IrParts must not be used
+interleaved on the same objects. */
+class Object_IrParts {
+public:
+  Object_IrParts();
+
+  Object_IrPart operator[](Object& obj);
+
+private:
+  friend class Object_IrPart;
+
+  /** Tracks whether the object is allocated and initialized. Is not strictly
+  required. Is only used for defensive programming to test that the clients
+  does not call methods in the wrong order, e.g. uses an uninitialized IR
+  object. */
+  enum Phase { eStart, eAllocated, eInitialized };
+
+  /** Unique among all Object_IrParts ever created, see Object::id */
+  SideTableId m_sideTableId;
+  /** For each id, the object via which the id was assigned */
+  std::vector<const Object*> m_objs;
+  /** Only used if isSSAValue() is false: points to the IR object */
+  std::vector<llvm::Value*> m_irAddrsOfIrObject;
+  /** Only used if isSSAValue() is true: directly the IR object. I.e. the
+  IR object is an SSA value. If the object is modified, it's the current SSA
+  value. */
+  std::vector<llvm::Value*> m_irValuesOfObject;
+  std::vector<Phase> m_phases;
+};
+
 /** The part of Object that is for use by IrGen. Represents an IR object, which
-is either an SSA value or memory. */
+is either an SSA value or memory. It's only a handle; the data is stored in an
+Object_IrParts side table owned by IrGen, see there. */
 class Object_IrPart {
 public:
-  Object_IrPart(const Object& obj);
+  Object_IrPart(Object_IrParts& irParts, ObjectId id);
 
-  /** True if we want to place the object in memory, false if we store it as
-  SSA value. */
+  /** True if we store the object as SSA value, false if we want to place it in
+  memory. A local object whose address is never taken is an SSA value even if
+  it is modified; each modification then defines a new SSA value, see
+  setIrValueOfIrObject. */
   bool isSSAValue() const;
 
   // -- Allocation phase: Note that SSA values are implicitely allocated.
@@ -33,21 +73,18 @@ public:
   // -- Usage phase: Use the already initialized IR object.
   llvm::Value* irValueOfIrObject(
     llvm::IRBuilder<>& builder, const std::string& name = "") const;
+  /** For an SSA value, irValue becomes the current SSA value of the object,
+  which is the one returned by subsequent calls to irValueOfIrObject. It's the
+  client's responsibility to merge SSA values at control flow joins. */
   void setIrValueOfIrObject(llvm::Value* irValue, llvm::IRBuilder<>& builder);
   llvm::Value* irAddrOfIrObject() const;
 
 private:
-  enum Phase { eStart, eAllocated, eInitialized };
-
-  const Object& m_obj;
+  const Object& obj() const;
+  llvm::Value*& irAddrOfIrObjectRef() const;
+  llvm::Value*& irValueOfObjectRef() const;
+  Object_IrParts::Phase& phaseRef() const;
 
-  /** Only used if isSSAValue() is false: points to the IR object */
-  llvm::Value* m_irAddrOfIrObject;
-  /** Only used if isSSAValue() is true: directly the IR object. I.e. the
-  IR object is an SSA value. */
-  llvm::Value* m_irValueOfObject;
-  /** Tracks whether Object is allocated and initialized. Is not strictly
-  required. Is only used for defensive programming to test that the clients does
-  not call methods in the wrong order, e.g. uses an uninitialized IR object. */
-  Phase m_phase;
+  Object_IrParts& m_irParts;
+  const ObjectId m_id;
 };
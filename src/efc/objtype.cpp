@@ -3,6 +3,9 @@
 #include "ast.h"
 #include "irgen.h"
 
+#include "llvm/IR/MDBuilder.h"
+
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 using namespace std;
@@ -38,6 +41,31 @@ shared_ptr<const ObjType> ObjType::unqualifiedObjType() const {
   return shared_from_this();
 }
 
+namespace {
+/** Root of EF's TBAA type DAG. MDNodes are uniqued by the LLVMContext, so
+creating it anew on each call yields always the same node. */
+MDNode* tbaaRoot() {
+  return MDBuilder(llvmContext).createTBAARoot("EF TBAA");
+}
+
+/** Like in C, char is the omnipotent type which may alias any other type, thus
+all other scalar type nodes are its children. */
+MDNode* tbaaOmnipotentChar() {
+  return MDBuilder(llvmContext).createTBAAScalarTypeNode("char", tbaaRoot());
+}
+
+MDNode* tbaaScalarTypeNode(const string& name) {
+  return MDBuilder(llvmContext)
+    .createTBAAScalarTypeNode(name, tbaaOmnipotentChar());
+}
+}
+
+MDNode* ObjType::llvmTbaaAccessTag() const {
+  const auto typeNode = llvmTbaaTypeNode();
+  if (!typeNode) { return nullptr; }
+  return MDBuilder(llvmContext).createTBAAStructTagNode(typeNode, typeNode, 0);
+}
+
 string ObjType::completeName() const {
   ostringstream ss;
   printTo(ss);
@@ -114,11 +142,26 @@ ObjType::MatchType ObjTypeQuali::match2(
   return match2Quali(src, isLevel0, true);
 }
 
+ObjType::MatchType ObjTypeQuali::match2(
+  const ObjTypeSimd& src, bool isLevel0) const {
+  return match2Quali(src, isLevel0, true);
+}
+
+ObjType::MatchType ObjTypeQuali::match2(
+  const ObjTypeArray& src, bool isLevel0) const {
+  return match2Quali(src, isLevel0, true);
+}
+
 ObjType::MatchType ObjTypeQuali::match2(
   const ObjTypeFun& src, bool isRoot) const {
   return match2Quali(src, isRoot, true);
 }
 
+ObjType::MatchType ObjTypeQuali::match2(
+  const ObjTypeCompound& src, bool isRoot) const {
+  return match2Quali(src, isRoot, true);
+}
+
 ObjType::MatchType ObjTypeQuali::match2Quali(
   const ObjType& type, bool /*isRoot*/, bool typeIsSrc) const {
   switch (type.match(*m_type)) {
@@ -144,10 +187,18 @@ int ObjTypeQuali::size() const {
   return m_type->size();
 }
 
+int ObjTypeQuali::alignment() const {
+  return m_type->alignment();
+}
+
 llvm::Type* ObjTypeQuali::llvmType() const {
   return m_type->llvmType();
 }
 
+MDNode* ObjTypeQuali::llvmTbaaTypeNode() const {
+  return m_type->llvmTbaaTypeNode();
+}
+
 bool ObjTypeQuali::hasMemberFun(int op) const {
   return m_type->hasMemberFun(op);
 }
@@ -170,6 +221,10 @@ string toStr(ObjTypeFunda::EType type) {
   case ObjTypeFunda::eInt: return "int";
   case ObjTypeFunda::eBool: return "bool";
   case ObjTypeFunda::eDouble: return "double";
+  case ObjTypeFunda::eInt64: return "int64";
+  case ObjTypeFunda::eUInt32: return "uint32";
+  case ObjTypeFunda::eUInt64: return "uint64";
+  case ObjTypeFunda::eFloat: return "float";
   case ObjTypeFunda::eNullptr: return "Nullptr";
   case ObjTypeFunda::ePointer: return "raw*";
   case ObjTypeFunda::eTypeCnt: assert(false);
@@ -203,10 +258,15 @@ bool ObjTypeFunda::is(ObjType::EClass class_) const {
   case eBool:
   case eInt:
   case eDouble:
+  case eInt64:
+  case eUInt32:
+  case eUInt64:
+  case eFloat:
   case ePointer:
-  case eNullptr:
+  case eNullptr: {
+    const auto isFloatingPoint = m_type == eDouble || m_type == eFloat;
     if (class_ == eScalar) { return true; }
-    if (class_ == eStoredAsIntegral) { return m_type != eDouble; }
+    if (class_ == eStoredAsIntegral) { return !isFloatingPoint; }
     switch (m_type) {
     case eBool: // fall through
     case eChar: // fall through
@@ -214,13 +274,21 @@ bool ObjTypeFunda::is(ObjType::EClass class_) const {
     case eNullptr: return false;
     case eInt:
     case eDouble:
+    case eInt64:
+    case eUInt32:
+    case eUInt64:
+    case eFloat:
       if (class_ == eArithmetic) { return true; }
-      if (class_ == eIntegral) { return m_type == eInt; }
-      if (class_ == eFloatingPoint) { return m_type == eDouble; }
+      if (class_ == eIntegral) { return !isFloatingPoint; }
+      if (class_ == eFloatingPoint) { return isFloatingPoint; }
+      if (class_ == eSigned) {
+        return m_type != eUInt32 && m_type != eUInt64;
+      }
       return false;
     default: assert(false);
     }
     return false;
+  }
   case eTypeCnt: assert(false);
   }
   return false;
@@ -236,6 +304,10 @@ int ObjTypeFunda::size() const {
   case eChar: return 8;
   case eInt: return 32;
   case eDouble: return 64;
+  case eInt64: return 64;
+  case eUInt32: return 32;
+  case eUInt64: return 64;
+  case eFloat: return 32;
   case ePointer: return 32;
   case eTypeCnt: assert(false);
   }
@@ -251,6 +323,10 @@ llvm::Type* ObjTypeFunda::llvmType() const {
   case eChar: return Type::getInt8Ty(llvmContext);
   case eInt: return Type::getInt32Ty(llvmContext);
   case eDouble: return Type::getDoubleTy(llvmContext);
+  case eInt64: return Type::getInt64Ty(llvmContext);
+  case eUInt32: return Type::getInt32Ty(llvmContext);
+  case eUInt64: return Type::getInt64Ty(llvmContext);
+  case eFloat: return Type::getFloatTy(llvmContext);
   case eBool: return Type::getInt1Ty(llvmContext);
   case ePointer: assert(false); // actually implemented by derived class
   case eNullptr: assert(false);
@@ -260,6 +336,27 @@ llvm::Type* ObjTypeFunda::llvmType() const {
   return nullptr;
 }
 
+MDNode* ObjTypeFunda::llvmTbaaTypeNode() const {
+  switch (m_type) {
+  case eVoid:
+  case eNoreturn:
+  case eInfer:
+  case eNullptr: return nullptr;
+  case eChar: return tbaaOmnipotentChar();
+  case eInt:
+  case eDouble:
+  case eInt64:
+  case eUInt32:
+  case eUInt64:
+  case eFloat:
+  case eBool: return tbaaScalarTypeNode(name());
+  case ePointer: assert(false); // actually implemented by derived class
+  case eTypeCnt: assert(false);
+  };
+  assert(false);
+  return nullptr;
+}
+
 bool ObjTypeFunda::hasMemberFun(int op) const {
   // general rules
   // -------------
@@ -277,6 +374,7 @@ bool ObjTypeFunda::hasMemberFun(int op) const {
   case AstOperator::eAssignment: return is(eScalar);
   case AstOperator::eArithmetic: return is(eArithmetic);
   case AstOperator::eLogical: return m_type == eBool;
+  case AstOperator::eBitwise: return is(eIntegral);
   case AstOperator::eComparison: return is(eScalar);
   case AstOperator::eMemberAccess:
     // Currently there is no pointer arithmetic, and currently pointers can't
@@ -284,7 +382,9 @@ bool ObjTypeFunda::hasMemberFun(int op) const {
     // member function of the pointer type
     if (op == AstOperator::eDeref) { return m_type == ePointer; }
     if (op == AstOperator::eAddrOf) { return !is(eAbstract); }
+    if (op == AstOperator::eIndex) { return false; }
     break;
+  case AstOperator::eSimd: return false;
   case AstOperator::eOther: break;
   }
 
@@ -306,6 +406,10 @@ bool ObjTypeFunda::hasConstructor(const ObjType& other) const {
   case eChar: // fall through
   case eDouble: // fall through
   case eInt: // fall through
+  case eInt64: // fall through
+  case eUInt32: // fall through
+  case eUInt64: // fall through
+  case eFloat: // fall through
   case ePointer:
     if ((otherFunda.m_type == eVoid) || (otherFunda.m_type == eNoreturn) ||
       (otherFunda.m_type == eInfer)) {
@@ -363,14 +467,172 @@ basic_ostream<char>& ObjTypePtr::printTo(basic_ostream<char>& os) const {
   return os;
 }
 
+int ObjTypePtr::alignment() const {
+  // The code is generated for the host, see ExecutionEngineAdapter
+  return 8 * sizeof(void*);
+}
+
 llvm::Type* ObjTypePtr::llvmType() const {
   return PointerType::get(m_pointee->llvmType(), 0);
 }
 
+MDNode* ObjTypePtr::llvmTbaaTypeNode() const {
+  // For now all pointer types share one node, independent of their pointee
+  return tbaaScalarTypeNode("any pointer");
+}
+
 shared_ptr<const ObjType> ObjTypePtr::pointee() const {
   return m_pointee;
 }
 
+ObjTypeSimd::ObjTypeSimd(int laneCnt, shared_ptr<const ObjType> element)
+  : ObjType("simd"), m_laneCnt(laneCnt), m_element(move(element)) {
+  assert(m_element);
+}
+
+ObjType::MatchType ObjTypeSimd::match(const ObjType& dst, bool isLevel0) const {
+  return dst.match2(*this, isLevel0);
+}
+
+ObjType::MatchType ObjTypeSimd::match2(
+  const ObjTypeSimd& src, bool /*isLevel0*/) const {
+  if (m_laneCnt != src.m_laneCnt) { return eNoMatch; }
+  // lanes can't be qualified on their own, so the elements must match fully
+  if (m_element->match(*src.m_element, false) != eFullMatch) {
+    return eNoMatch;
+  }
+  return eFullMatch;
+}
+
+basic_ostream<char>& ObjTypeSimd::printTo(basic_ostream<char>& os) const {
+  os << "simd[" << m_laneCnt << "]";
+  return m_element->printTo(os);
+}
+
+bool ObjTypeSimd::is(ObjType::EClass class_) const {
+  switch (class_) {
+  case eArithmetic:
+  case eIntegral:
+  case eFloatingPoint:
+  case eSigned:
+  case eStoredAsIntegral: return m_element->is(class_);
+  case eAbstract:
+  case eScalar:
+  case eFunction: return false;
+  }
+  assert(false);
+  return false;
+}
+
+int ObjTypeSimd::size() const {
+  return m_laneCnt * m_element->size();
+}
+
+llvm::Type* ObjTypeSimd::llvmType() const {
+  return FixedVectorType::get(m_element->llvmType(), m_laneCnt);
+}
+
+MDNode* ObjTypeSimd::llvmTbaaTypeNode() const {
+  // A simd object is never accessed as anything else than a whole, thus
+  // sharing the node with its element type is fine.
+  return m_element->llvmTbaaTypeNode();
+}
+
+bool ObjTypeSimd::hasMemberFun(int op) const {
+  if (op == AstOperator::eAddrOf) { return true; }
+
+  switch (AstOperator::classOf(static_cast<AstOperator::EOperation>(op))) {
+  case AstOperator::eAssignment: return true;
+  // lane-wise application of the element's operator
+  case AstOperator::eArithmetic:
+  case AstOperator::eBitwise:
+  case AstOperator::eComparison: return m_element->hasMemberFun(op);
+  // Short circuit has no meaning lane-wise, but lane-wise not has
+  case AstOperator::eLogical:
+    return op == AstOperator::eNot && m_element->hasMemberFun(op);
+  case AstOperator::eMemberAccess: return false;
+  case AstOperator::eSimd:
+    if (op == AstOperator::eLane || op == AstOperator::eWithLane) {
+      return true;
+    }
+    return m_element->is(eArithmetic);
+  case AstOperator::eOther: break;
+  }
+
+  assert(false);
+  return false;
+}
+
+bool ObjTypeSimd::hasConstructor(const ObjType& other) const {
+  // splat: all lanes are initialized with the given element
+  return m_element->matchesExceptQualifiers(other);
+}
+
+ObjTypeArray::ObjTypeArray(int elementCnt, shared_ptr<const ObjType> element)
+  : ObjType("raw array"), m_elementCnt(elementCnt), m_element(move(element)) {
+  assert(m_element);
+}
+
+ObjType::MatchType ObjTypeArray::match(
+  const ObjType& dst, bool isLevel0) const {
+  return dst.match2(*this, isLevel0);
+}
+
+ObjType::MatchType ObjTypeArray::match2(
+  const ObjTypeArray& src, bool /*isLevel0*/) const {
+  if (m_elementCnt != src.m_elementCnt) { return eNoMatch; }
+  // the qualifiers of the elements are those of the array, so the elements
+  // must match fully
+  if (m_element->match(*src.m_element, false) != eFullMatch) {
+    return eNoMatch;
+  }
+  return eFullMatch;
+}
+
+basic_ostream<char>& ObjTypeArray::printTo(basic_ostream<char>& os) const {
+  os << "raw[" << m_elementCnt << "]";
+  return m_element->printTo(os);
+}
+
+bool ObjTypeArray::is(ObjType::EClass /*class_*/) const {
+  return false;
+}
+
+int ObjTypeArray::size() const {
+  return m_elementCnt * m_element->size();
+}
+
+int ObjTypeArray::alignment() const {
+  return m_element->alignment();
+}
+
+llvm::Type* ObjTypeArray::llvmType() const {
+  return ArrayType::get(m_element->llvmType(), m_elementCnt);
+}
+
+bool ObjTypeArray::hasMemberFun(int op) const {
+  switch (AstOperator::classOf(static_cast<AstOperator::EOperation>(op))) {
+  case AstOperator::eAssignment: return true;
+  case AstOperator::eArithmetic:
+  case AstOperator::eLogical:
+  case AstOperator::eBitwise:
+  case AstOperator::eComparison:
+  case AstOperator::eSimd: return false;
+  case AstOperator::eMemberAccess:
+    return op == AstOperator::eAddrOf || op == AstOperator::eIndex;
+  case AstOperator::eOther: break;
+  }
+
+  assert(false);
+  return false;
+}
+
+bool ObjTypeArray::hasConstructor(const ObjType& /*other*/) const {
+  // Currently only the implicit copy constructor, which is handled by the
+  // caller.
+  return false;
+}
+
 ObjTypeFun::ObjTypeFun(
   vector<shared_ptr<const ObjType>>* args, shared_ptr<const ObjType> ret)
   : ObjType("fun") // todo: what shall the correct type name of a function be?
@@ -430,9 +692,34 @@ llvm::Type* ObjTypeFun::llvmType() const {
 
 ObjTypeCompound::ObjTypeCompound(
   string name, vector<shared_ptr<const ObjType>>&& members)
-  : ObjType(move(name)), m_members(move(members)) {
+  : ObjTypeCompound(move(name), move(members), {}, eOptimizedLayout) {
+}
+
+ObjTypeCompound::ObjTypeCompound(string name,
+  vector<shared_ptr<const ObjType>>&& members, vector<string>&& memberNames,
+  Layout layout)
+  : ObjType(move(name))
+  , m_members(move(members))
+  , m_memberNames(move(memberNames))
+  , m_layout(layout)
+  , m_fieldIndices(m_members.size()) {
+  assert(m_memberNames.empty() || m_memberNames.size() == m_members.size());
+
+  // fieldOrder[i] is the index in m_members of the data member stored in the
+  // i-th field. Sorting by descending alignment, padding is only needed at
+  // the end, to align the compound as a whole.
+  vector<unsigned> fieldOrder(m_members.size());
+  for (auto i = 0U; i < fieldOrder.size(); ++i) { fieldOrder[i] = i; }
+  if (m_layout == eOptimizedLayout) {
+    stable_sort(fieldOrder.begin(), fieldOrder.end(),
+      [&](unsigned lhs, unsigned rhs) {
+        return m_members[lhs]->alignment() > m_members[rhs]->alignment();
+      });
+  }
+  for (auto i = 0U; i < fieldOrder.size(); ++i) {
+    m_fieldIndices[fieldOrder[i]] = i;
+  }
 }
-
 ObjTypeCompound::ObjTypeCompound(string name, shared_ptr<const ObjType> member1,
   shared_ptr<const ObjType> member2, shared_ptr<const ObjType> member3)
   : ObjTypeCompound(
@@ -476,17 +763,50 @@ int ObjTypeCompound::size() const {
   return sum;
 }
 
+int ObjTypeCompound::alignment() const {
+  // a compound object is at least byte aligned
+  int max = 8;
+  for (const auto& member : m_members) {
+    max = std::max(max, member->alignment());
+  }
+  return max;
+}
+
+int ObjTypeCompound::memberIndexOf(const string& memberName) const {
+  const auto name =
+    std::find(m_memberNames.begin(), m_memberNames.end(), memberName);
+  return name == m_memberNames.end() ? -1 : name - m_memberNames.begin();
+}
+
 llvm::Type* ObjTypeCompound::llvmType() const {
-  assert(false);
-  return nullptr;
+  if (!m_llvmType) {
+    vector<Type*> fields(m_members.size());
+    for (auto i = 0U; i < m_members.size(); ++i) {
+      fields[m_fieldIndices[i]] = m_members[i]->llvmType();
+    }
+    m_llvmType = StructType::create(llvmContext, fields, name());
+  }
+  return m_llvmType;
 }
 
-bool ObjTypeCompound::hasMemberFun(int /*op*/) const {
+bool ObjTypeCompound::hasMemberFun(int op) const {
+  switch (AstOperator::classOf(static_cast<AstOperator::EOperation>(op))) {
+  case AstOperator::eAssignment: return true;
+  case AstOperator::eArithmetic:
+  case AstOperator::eLogical:
+  case AstOperator::eBitwise:
+  case AstOperator::eComparison:
+  case AstOperator::eSimd: return false;
+  case AstOperator::eMemberAccess: return op == AstOperator::eAddrOf;
+  case AstOperator::eOther: break;
+  }
+
   assert(false);
   return false;
 }
 
 bool ObjTypeCompound::hasConstructor(const ObjType& /*other*/) const {
-  assert(false);
+  // Currently only the implicit copy constructor, which is handled by the
+  // caller.
   return false;
 }
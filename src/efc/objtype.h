@@ -10,11 +10,15 @@
 class ObjTypeQuali;
 class ObjTypeFunda;
 class ObjTypePtr;
+class ObjTypeSimd;
+class ObjTypeArray;
 class ObjTypeFun;
 class ObjTypeCompound;
 class AstObject;
 namespace llvm {
 class Type;
+class StructType;
+class MDNode;
 }
 
 /** Abstract base class for all object types.
@@ -42,6 +46,7 @@ public:
     eArithmetic,
     eIntegral,
     eFloatingPoint,
+    eSigned, // arithmetic types which can represent negative values
 
     eStoredAsIntegral, // applies also to unity types
 
@@ -70,6 +75,14 @@ public:
   virtual MatchType match2(const ObjTypePtr& /*src*/, bool /*isLevel0*/) const {
     return eNoMatch;
   }
+  virtual MatchType match2(
+    const ObjTypeSimd& /*src*/, bool /*isLevel0*/) const {
+    return eNoMatch;
+  }
+  virtual MatchType match2(
+    const ObjTypeArray& /*src*/, bool /*isLevel0*/) const {
+    return eNoMatch;
+  }
   virtual MatchType match2(const ObjTypeFun& /*src*/, bool /*isLevel0*/) const {
     return eNoMatch;
   }
@@ -81,10 +94,20 @@ public:
   virtual bool is(EClass class_) const = 0;
   /** Size in bits */
   virtual int size() const = 0;
+  /** Alignment in bits. Only meaningful where size() is. Scalars are aligned
+  to their size. */
+  virtual int alignment() const { return size(); }
 
   virtual Qualifiers qualifiers() const { return eNoQualifier; }
 
   virtual llvm::Type* llvmType() const = 0;
+  /** The node within the TBAA type DAG describing this type, or nullptr if
+  accesses to objects of this type shall carry no TBAA information. Qualifiers
+  don't influence the node, since they don't change what may alias. */
+  virtual llvm::MDNode* llvmTbaaTypeNode() const { return nullptr; }
+  /** The access tag to be attached as !tbaa metadata to loads and stores of
+  objects of this type, or nullptr if llvmTbaaTypeNode() is nullptr. */
+  llvm::MDNode* llvmTbaaAccessTag() const;
 
   /** Returns true if this type has the given operator as member function.
   Assumes that the operands are of the same type, except for logical and/or,
@@ -129,12 +152,17 @@ public:
   MatchType match2(const ObjTypeQuali& src, bool isRoot) const override;
   MatchType match2(const ObjTypeFunda& src, bool isRoot) const override;
   MatchType match2(const ObjTypePtr& src, bool isRoot) const override;
+  MatchType match2(const ObjTypeSimd& src, bool isRoot) const override;
+  MatchType match2(const ObjTypeArray& src, bool isRoot) const override;
   MatchType match2(const ObjTypeFun& src, bool isRoot) const override;
+  MatchType match2(const ObjTypeCompound& src, bool isRoot) const override;
   MatchType match2Quali(const ObjType& type, bool isRoot, bool typeIsSrc) const;
 
   bool is(EClass class_) const override;
   int size() const override;
+  int alignment() const override;
   llvm::Type* llvmType() const override;
+  llvm::MDNode* llvmTbaaTypeNode() const override;
   bool hasMemberFun(int op) const override;
   bool hasConstructor(const ObjType& other) const override;
   std::shared_ptr<const ObjType> unqualifiedObjType() const override;
@@ -163,6 +191,10 @@ public:
     eInt,
     eBool,
     eDouble,
+    eInt64,
+    eUInt32,
+    eUInt64,
+    eFloat,
     eNullptr, // not itself a pointer
 
     // implemented in derived classes
@@ -184,6 +216,7 @@ public:
 
   EType type() const { return m_type; }
   llvm::Type* llvmType() const override;
+  llvm::MDNode* llvmTbaaTypeNode() const override;
 
   bool hasMemberFun(int op) const override;
   bool hasConstructor(const ObjType& other) const override;
@@ -205,7 +238,9 @@ public:
   std::basic_ostream<char>& printTo(
     std::basic_ostream<char>& os) const override;
 
+  int alignment() const override;
   llvm::Type* llvmType() const override;
+  llvm::MDNode* llvmTbaaTypeNode() const override;
 
   std::shared_ptr<const ObjType> pointee() const;
 
@@ -214,6 +249,70 @@ private:
   const std::shared_ptr<const ObjType> m_pointee;
 };
 
+/** Fixed width simd vector of fundamental objects, e.g. 4 doubles. Most
+operators operate element-wise, i.e. lane-wise; see also AstOperator::eSimd
+for the operators specific to simd types. */
+class ObjTypeSimd : public ObjType {
+public:
+  ObjTypeSimd(int laneCnt, std::shared_ptr<const ObjType> element);
+
+  MatchType match(const ObjType& dst, bool isLevel0 = true) const override;
+  using ObjType::match2;
+  MatchType match2(const ObjTypeSimd& src, bool isLevel0) const override;
+
+  std::basic_ostream<char>& printTo(
+    std::basic_ostream<char>& os) const override;
+
+  /** A simd type belongs to the arithmetic type classes of its element, but
+  it is never a scalar. */
+  bool is(EClass class_) const override;
+  int size() const override;
+  llvm::Type* llvmType() const override;
+  llvm::MDNode* llvmTbaaTypeNode() const override;
+  bool hasMemberFun(int op) const override;
+  bool hasConstructor(const ObjType& other) const override;
+
+  int laneCnt() const { return m_laneCnt; }
+  const ObjType& element() const { return *m_element; }
+  std::shared_ptr<const ObjType> elementAsSp() const { return m_element; }
+
+private:
+  const int m_laneCnt;
+  /** Guaranteed to be non-null */
+  const std::shared_ptr<const ObjType> m_element;
+};
+
+/** Compound-type/fixed size raw array, e.g. raw[4]int. The size is part of
+the type. Elements are accessed via AstOperator::eIndex. */
+class ObjTypeArray : public ObjType {
+public:
+  ObjTypeArray(int size, std::shared_ptr<const ObjType> element);
+
+  MatchType match(const ObjType& dst, bool isLevel0 = true) const override;
+  using ObjType::match2;
+  MatchType match2(const ObjTypeArray& src, bool isLevel0) const override;
+
+  std::basic_ostream<char>& printTo(
+    std::basic_ostream<char>& os) const override;
+
+  bool is(EClass class_) const override;
+  int size() const override;
+  int alignment() const override;
+  llvm::Type* llvmType() const override;
+  bool hasMemberFun(int op) const override;
+  bool hasConstructor(const ObjType& other) const override;
+
+  /** Number of elements. Not to be confused with size(), which is in bits */
+  int elementCnt() const { return m_elementCnt; }
+  const ObjType& element() const { return *m_element; }
+  std::shared_ptr<const ObjType> elementAsSp() const { return m_element; }
+
+private:
+  const int m_elementCnt;
+  /** Guaranteed to be non-null */
+  const std::shared_ptr<const ObjType> m_element;
+};
+
 /** Compound-type/function */
 class ObjTypeFun : public ObjType {
 public:
@@ -248,11 +347,22 @@ private:
   const std::shared_ptr<const ObjType> m_ret;
 };
 
-/** for example user defined class */
+/** for example user defined class.
+
+The data members are laid out in memory sorted by descending alignment, which
+minimizes the padding between them. The relative order of data members with
+equal alignment is kept. With eFixedLayout, the data members are laid out in
+declaration order instead, e.g. to match an externally given layout. */
 class ObjTypeCompound : public ObjType {
 public:
+  enum Layout { eOptimizedLayout, eFixedLayout };
+
   ObjTypeCompound(
     std::string name, std::vector<std::shared_ptr<const ObjType>>&& members);
+  /** memberNames is either empty or has one name per member */
+  ObjTypeCompound(std::string name,
+    std::vector<std::shared_ptr<const ObjType>>&& members,
+    std::vector<std::string>&& memberNames, Layout layout);
   ObjTypeCompound(std::string name,
     std::shared_ptr<const ObjType> member1 = nullptr,
     std::shared_ptr<const ObjType> member2 = nullptr,
@@ -274,11 +384,29 @@ public:
   bool hasConstructor(const ObjType& other) const override;
   bool is(EClass class_) const override;
   int size() const override;
+  int alignment() const override;
 
   const std::vector<std::shared_ptr<const ObjType>>& members() const {
     return m_members;
   }
+  Layout layout() const { return m_layout; }
+  /** Index of the data member with the given name in members(), or -1 if
+  there is no such data member */
+  int memberIndexOf(const std::string& memberName) const;
+  /** Index of the field within llvmType() which stores the data member with
+  the given index in members() */
+  unsigned fieldIndexOf(int memberIndex) const {
+    return m_fieldIndices.at(memberIndex);
+  }
 
 private:
   const std::vector<std::shared_ptr<const ObjType>> m_members;
+  /** Empty or parallel to m_members */
+  const std::vector<std::string> m_memberNames;
+  const Layout m_layout;
+  /** Parallel to m_members, see fieldIndexOf */
+  std::vector<unsigned> m_fieldIndices;
+  /** Created on first request, since the type is named and thus must be
+  unique within the LLVM context */
+  mutable llvm::StructType* m_llvmType = nullptr;
 };
@@ -76,7 +76,7 @@ Parser::symbol_type Parser::makeToken(Parser::token_type tt) {
   case SVTInvalid: assert(false); // fall through
   case SVTVoid: return Parser::symbol_type(tt, Parser::location_type{});
   case SVTFundamentalType: return makeTokenT<ObjTypeFunda::EType>(tt);
-  case SVTString: return makeTokenT<string>(tt);
+  case SVTString: return makeTokenT<string_view>(tt);
   case SVTNumberToken: return makeTokenT<NumberToken>(tt);
   }
   assert(false);
@@ -139,12 +139,19 @@ void Parser::initTokenAttrs() {
     {Parser::token::TOK_OR, {"OR", SVTVoid, TKComponentOrAmbigous}},
     {Parser::token::TOK_PIPE_PIPE, {"PIPE_PIPE", SVTVoid, TKComponentOrAmbigous}},
     {Parser::token::TOK_EQUAL_EQUAL, {"EQUAL_EQUAL", SVTVoid, TKComponentOrAmbigous}},
+    {Parser::token::TOK_LESS, {"LESS", SVTVoid, TKComponentOrAmbigous}},
+    {Parser::token::TOK_LESS_LESS, {"LESS_LESS", SVTVoid, TKComponentOrAmbigous}},
+    {Parser::token::TOK_GREATER_GREATER, {"GREATER_GREATER", SVTVoid, TKComponentOrAmbigous}},
+    {Parser::token::TOK_PIPE, {"PIPE", SVTVoid, TKComponentOrAmbigous}},
+    {Parser::token::TOK_CARET, {"CARET", SVTVoid, TKComponentOrAmbigous}},
     {Parser::token::TOK_LPAREN_EQUAL, {"LPAREN_LPAREN", SVTVoid, TKSeparator}},
     {Parser::token::TOK_SLASH, {"SLASH", SVTVoid, TKComponentOrAmbigous}},
     {Parser::token::TOK_LPAREN, {"LPAREN", SVTVoid, TKStarter}},
     {Parser::token::TOK_RPAREN, {"RPAREN", SVTVoid, TKDelimiter}},
     {Parser::token::TOK_LBRACE, {"LBRACE", SVTVoid, TKStarter}},
     {Parser::token::TOK_RBRACE, {"RBRACE", SVTVoid, TKDelimiter}},
+    {Parser::token::TOK_LBRACKET, {"LBRACKET", SVTVoid, TKStarter}},
+    {Parser::token::TOK_RBRACKET, {"RBRACKET", SVTVoid, TKDelimiter}},
     {Parser::token::TOK_ARROW, {"ARROW", SVTVoid, TKComponentOrAmbigous}},
     {Parser::token::TOK_FUNDAMENTAL_TYPE, {"FUNDAMENTAL_TYPE", SVTFundamentalType, TKComponentOrAmbigous}},
     {Parser::token::TOK_OP_NAME, {"OP_NAME", SVTString, TKStarter}},
@@ -154,6 +161,7 @@ void Parser::initTokenAttrs() {
     {Parser::token::TOK_STATIC, {"STATIC", SVTVoid, TKSeparator}},
     {Parser::token::TOK_LOCAL, {"LOCAL", SVTVoid, TKSeparator}},
     {Parser::token::TOK_NOINIT, {"NOINIT", SVTVoid, TKSeparator}},
+    {Parser::token::TOK_SIMD, {"SIMD", SVTVoid, TKComponentOrAmbigous}},
     {Parser::token::TOK_NUMBER, {"NUMBER", SVTNumberToken, TKComponentOrAmbigous}}};
   // clang-format on
   for (const auto& kv : m) { m_TokenAttrs.at(kv.first) = kv.second; }
@@ -164,6 +172,8 @@ void Parser::initTokenAttrs() {
   // not a 'real' token, only used for %precedence
   m_TokenAttrs.at(Parser::token::TOK_ASSIGNEMENT) =
     TokenTypeAttr{"<UNUSED_BY_BISON>", SVTInvalid, TKComponentOrAmbigous};
+  m_TokenAttrs.at(Parser::token::TOK_ADDROF) =
+    TokenTypeAttr{"<UNUSED_BY_BISON>", SVTInvalid, TKComponentOrAmbigous};
   for (auto i = 0U; i < Parser::token::TOK_TOKENLISTEND; ++i) {
     if (!m_TokenAttrs.at(i).m_name) {
       cerr << "token " << i << " has no been given a name. Update the "
@@ -8,11 +8,11 @@
 class Position {
 public:
   explicit Position(
-    std::string* f = nullptr, unsigned int l = 1u, unsigned int c = 1u)
+    const std::string* f = nullptr, unsigned int l = 1u, unsigned int c = 1u)
     : m_fileName{f}, m_line{l}, m_column{c} {}
 
   void initialize(
-    std::string* fn = nullptr, unsigned int l = 1u, unsigned int c = 1u) {
+    const std::string* fn = nullptr, unsigned int l = 1u, unsigned int c = 1u) {
     m_fileName = fn;
     m_line = l;
     m_column = c;
@@ -34,7 +34,7 @@ public:
   }
 
   /** File name to which this position refers. */
-  std::string* m_fileName;
+  const std::string* m_fileName;
   /** Current line number. */
   unsigned int m_line;
   /** Current column number. */
@@ -0,0 +1,455 @@
+#include "rangeanalizer.h"
+
+#include "ast.h"
+#include "asttraversal.h"
+#include "nopastvisitor.h"
+#include "objtype.h"
+#include "stackgrowth.h"
+
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+
+namespace {
+const long long s_intMin = INT_MIN;
+const long long s_intMax = INT_MAX;
+
+/** Follows the chain of ObjectDelegate's, returning the Object at its end */
+const Object& underlyingObjectOf(const Object& obj) {
+  const Object* res = &obj;
+  while (const auto delegate = dynamic_cast<const ObjectDelegate*>(res)) {
+    res = &delegate->referencedObj();
+  }
+  return *res;
+}
+
+/** Collects the objects whose address is taken anywhere in the AST */
+class AddrTakenCollector : public NopAstVisitor {
+public:
+  AddrTakenCollector(set<const Object*>& addrTakenObjects)
+    : m_addrTakenObjects{addrTakenObjects} {}
+
+  void visit(AstOperator& op) override {
+    if (op.op() == AstOperator::eAddrOf) {
+      m_addrTakenObjects.insert(
+        &underlyingObjectOf(*op.args().childs().front()));
+    }
+  }
+
+private:
+  set<const Object*>& m_addrTakenObjects;
+};
+
+/** True if evaluating the given expression can't modify any object. Calls are
+regarded as pure, since they can't modify local objects whose address is never
+taken, which are the only ones RangeAnalizer tracks. Uses an explicit stack,
+since expressions can be nested arbitrarily deep. */
+bool isPure(const AstObject& root) {
+  vector<const AstObject*> pending{&root};
+  while (!pending.empty()) {
+    const auto& expr = *pending.back();
+    pending.pop_back();
+    if (dynamic_cast<const AstNumber*>(&expr) ||
+      dynamic_cast<const AstSymbol*>(&expr)) {
+      continue;
+    }
+    const AstCtList* args = nullptr;
+    if (const auto op = dynamic_cast<const AstOperator*>(&expr)) {
+      if (op->class_() == AstOperator::eAssignment) { return false; }
+      args = &op->args();
+    }
+    else if (const auto cast = dynamic_cast<const AstCast*>(&expr)) {
+      args = &cast->args();
+    }
+    else if (const auto funCall = dynamic_cast<const AstFunCall*>(&expr)) {
+      args = &funCall->args();
+    }
+    else {
+      return false;
+    }
+    const auto& childs = args->childs();
+    pending.insert(pending.end(), childs.begin(), childs.end());
+  }
+  return true;
+}
+}
+
+bool RangeAnalizer::Range::isUnbounded() const {
+  return m_min <= s_intMin && m_max >= s_intMax;
+}
+
+void RangeAnalizer::analyze(AstNode& root) {
+  AddrTakenCollector addrTakenCollector{m_addrTakenObjects};
+  AstTraversal{&addrTakenCollector}(root);
+
+  m_state.clear();
+  root.accept(*this);
+}
+
+void RangeAnalizer::visit(AstNop& /*nop*/) {
+}
+
+void RangeAnalizer::visit(AstBlock& block) {
+  block.body().accept(*this);
+}
+
+void RangeAnalizer::visit(AstCast& cast) {
+  cast.args().accept(*this);
+}
+
+void RangeAnalizer::visit(AstCtList& ctList) {
+  for (const auto& child : ctList.childs()) { child->accept(*this); }
+}
+
+void RangeAnalizer::visit(AstOperator& op) {
+  const auto& args = op.args().childs();
+
+  // An operand is only evaluated if all operands before evaluated to true /
+  // false respectively
+  if (op.isLogicalShortCircuit()) {
+    const auto isAnd = op.op() == AstOperator::eAnd;
+    args.front()->accept(*this);
+    auto shortCircuited = refine(m_state, *args.front(), !isAnd);
+    m_state = refine(m_state, *args.front(), isAnd);
+    for (auto arg = next(args.begin()); arg != args.end(); ++arg) {
+      (*arg)->accept(*this);
+      if (*arg == args.back()) { break; }
+      shortCircuited = join(shortCircuited, refine(m_state, **arg, !isAnd));
+      m_state = refine(m_state, **arg, isAnd);
+    }
+    m_state = join(shortCircuited, m_state);
+    return;
+  }
+
+  op.args().accept(*this);
+
+  if (op.class_() == AstOperator::eAssignment) {
+    if (const auto obj = trackableObjectOf(*args.front())) {
+      setRange(*obj, rangeOf(*args.back(), m_state));
+    }
+  }
+  else if (op.op() == AstOperator::eIndex) {
+    const auto& array = static_cast<const ObjTypeArray&>(
+      *args.front()->objType().unqualifiedObjType());
+    const auto index = rangeOf(*args.back(), m_state);
+    op.setIndexIsProvablyInRange(
+      index.m_min >= 0 && index.m_max < array.elementCnt());
+  }
+}
+
+void RangeAnalizer::visit(AstSeq& seq) {
+  for (const auto& operand : seq.operands()) { operand->accept(*this); }
+}
+
+void RangeAnalizer::visit(AstNumber& /*number*/) {
+}
+
+void RangeAnalizer::visit(AstSymbol& /*symbol*/) {
+}
+
+void RangeAnalizer::visit(AstFunCall& funCall) {
+  funCall.address().accept(*this);
+  funCall.args().accept(*this);
+}
+
+void RangeAnalizer::visit(AstFunDef& funDef) {
+  if (funDef.isHostFunction()) { return; }
+
+  // The locals of the enclosing function are not accessible from within the
+  // body
+  const auto enclosingState = move(m_state);
+  m_state.clear();
+  funDef.body().accept(*this);
+  m_state = enclosingState;
+}
+
+void RangeAnalizer::visit(AstDataDef& dataDef) {
+  if (dataDef.declaredStorageDuration() == StorageDuration::eMember) { return; }
+  dataDef.ctorArgs().accept(*this);
+  if (const auto obj = trackableObjectOf(dataDef)) {
+    const auto& ctorArgs = dataDef.ctorArgs().childs();
+    setRange(*obj, dataDef.doNotInit() || ctorArgs.empty()
+        ? Range{s_intMin, s_intMax}
+        : rangeOf(*ctorArgs.front(), m_state));
+  }
+}
+
+void RangeAnalizer::visit(AstIf& if_) {
+  if_.condition().accept(*this);
+  const auto afterCond = m_state;
+
+  m_state = refine(afterCond, if_.condition(), true);
+  if_.action().accept(*this);
+  const auto afterThen = m_state;
+
+  m_state = refine(afterCond, if_.condition(), false);
+  if (if_.elseAction()) { if_.elseAction()->accept(*this); }
+
+  // A branch which doesn't return doesn't contribute to the state after the
+  // if expression
+  if (if_.action().isObjTypeNoReturn()) {
+    // nop - m_state is already the state after the else branch
+  }
+  else if (if_.elseAction() && if_.elseAction()->objType().isNoreturn()) {
+    m_state = afterThen;
+  }
+  else {
+    m_state = join(afterThen, m_state);
+  }
+}
+
+void RangeAnalizer::visit(AstLoop& loop) {
+  // Iterate until the state at the loop's head is stable. Note that index
+  // operators within the loop are decided anew in each iteration, so the last
+  // iteration, which is based on the stable state, wins.
+  const auto entry = m_state;
+  auto head = entry;
+  while (true) {
+    m_state = head;
+    loop.condition().accept(*this);
+    const auto afterCond = m_state;
+    m_state = refine(afterCond, loop.condition(), true);
+    loop.body().accept(*this);
+    const auto newHead = loop.body().isObjTypeNoReturn()
+      ? head
+      : widen(head, join(entry, m_state));
+    if (newHead == head) {
+      m_state = refine(afterCond, loop.condition(), false);
+      break;
+    }
+    head = newHead;
+  }
+}
+
+void RangeAnalizer::visit(AstReturn& return_) {
+  return_.ctorArgs().accept(*this);
+}
+
+void RangeAnalizer::visit(AstRawNew& rawNew) {
+  rawNew.args().accept(*this);
+}
+
+void RangeAnalizer::visit(AstRawDelete& rawDelete) {
+  rawDelete.ptr().accept(*this);
+}
+
+void RangeAnalizer::visit(AstMemberAccess& memberAccess) {
+  memberAccess.obj().accept(*this);
+}
+
+void RangeAnalizer::visit(AstObjTypeSymbol& /*symbol*/) {
+}
+
+void RangeAnalizer::visit(AstObjTypeQuali& /*quali*/) {
+}
+
+void RangeAnalizer::visit(AstObjTypePtr& /*ptr*/) {
+}
+
+void RangeAnalizer::visit(AstObjTypeSimd& /*simd*/) {
+}
+
+void RangeAnalizer::visit(AstObjTypeArray& /*array*/) {
+}
+
+void RangeAnalizer::visit(AstClassDef& /*class_*/) {
+}
+
+/** Returns the object denoted by the given expression if it's value range is
+tracked, or nullptr otherwise. */
+const Object* RangeAnalizer::trackableObjectOf(const AstObject& expr) const {
+  static const ObjTypeFunda intObjType{ObjTypeFunda::eInt};
+  const auto& obj = underlyingObjectOf(expr);
+  if (obj.storageDuration() != StorageDuration::eLocal ||
+    !obj.objType().matchesExceptQualifiers(intObjType) ||
+    m_addrTakenObjects.count(&obj)) {
+    return nullptr;
+  }
+  return &obj;
+}
+
+void RangeAnalizer::setRange(const Object& obj, Range range) {
+  if (range.isUnbounded()) { m_state.erase(&obj); }
+  else {
+    m_state[&obj] = range;
+  }
+}
+
+/** Returns the range of the value of the given expression, given the state
+before its evaluation. Only pure expressions being composed of int literals,
+symbols and additive operators are taken into account; for all others an
+unbounded range is returned. */
+RangeAnalizer::Range RangeAnalizer::rangeOf(
+  const AstObject& expr, const State& state) const {
+  static const ObjTypeFunda intObjType{ObjTypeFunda::eInt};
+  const Range unbounded{s_intMin, s_intMax};
+  if (!expr.objType().matchesExceptQualifiers(intObjType)) { return unbounded; }
+
+  if (const auto number = dynamic_cast<const AstNumber*>(&expr)) {
+    const auto value = static_cast<long long>(number->value());
+    return Range{value, value};
+  }
+  if (dynamic_cast<const AstSymbol*>(&expr)) {
+    const auto obj = trackableObjectOf(expr);
+    const auto i = obj ? state.find(obj) : state.end();
+    return i != state.end() ? i->second : unbounded;
+  }
+  const auto op = dynamic_cast<const AstOperator*>(&expr);
+  if (!op || op->args().childs().size() < 2 ||
+    (op->op() != AstOperator::eAdd && op->op() != AstOperator::eSub)) {
+    return unbounded;
+  }
+  // n-ary additions are combined left to right, see AstOperator::isNAry
+  const auto& args = op->args().childs();
+  // arbitrarily deeply nested additions recurse, see callWithSufficientStack
+  auto res =
+    callWithSufficientStack([&] { return rangeOf(*args.front(), state); });
+  for (auto arg = next(args.begin()); arg != args.end(); ++arg) {
+    const auto lhs = res;
+    const auto rhs =
+      callWithSufficientStack([&] { return rangeOf(**arg, state); });
+    if (lhs.isUnbounded() || rhs.isUnbounded()) { return unbounded; }
+    res = op->op() == AstOperator::eAdd
+      ? Range{lhs.m_min + rhs.m_min, lhs.m_max + rhs.m_max}
+      : Range{lhs.m_min - rhs.m_max, lhs.m_max - rhs.m_min};
+    // int arithmetic wraps around, so the range would no longer be contiguous
+    if (res.m_min < s_intMin || res.m_max > s_intMax) { return unbounded; }
+  }
+  return res;
+}
+
+/** Returns the given state, narrowed by the knowledge that the given
+condition, evaluated in that state, yielded isTrue. */
+RangeAnalizer::State RangeAnalizer::refine(
+  State state, const AstObject& cond, bool isTrue) const {
+  // If the condition modified objects, the knowledge gained by a part of it
+  // might be stale after evaluating the whole condition
+  if (isPure(cond)) { refinePure(state, cond, isTrue); }
+  return state;
+}
+
+void RangeAnalizer::refinePure(
+  State& state, const AstObject& cond, bool isTrue) const {
+  // conditions can be nested arbitrarily deep, see callWithSufficientStack
+  const auto refineChild = [this](State& childState, const AstObject& child,
+                             bool childIsTrue) {
+    callWithSufficientStack(
+      [&] { refinePure(childState, child, childIsTrue); });
+  };
+
+  // branch hints evaluate to their first argument
+  if (const auto funCall = dynamic_cast<const AstFunCall*>(&cond)) {
+    const auto builtin = funCall->builtin();
+    if (builtin == AstFunCall::eLikely || builtin == AstFunCall::eUnlikely ||
+      builtin == AstFunCall::eExpectTrips) {
+      refineChild(state, *funCall->args().childs().front(), isTrue);
+    }
+    return;
+  }
+  const auto op = dynamic_cast<const AstOperator*>(&cond);
+  if (!op) { return; }
+  const auto& args = op->args().childs();
+  switch (op->op()) {
+  case AstOperator::eNot: refineChild(state, *args.front(), !isTrue); break;
+
+  case AstOperator::eAnd:
+  case AstOperator::eOr: {
+    // For 'and' being true, respectively 'or' being false, all operands
+    // evaluated to isTrue. Else one operand evaluated to isTrue, and all
+    // operands before it to !isTrue.
+    const auto isAnd = op->op() == AstOperator::eAnd;
+    if (isAnd == isTrue) {
+      for (const auto arg : args) { refineChild(state, *arg, isTrue); }
+    }
+    else {
+      auto res = state;
+      refineChild(res, *args.front(), isTrue);
+      auto beforeArg = state;
+      refineChild(beforeArg, *args.front(), !isTrue);
+      for (auto arg = next(args.begin()); arg != args.end(); ++arg) {
+        auto viaArg = beforeArg;
+        refineChild(viaArg, **arg, isTrue);
+        res = join(res, viaArg);
+        refineChild(beforeArg, **arg, !isTrue);
+      }
+      state = res;
+    }
+    break;
+  }
+
+  case AstOperator::eLess: {
+    const auto& lhs = *args.front();
+    const auto& rhs = *args.back();
+    const auto lhsRange = rangeOf(lhs, state);
+    const auto rhsRange = rangeOf(rhs, state);
+    if (isTrue) {
+      narrow(state, lhs, Range{s_intMin, rhsRange.m_max - 1});
+      narrow(state, rhs, Range{lhsRange.m_min + 1, s_intMax});
+    }
+    else {
+      narrow(state, lhs, Range{rhsRange.m_min, s_intMax});
+      narrow(state, rhs, Range{s_intMin, lhsRange.m_max});
+    }
+    break;
+  }
+
+  case AstOperator::eEqualTo:
+    if (isTrue) {
+      const auto lhsRange = rangeOf(*args.front(), state);
+      const auto rhsRange = rangeOf(*args.back(), state);
+      narrow(state, *args.front(), rhsRange);
+      narrow(state, *args.back(), lhsRange);
+    }
+    break;
+
+  default: break;
+  }
+}
+
+/** If the given expression is a symbol denoting a tracked object, narrows the
+object's range in the given state to the given bound. */
+void RangeAnalizer::narrow(
+  State& state, const AstObject& expr, Range bound) const {
+  if (!dynamic_cast<const AstSymbol*>(&expr)) { return; }
+  const auto obj = trackableObjectOf(expr);
+  if (!obj) { return; }
+  const auto i = state.find(obj);
+  auto range = i != state.end() ? i->second : Range{s_intMin, s_intMax};
+  range.m_min = max(range.m_min, bound.m_min);
+  range.m_max = min(range.m_max, bound.m_max);
+  if (range.isUnbounded()) { state.erase(obj); }
+  else {
+    state[obj] = range;
+  }
+}
+
+/** The state after a merge of two control flow paths: Only what is known on
+both paths is known afterwards. */
+RangeAnalizer::State RangeAnalizer::join(const State& lhs, const State& rhs) {
+  State res;
+  for (const auto& kv : lhs) {
+    const auto i = rhs.find(kv.first);
+    if (i == rhs.end()) { continue; }
+    res[kv.first] = Range{min(kv.second.m_min, i->second.m_min),
+      max(kv.second.m_max, i->second.m_max)};
+  }
+  return res;
+}
+
+/** Like join, but each bound that would need to grow is dropped entirely.
+That garantees that iterating a loop until its head state is stable
+terminates. */
+RangeAnalizer::State RangeAnalizer::widen(
+  const State& old, const State& new_) {
+  State res;
+  for (const auto& kv : old) {
+    const auto i = new_.find(kv.first);
+    if (i == new_.end()) { continue; }
+    const Range range{
+      i->second.m_min < kv.second.m_min ? s_intMin : kv.second.m_min,
+      i->second.m_max > kv.second.m_max ? s_intMax : kv.second.m_max};
+    if (!range.isUnbounded()) { res[kv.first] = range; }
+  }
+  return res;
+}
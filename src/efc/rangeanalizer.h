@@ -0,0 +1,72 @@
+#pragma once
+#include "astvisitor.h"
+
+#include <map>
+#include <set>
+
+class Object;
+
+/** Decides for each index operator whether its index is provably within the
+bounds of the indexed array, see AstOperator::isIndexProvablyInRange.
+
+Does so by tracking the value ranges of local int objects along the control
+flow, taking into account initializations, assignments and the conditions of
+if and while expressions. Loops are iterated until the ranges are stable, where
+widening guarantees termination. Objects whose address is taken are not
+tracked, since they might be modified via a pointer.
+
+\pre SemanticAnalizer must have massaged the AST */
+class RangeAnalizer : private AstVisitor {
+public:
+  void analyze(AstNode& root);
+
+private:
+  /** Closed interval [m_min, m_max] of values an int object can have */
+  struct Range {
+    long long m_min;
+    long long m_max;
+
+    bool operator==(const Range& rhs) const {
+      return m_min == rhs.m_min && m_max == rhs.m_max;
+    }
+    bool isUnbounded() const;
+  };
+  /** Objects not contained have an unknown value, i.e. an unbounded range */
+  using State = std::map<const Object*, Range>;
+
+  void visit(AstNop& nop) override;
+  void visit(AstBlock& block) override;
+  void visit(AstCast& cast) override;
+  void visit(AstCtList& ctList) override;
+  void visit(AstOperator& op) override;
+  void visit(AstSeq& seq) override;
+  void visit(AstNumber& number) override;
+  void visit(AstSymbol& symbol) override;
+  void visit(AstFunCall& funCall) override;
+  void visit(AstFunDef& funDef) override;
+  void visit(AstDataDef& dataDef) override;
+  void visit(AstIf& if_) override;
+  void visit(AstLoop& loop) override;
+  void visit(AstReturn& return_) override;
+  void visit(AstRawNew& rawNew) override;
+  void visit(AstRawDelete& rawDelete) override;
+  void visit(AstMemberAccess& memberAccess) override;
+  void visit(AstObjTypeSymbol& symbol) override;
+  void visit(AstObjTypeQuali& quali) override;
+  void visit(AstObjTypePtr& ptr) override;
+  void visit(AstObjTypeSimd& simd) override;
+  void visit(AstObjTypeArray& array) override;
+  void visit(AstClassDef& class_) override;
+
+  const Object* trackableObjectOf(const AstObject& expr) const;
+  void setRange(const Object& obj, Range range);
+  Range rangeOf(const AstObject& expr, const State& state) const;
+  State refine(State state, const AstObject& cond, bool isTrue) const;
+  void refinePure(State& state, const AstObject& cond, bool isTrue) const;
+  void narrow(State& state, const AstObject& expr, Range bound) const;
+  static State join(const State& lhs, const State& rhs);
+  static State widen(const State& old, const State& new_);
+
+  State m_state;
+  std::set<const Object*> m_addrTakenObjects;
+};
@@ -0,0 +1,107 @@
+#include "runtime.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+using namespace std;
+
+namespace {
+
+/** Granularity of the size classes, also the alignment of all storage */
+constexpr uint64_t sizeClassGranularity = 16;
+constexpr uint64_t sizeClassCnt = 16;
+/** Objects larger than that are not pooled */
+constexpr uint64_t maxPooledSize = sizeClassCnt * sizeClassGranularity;
+/** Size of the chunks from which free lists and the arena are refilled */
+constexpr uint64_t chunkSize = 64 * 1024;
+
+struct FreeBlock {
+  FreeBlock* m_next;
+};
+
+struct Arena {
+  /** Storage of the current chunk not yet handed out */
+  char* m_begin = nullptr;
+  char* m_end = nullptr;
+  std::vector<std::unique_ptr<char[]>> m_chunks;
+};
+
+thread_local FreeBlock* freeLists[sizeClassCnt] = {};
+thread_local Arena arena;
+
+uint64_t roundUpToGranularity(uint64_t size) {
+  return (max<uint64_t>(size, 1) + sizeClassGranularity - 1) &
+    ~(sizeClassGranularity - 1);
+}
+
+uint64_t sizeClassOf(uint64_t size) {
+  return roundUpToGranularity(size) / sizeClassGranularity - 1;
+}
+
+/** Carves a new chunk into blocks of the given size class and puts them on
+that class' free list. Pooled chunks live as long as the process. */
+void refillFreeList(uint64_t sizeClass) {
+  const auto blockSize = (sizeClass + 1) * sizeClassGranularity;
+  const auto chunk = static_cast<char*>(malloc(chunkSize));
+  if (!chunk) { abort(); }
+  auto& freeList = freeLists[sizeClass];
+  for (auto block = chunk; block + blockSize <= chunk + chunkSize;
+       block += blockSize) {
+    freeList = new (block) FreeBlock{freeList};
+  }
+}
+}
+
+void* efrt_alloc(uint64_t size) {
+  if (size > maxPooledSize) {
+    const auto ptr = malloc(size);
+    if (!ptr) { abort(); }
+    return ptr;
+  }
+  const auto sizeClass = sizeClassOf(size);
+  auto& freeList = freeLists[sizeClass];
+  if (!freeList) { refillFreeList(sizeClass); }
+  const auto block = freeList;
+  freeList = block->m_next;
+  return block;
+}
+
+void efrt_free(void* ptr, uint64_t size) {
+  if (!ptr) { return; }
+  if (size > maxPooledSize) {
+    free(ptr);
+    return;
+  }
+  auto& freeList = freeLists[sizeClassOf(size)];
+  freeList = new (ptr) FreeBlock{freeList};
+}
+
+void* efrt_arena_alloc(uint64_t size) {
+  size = roundUpToGranularity(size);
+  if (static_cast<uint64_t>(arena.m_end - arena.m_begin) < size) {
+    const auto newChunkSize = max(size, chunkSize);
+    arena.m_chunks.emplace_back(new char[newChunkSize]);
+    arena.m_begin = arena.m_chunks.back().get();
+    arena.m_end = arena.m_begin + newChunkSize;
+  }
+  const auto ptr = arena.m_begin;
+  arena.m_begin += size;
+  return ptr;
+}
+
+void efrt_arena_release() {
+  arena.m_chunks.clear();
+  arena.m_begin = nullptr;
+  arena.m_end = nullptr;
+}
+
+const vector<pair<string, void*>>& runtimeSymbols() {
+  static const vector<pair<string, void*>> symbols{
+    {"efrt_alloc", reinterpret_cast<void*>(&efrt_alloc)},
+    {"efrt_free", reinterpret_cast<void*>(&efrt_free)},
+    {"efrt_arena_alloc", reinterpret_cast<void*>(&efrt_arena_alloc)},
+    {"efrt_arena_release", reinterpret_cast<void*>(&efrt_arena_release)}};
+  return symbols;
+}
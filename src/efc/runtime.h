@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** The EF runtime library. Generated code calls these functions, e.g. to
+implement raw_new and raw_delete, see IrGen. They are part of the compiler's
+process; the JIT resolves calls to them via runtimeSymbols().
+
+The pooled allocator serves small objects from thread-local free lists, one
+per size class; storage of larger objects comes directly from malloc. Freed
+storage goes back to the free list of the thread calling efrt_free. The arena
+allocator bump-allocates from thread-local chunks; individual objects are
+never freed, efrt_arena_release releases all of the calling thread's arena
+storage at once. */
+extern "C" {
+void* efrt_alloc(uint64_t size);
+/** size must be the one passed to efrt_alloc. ptr may be null. */
+void efrt_free(void* ptr, uint64_t size);
+void* efrt_arena_alloc(uint64_t size);
+void efrt_arena_release();
+}
+
+/** Name and address of each function of the runtime library */
+const std::vector<std::pair<std::string, void*>>& runtimeSymbols();
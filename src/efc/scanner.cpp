@@ -2,8 +2,12 @@
 
 #include "errorhandler.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <cerrno>
-#include <cstdio>
 #include <stdexcept>
 #include <string.h>
 #include <utility>
@@ -14,12 +18,15 @@ using namespace std;
 YY_DECL;
 
 // defined purely by generated parser
-extern FILE* yyin;
+extern yy_buffer_state* yy_scan_buffer(char* base, size_t size);
 // defined purely by generated parser
-extern void yyrestart(FILE*);
+extern void yy_delete_buffer(yy_buffer_state* b);
 
-// defined in configuration of generated scanner (genscanner.l).
-extern Location& locOfGenScanner();
+namespace {
+/** The generated scanner requires the buffer to end with two NUL characters,
+see yy_scan_buffer */
+constexpr size_t paddingSize = 2;
+}
 
 weak_ptr<Scanner> Scanner::sm_instance{};
 
@@ -32,31 +39,189 @@ shared_ptr<Scanner> Scanner::create(
   return instance;
 }
 
+shared_ptr<Scanner> Scanner::create(
+  string fileName, string_view source, ErrorHandler& errorHandler) {
+  assert(sm_instance.expired());
+  auto instance = shared_ptr<Scanner>{
+    new Scanner{move(fileName), source, errorHandler}, Deleter()};
+  sm_instance = instance;
+  return instance;
+}
+
 Scanner::Scanner(string fileName, ErrorHandler& errorHandler)
-  : m_fileName{move(fileName)}
+  : m_sourceFile{move(fileName)}
+  , m_errorHandler{errorHandler}
+  , m_buffer{nullptr}
+  , m_sourceSize{0}
+  , m_mappedSize{0}
+  , m_bufferState{nullptr} {
+  // stdin is only read on the first pop, so merely creating a Scanner, e.g. a
+  // Driver which is never asked to compile, doesn't block on an open stdin
+  if (!isReadingStdin()) {
+    mapFile();
+    startScanning();
+  }
+}
+
+Scanner::Scanner(
+  string fileName, string_view source, ErrorHandler& errorHandler)
+  : m_sourceFile{move(fileName)}
   , m_errorHandler{errorHandler}
-  , m_opened_yyin{false} {
-  if (m_fileName.empty() || m_fileName == "-") { yyin = stdin; }
-  else {
-    if (!(yyin = fopen(m_fileName.c_str(), "r"))) {
+  , m_buffer{nullptr}
+  , m_sourceSize{0}
+  , m_mappedSize{0}
+  , m_bufferState{nullptr} {
+  copySource(source);
+  startScanning();
+}
+
+void Scanner::startScanning() {
+  // Tokens refer to the source by 32 bit offsets, see Token
+  if (m_sourceSize > UINT32_MAX) {
+    Error::throwError(m_errorHandler, Error::eCantOpenFileForReading,
+      Location{}, m_sourceFile.name(), strerror(EFBIG));
+  }
+
+  m_sourceFile.setSource(string_view{m_buffer, m_sourceSize});
+
+  m_bufferState = yy_scan_buffer(m_buffer, m_sourceSize + paddingSize);
+  assert(m_bufferState);
+}
+
+void Scanner::mapFile() {
+  const auto fd = open(m_sourceFile.name().c_str(), O_RDONLY);
+  if (fd == -1) {
+    Error::throwError(m_errorHandler, Error::eCantOpenFileForReading,
+      Location{}, m_sourceFile.name(), strerror(errno));
+  }
+  struct stat fileStatus {};
+  if (fstat(fd, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode)) {
+    readAll(fd);
+    close(fd);
+    return;
+  }
+
+  // Reserve zeroed memory for the source plus padding, and map the file over
+  // its start. The mapping must be writable, since the generated scanner
+  // temporarily terminates the current token with a NUL. Being private, only
+  // the pages actually written to are copied.
+  const auto sourceSize = static_cast<size_t>(fileStatus.st_size);
+  const auto mappedSize = sourceSize + paddingSize;
+  auto addr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE,
+    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (addr != MAP_FAILED && sourceSize > 0 &&
+    mmap(addr, sourceSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd,
+      0) == MAP_FAILED) {
+    munmap(addr, mappedSize);
+    addr = MAP_FAILED;
+  }
+  if (addr == MAP_FAILED) {
+    readAll(fd);
+    close(fd);
+    return;
+  }
+  close(fd);
+  m_buffer = static_cast<char*>(addr);
+  m_sourceSize = sourceSize;
+  m_mappedSize = mappedSize;
+}
+
+void Scanner::readAll(int fd) {
+  constexpr size_t chunkSize = 64 * 1024;
+  m_ownedBuffer.clear();
+  for (;;) {
+    const auto oldSize = m_ownedBuffer.size();
+    m_ownedBuffer.resize(oldSize + chunkSize);
+    const auto readSize = read(fd, &m_ownedBuffer[oldSize], chunkSize);
+    if (readSize < 0 && errno == EINTR) {
+      m_ownedBuffer.resize(oldSize);
+      continue;
+    }
+    if (readSize < 0) {
       Error::throwError(m_errorHandler, Error::eCantOpenFileForReading,
-        Location{}, m_fileName, strerror(errno));
+        Location{}, m_sourceFile.name(), strerror(errno));
     }
-    m_opened_yyin = true;
+    m_ownedBuffer.resize(oldSize + static_cast<size_t>(readSize));
+    if (readSize == 0) { break; }
   }
-  locOfGenScanner().initialize(&m_fileName);
-  yyrestart(yyin);
+  m_sourceSize = m_ownedBuffer.size();
+  m_ownedBuffer.resize(m_sourceSize + paddingSize, '\0');
+  m_buffer = m_ownedBuffer.data();
+}
+
+void Scanner::copySource(string_view source) {
+  m_sourceSize = source.size();
+  m_ownedBuffer.reserve(m_sourceSize + paddingSize);
+  m_ownedBuffer.assign(source.begin(), source.end());
+  m_ownedBuffer.resize(m_sourceSize + paddingSize, '\0');
+  m_buffer = m_ownedBuffer.data();
+}
+
+bool Scanner::isReadingStdin() const {
+  const auto& name = m_sourceFile.name();
+  return name.empty() || name == "-";
 }
 
-Parser::symbol_type Scanner::pop() {
+Token Scanner::pop() {
+  if (!m_bufferState) {
+    readAll(STDIN_FILENO);
+    startScanning();
+  }
   // see YY_DECL
-  return yylex_raw(m_errorHandler);
+  return yylex_raw(*this);
 }
 
-Scanner::~Scanner() {
-  if (m_opened_yyin) { fclose(yyin); }
+Parser::symbol_type Scanner::symbol(const Token& token) {
+  const auto loc = location(token);
+  switch (token.token()) {
+  case Parser::token::TOK_ID: return Parser::make_ID(text(token), loc);
+  case Parser::token::TOK_OP_NAME:
+    return Parser::make_OP_NAME(text(token).substr(token.payloadId()), loc);
+  case Parser::token::TOK_NUMBER: {
+    const lock_guard<mutex> lock{m_numbersMutex};
+    return Parser::make_NUMBER(m_numbers.at(token.payloadId()), loc);
+  }
+  case Parser::token::TOK_FUNDAMENTAL_TYPE:
+    return Parser::make_FUNDAMENTAL_TYPE(
+      static_cast<ObjTypeFunda::EType>(token.payloadId()), loc);
+  default: return Parser::symbol_type(token.token(), loc);
+  }
+}
+
+Location Scanner::location(const Token& token) {
+  return location(m_buffer + token.offset(), token.length());
+}
+
+string_view Scanner::text(const Token& token) const {
+  return string_view{m_buffer + token.offset(), token.length()};
+}
+
+Token Scanner::makeToken(Parser::token_type token, const char* lexeme,
+  size_t length, uint32_t payloadId) const {
+  assert(m_buffer <= lexeme && lexeme + length <= m_buffer + m_sourceSize);
+  return Token{token, static_cast<uint32_t>(lexeme - m_buffer),
+    static_cast<uint32_t>(length), payloadId};
+}
+
+Token Scanner::makeNumberToken(
+  const NumberToken& value, const char* lexeme, size_t length) {
+  const lock_guard<mutex> lock{m_numbersMutex};
+  m_numbers.push_back(value);
+  return makeToken(Parser::token::TOK_NUMBER, lexeme, length,
+    static_cast<uint32_t>(m_numbers.size() - 1));
+}
+
+Token Scanner::makeEndOfFileToken() const {
+  return makeToken(Parser::token::TOK_END_OF_FILE, m_buffer + m_sourceSize, 0);
+}
 
-  // not required, but it makes it more explicit that the location is no longer
-  // valid.
-  locOfGenScanner().initialize(nullptr);
+Location Scanner::location(const char* lexeme, size_t length) const {
+  const auto offset = static_cast<uint32_t>(lexeme - m_buffer);
+  return Location{
+    &m_sourceFile, offset, offset + static_cast<uint32_t>(length)};
+}
+
+Scanner::~Scanner() {
+  if (m_bufferState) { yy_delete_buffer(m_bufferState); }
+  if (m_mappedSize != 0) { munmap(m_buffer, m_mappedSize); }
 }
@@ -1,30 +1,63 @@
 #pragma once
 
+#include "sourcefile.h"
 #include "tokenstream.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <vector>
 
 class ErrorHandler;
+class Scanner;
+struct yy_buffer_state;
 
 /** YY_DECL defines the signature (without trailing semicolon) of a function
 returning the next token. The YY_DECL macro is used by the generated scanner to
 _define_ the function specified by YY_DECL. It is named yylex_raw because it is
 implemented by the generated scanner, wheras yylex, see genparser.yy, is the
 function used by the generated parser, see there. */
-#define YY_DECL Parser::symbol_type yylex_raw(ErrorHandler& errorHandler)
+#define YY_DECL Token yylex_raw(Scanner& scanner)
 
 /** Wraps the generated scanner. Is implemented as singleton, because the
 underlying generated parser is also effectively a singleton, since it is
-implemented using static variables. */
+implemented using static variables.
+
+The whole source is scanned in place from one contiguous buffer. A regular file
+is memory mapped, other inputs like stdin or pipes are read into the buffer, and
+a source given in memory is copied into the buffer.
+Thus the semantic values of identifier-like tokens can be string views into the
+source, which stay valid as long as the Scanner lives.
+
+The tokens returned by pop are compact, see Token. The payload id of a NUMBER
+token is the index into m_numbers, the one of a FUNDAMENTAL_TYPE token is the
+ObjTypeFunda::EType, and the one of an OP_NAME token is the length of the prefix
+of the lexeme which is not part of the name. Locations refer to m_sourceFile,
+whose line table is computed up front.
+
+symbol may be called concurrently with pop, so the scanner can run on a thread
+of its own, see ThreadedTokenStream. */
 class Scanner : public TokenStream {
 public:
   /** Creates a singleton instance and returns it. If currently there is already
   an singleton instance, the method asserts. */
   static std::shared_ptr<Scanner> create(
     std::string fileName, ErrorHandler& errorHandler);
+  /** Analogous, but scans the given source instead of reading the file
+  fileName. fileName is only used as file name in diagnostics. The source is
+  copied, so it needs not outlive the returned Scanner. */
+  static std::shared_ptr<Scanner> create(std::string fileName,
+    std::string_view source, ErrorHandler& errorHandler);
+
+  Token pop() override;
+  Parser::symbol_type symbol(const Token& token) override;
 
-  Parser::symbol_type pop() override;
+  Location location(const Token& token);
+  /** The given token's lexeme */
+  std::string_view text(const Token& token) const;
 
 private:
   class Deleter {
@@ -32,13 +65,55 @@ private:
     void operator()(Scanner* p) const { delete p; }
   };
   friend class Deleter;
+  friend YY_DECL;
 
   Scanner(std::string fileName, ErrorHandler& errorHandler);
+  Scanner(std::string fileName, std::string_view source,
+    ErrorHandler& errorHandler);
   ~Scanner();
 
+  /** Initializes m_sourceFile's line table and lets the generated scanner scan m_buffer */
+  void startScanning();
+
+  /** Returns a token for the given lexeme, which must be within m_buffer.
+  Intended to be used by the generated scanner. */
+  Token makeToken(Parser::token_type token, const char* lexeme,
+    std::size_t length, std::uint32_t payloadId = 0) const;
+  /** Analogous to makeToken, for a NUMBER token with the given semantic
+  value */
+  Token makeNumberToken(
+    const NumberToken& value, const char* lexeme, std::size_t length);
+  /** Returns an END_OF_FILE token located at the end of the source */
+  Token makeEndOfFileToken() const;
+  /** Location of the given lexeme, which must be within m_buffer */
+  Location location(const char* lexeme, std::size_t length) const;
+
+  /** Whether the source is stdin, which is read lazily on the first pop */
+  bool isReadingStdin() const;
+  /** Makes m_buffer refer to the content of the file m_sourceFile */
+  void mapFile();
+  /** Makes m_buffer refer to m_ownedBuffer, being filled with everything
+  readable from the given file descriptor */
+  void readAll(int fd);
+  /** Makes m_buffer refer to m_ownedBuffer, being filled with the given
+  source */
+  void copySource(std::string_view source);
+
   /** The singleton instance */
   static std::weak_ptr<Scanner> sm_instance;
-  std::string m_fileName;
+  SourceFile m_sourceFile;
   ErrorHandler& m_errorHandler;
-  bool m_opened_yyin;
+  /** The source, followed by the padding flex requires, see yy_scan_buffer.
+  Points either into the memory mapping or into m_ownedBuffer. */
+  char* m_buffer;
+  std::size_t m_sourceSize;
+  /** Size of the memory mapping at m_buffer, 0 if there is none */
+  std::size_t m_mappedSize;
+  std::vector<char> m_ownedBuffer;
+  /** The generated scanner's handle to m_buffer */
+  yy_buffer_state* m_bufferState;
+  /** The semantic values of the NUMBER tokens, see class description */
+  std::vector<NumberToken> m_numbers;
+  /** Guards m_numbers, see class description */
+  std::mutex m_numbersMutex;
 };
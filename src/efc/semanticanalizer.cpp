@@ -3,15 +3,20 @@
 #include "ast.h"
 #include "env.h"
 #include "envinserter.h"
+#include "escapeanalizer.h"
 #include "errorhandler.h"
 #include "freefromastobject.h"
 #include "objtype.h"
+#include "rangeanalizer.h"
+#include "tailcallanalizer.h"
 #include "templateinstanciator.h"
 
+#include <cstdint>
+
 using namespace std;
 
 SemanticAnalizer::SemanticAnalizer(Env& env, ErrorHandler& errorHandler)
-  : m_env{env}, m_errorHandler{errorHandler} {
+  : m_env{env}, m_errorHandler{errorHandler}, m_isInParamList{false} {
 }
 
 void SemanticAnalizer::analyze(AstNode& root) {
@@ -28,7 +33,19 @@ void SemanticAnalizer::analyze(AstNode& root) {
 
   // pass 3 over AST: SemanticAnalizer itself
   root.setAccessFromAstParent(Access::eIgnoreValueAndAddr);
-  root.accept(*this);
+  dispatch(root);
+
+  // pass 4 over AST: RangeAnalizer
+  RangeAnalizer rangeAnalizer;
+  rangeAnalizer.analyze(root);
+
+  // pass 5 over AST: TailCallAnalizer
+  TailCallAnalizer tailCallAnalizer{m_errorHandler};
+  tailCallAnalizer.analyze(root);
+
+  // pass 6 over AST: EscapeAnalizer
+  EscapeAnalizer escapeAnalizer;
+  escapeAnalizer.analyze(root);
 }
 
 SemanticAnalizer::FunBodyHelper::FunBodyHelper(
@@ -48,7 +65,7 @@ void SemanticAnalizer::visit(AstCast& cast) {
   for (const auto arg : cast.args().childs()) {
     setAccessAndCallAcceptOn(*arg, Access::eRead);
   }
-  cast.specifiedNewAstObjType().accept(*this);
+  dispatch(cast.specifiedNewAstObjType());
 
   // -- responsibility 2: semantic analysis
 
@@ -132,39 +149,46 @@ void SemanticAnalizer::visit(AstOperator& op) {
       access = Access::eTakeAddress;
     }
     for (const auto arg : op.args().childs()) {
-      setAccessAndCallAcceptOn(*arg, access);
+      // An element of an array is accessed via the array's address
+      const auto isIndexedArray =
+        opop == AstOperator::eIndex && arg == argschilds.front();
+      setAccessAndCallAcceptOn(
+        *arg, isIndexedArray ? Access::eTakeAddress : access);
     }
   }
 
   // -- responsibility 2: semantic analysis
 
   // Check that all operands are of the same obj type, sauf
-  // qualifiers. Currently there are no implicit conversions. However the rhs
-  // of logical and/or is allowed to be eNoreturn.
-  if (argschilds.size() == 2) {
+  // qualifiers. Currently there are no implicit conversions. However the last
+  // operand of logical and/or is allowed to be eNoreturn. n-ary operators, see
+  // AstOperator::isNAry, have two or more operands.
+  if (argschilds.size() >= 2 && opop != AstOperator::eWithLane) {
     auto& lhs = argschilds.front()->objType();
-    auto& rhs = argschilds.back()->objType();
-    if (op.class_() == AstOperator::eLogical) {
-      if (!lhs.matchesExceptQualifiers(rhs) &&
-        (!op.isBinaryLogicalShortCircuit() ||
-          !rhs.matchesExceptQualifiers(
-            ObjTypeFunda(ObjTypeFunda::eNoreturn)))) {
-        Error::throwError(m_errorHandler, Error::eNoImplicitConversion,
-          op.loc(), rhs.completeName(), lhs.completeName());
+    for (auto arg = next(argschilds.begin()); arg != argschilds.end(); ++arg) {
+      auto& rhs = (*arg)->objType();
+      if (op.class_() == AstOperator::eLogical) {
+        if (!lhs.matchesExceptQualifiers(rhs) &&
+          (!op.isLogicalShortCircuit() || *arg != argschilds.back() ||
+            !rhs.matchesExceptQualifiers(
+              ObjTypeFunda(ObjTypeFunda::eNoreturn)))) {
+          Error::throwError(m_errorHandler, Error::eNoImplicitConversion,
+            op.loc(), rhs.completeName(), lhs.completeName());
+        }
       }
-    }
-    else if (class_ != AstOperator::eOther) {
-      if (!lhs.matchesExceptQualifiers(rhs)) {
-        Error::throwError(m_errorHandler, Error::eNoImplicitConversion,
-          op.loc(), rhs.completeName(), lhs.completeName());
+      else if (class_ != AstOperator::eSimd && class_ != AstOperator::eOther &&
+        opop != AstOperator::eIndex) {
+        if (!lhs.matchesExceptQualifiers(rhs)) {
+          Error::throwError(m_errorHandler, Error::eNoImplicitConversion,
+            op.loc(), rhs.completeName(), lhs.completeName());
+        }
       }
     }
   }
   else {
     // In case there is only one arg, that arg's type can't missmatch
-    // anything, so it's implicitely ok. If there are more than two args, the
-    // implementation is missing.
-    assert(argschilds.size() == 1);
+    // anything, so it's implicitely ok. eWithLane is handled below.
+    assert(argschilds.size() == 1 || opop == AstOperator::eWithLane);
   }
 
   // If an operand is modified ensure its writable. Note that reading is
@@ -186,6 +210,28 @@ void SemanticAnalizer::visit(AstOperator& op) {
       lhsObjType.completeName(), op.funName());
   }
 
+  // The simd lane operators and the index operator: the 2nd arg is the lane or
+  // element index, the 3rd arg of eWithLane is the new value of that lane.
+  if (opop == AstOperator::eLane || opop == AstOperator::eWithLane ||
+    opop == AstOperator::eIndex) {
+    const ObjTypeFunda intObjType(ObjTypeFunda::eInt);
+    const auto& indexObjType = argschilds.at(1)->objType();
+    if (!indexObjType.matchesExceptQualifiers(intObjType)) {
+      Error::throwError(m_errorHandler, Error::eNoImplicitConversion, op.loc(),
+        indexObjType.completeName(), intObjType.completeName());
+    }
+    if (opop == AstOperator::eWithLane) {
+      const auto& elementObjType =
+        static_cast<const ObjTypeSimd&>(*lhsObjType.unqualifiedObjType())
+          .element();
+      const auto& valueObjType = argschilds.back()->objType();
+      if (!valueObjType.matchesExceptQualifiers(elementObjType)) {
+        Error::throwError(m_errorHandler, Error::eNoImplicitConversion,
+          op.loc(), valueObjType.completeName(), elementObjType.completeName());
+      }
+    }
+  }
+
   // -- responsibility 3: set properties of associated object: type, access
 
   // The object denoted by the dot-assignment is exactly that of lhs
@@ -200,14 +246,49 @@ void SemanticAnalizer::visit(AstOperator& op) {
   else if (opop == AstOperator::eDeref) {
     // It is known that static cast is safe because it was checked before
     // that the operand of the deref operator has the deref operator as
-    // member function.
-    const auto& opObjType =
-      static_cast<const ObjTypePtr&>(argschilds.back()->objType());
+    // member function. The operand might be a mutable pointer, thus first
+    // strip its qualifiers.
+    const auto& opObjType = static_cast<const ObjTypePtr&>(
+      *argschilds.back()->objType().unqualifiedObjType());
     op.setReferencedObjAndPropagateAccess(
       make_unique<FreeFromAstObject>(opObjType.pointee()));
   }
-  else if (class_ == AstOperator::eComparison ||
-    opop == AstOperator::eVoidAssign) {
+  // Index: The element of the array is the Object denoted by this AstNode. The
+  // elements are mutable if and only if the array is.
+  else if (opop == AstOperator::eIndex) {
+    shared_ptr<const ObjType> elementObjType =
+      static_cast<const ObjTypeArray&>(*lhsObjType.unqualifiedObjType())
+        .elementAsSp();
+    if (lhsObjType.qualifiers() & ObjType::eMutable) {
+      elementObjType =
+        make_shared<ObjTypeQuali>(ObjType::eMutable, move(elementObjType));
+    }
+    op.setReferencedObjAndPropagateAccess(
+      make_unique<FreeFromAstObject>(move(elementObjType)));
+  }
+  // Comparing simd objects is done lane-wise, giving a simd of bools
+  else if (class_ == AstOperator::eComparison) {
+    const auto lhsSimd =
+      dynamic_cast<const ObjTypeSimd*>(lhsObjType.unqualifiedObjType().get());
+    const auto boolObjType = make_shared<ObjTypeFunda>(ObjTypeFunda::eBool);
+    if (lhsSimd) {
+      op.setObjType(make_shared<ObjTypeSimd>(lhsSimd->laneCnt(), boolObjType));
+    }
+    else {
+      op.setObjType(boolObjType);
+    }
+  }
+  // The simd operators returning a single lane, or a reduction of all lanes
+  else if (opop == AstOperator::eLane || opop == AstOperator::eHAdd ||
+    opop == AstOperator::eHMul) {
+    op.setObjType(
+      static_cast<const ObjTypeSimd&>(*lhsObjType.unqualifiedObjType())
+        .elementAsSp());
+  }
+  else if (opop == AstOperator::eWithLane) {
+    op.setObjType(lhsObjType.unqualifiedObjType());
+  }
+  else if (opop == AstOperator::eVoidAssign) {
     // nop - obj type allready set by AstOperator ctor
   }
   // For ther operands, the operator expression's objtype is, now that we
@@ -305,13 +386,28 @@ void SemanticAnalizer::visit(AstSymbol& symbol) {
 void SemanticAnalizer::visit(AstFunCall& funCall) {
   preConditionCheck(funCall);
 
+  // a symbol not referring to a user defined object might name a builtin
+  // function, in which case the address is not an object to be descended into
+  const auto symbol = dynamic_cast<const AstSymbol*>(&funCall.address());
+  if (symbol && !m_env.find(symbol->name())) {
+    const auto builtin = AstFunCall::toBuiltin(symbol->name());
+    if (builtin != AstFunCall::eNoBuiltin) { funCall.setBuiltin(builtin); }
+  }
+
   // -- responsibility 1: set access to direct childs and descent AST subtree
-  setAccessAndCallAcceptOn(funCall.address(), Access::eRead);
+  if (funCall.builtin() == AstFunCall::eNoBuiltin) {
+    setAccessAndCallAcceptOn(funCall.address(), Access::eRead);
+  }
   for (const auto arg : funCall.args().childs()) {
     setAccessAndCallAcceptOn(*arg, Access::eRead);
   }
 
   // -- responsibility 2: semantic analysis
+  if (funCall.builtin() != AstFunCall::eNoBuiltin) {
+    analyzeBuiltinFunCall(funCall, symbol->name());
+    postConditionCheck(funCall);
+    return;
+  }
   const auto& objTypeFun =
     dynamic_cast<const ObjTypeFun&>(funCall.address().objType());
   const auto& argsCall = funCall.args().childs();
@@ -339,6 +435,53 @@ void SemanticAnalizer::visit(AstFunCall& funCall) {
   postConditionCheck(funCall);
 }
 
+void SemanticAnalizer::analyzeBuiltinFunCall(
+  const AstFunCall& funCall, const string& name) {
+  const auto builtin = funCall.builtin();
+  const auto& argsCall = funCall.args().childs();
+  const auto arity = AstFunCall::arityOf(builtin);
+  if (argsCall.size() != arity) {
+    Error::throwError(m_errorHandler, Error::eInvalidArguments, funCall.loc(),
+      to_string(argsCall.size()), to_string(arity));
+  }
+
+  const auto& objType = argsCall.front()->objType();
+  const auto isDefinedForObjType = [&]() {
+    switch (builtin) {
+    case AstFunCall::eAbs:
+    case AstFunCall::eMin:
+    case AstFunCall::eMax: return objType.is(ObjType::eArithmetic);
+    case AstFunCall::eLikely:
+    case AstFunCall::eUnlikely:
+    case AstFunCall::eExpectTrips:
+      return objType.matchesExceptQualifiers(
+        ObjTypeFunda(ObjTypeFunda::eBool));
+    default: return objType.is(ObjType::eFloatingPoint);
+    }
+  }();
+  if (!isDefinedForObjType) {
+    Error::throwError(m_errorHandler, Error::eNoSuchBuiltinFunOverload,
+      funCall.loc(), name, objType.completeName());
+  }
+
+  if (builtin == AstFunCall::eExpectTrips) {
+    const auto tripCount = dynamic_cast<const AstNumber*>(argsCall.back());
+    if (!tripCount || !tripCount->objType().is(ObjType::eIntegral) ||
+      tripCount->value() < 0 || tripCount->value() > UINT32_MAX) {
+      Error::throwError(
+        m_errorHandler, Error::eInvalidTripCount, argsCall.back()->loc());
+    }
+    return;
+  }
+
+  for (const auto& arg : argsCall) {
+    if (!arg->objType().matchesExceptQualifiers(objType)) {
+      Error::throwError(m_errorHandler, Error::eNoImplicitConversion,
+        arg->loc(), arg->objType().completeName(), objType.completeName());
+    }
+  }
+}
+
 void SemanticAnalizer::visit(AstFunDef& funDef) {
   preConditionCheck(funDef);
   const auto& retObjType = funDef.ret().objType();
@@ -361,20 +504,26 @@ void SemanticAnalizer::visit(AstFunDef& funDef) {
   {
     FunBodyHelper dummy{m_funRetAstObjTypes, &funDef.ret()};
     Env::AutoScope scope{m_env, funDef};
+    m_isInParamList = true;
     for (const auto& arg : funDef.declaredArgs()) {
       setAccessAndCallAcceptOn(*arg, Access::eIgnoreValueAndAddr);
     }
-    setAccessAndCallAcceptOn(funDef.body(), Access::eRead);
-    funDef.ret().accept(*this);
+    m_isInParamList = false;
+    if (!funDef.isHostFunction()) {
+      setAccessAndCallAcceptOn(funDef.body(), Access::eRead);
+    }
+    dispatch(funDef.ret());
   }
 
   // -- responsibility 2 / part 2 of 2: semantic analysis
-  const auto& bodyObjType = funDef.body().objType();
-  if (!bodyObjType.matchesExceptQualifiers(retObjType) &&
-    !bodyObjType.isNoreturn()) {
-    Error::throwError(m_errorHandler, Error::eNoImplicitConversion,
-      funDef.body().loc(), bodyObjType.completeName(),
-      retObjType.completeName());
+  if (!funDef.isHostFunction()) {
+    const auto& bodyObjType = funDef.body().objType();
+    if (!bodyObjType.matchesExceptQualifiers(retObjType) &&
+      !bodyObjType.isNoreturn()) {
+      Error::throwError(m_errorHandler, Error::eNoImplicitConversion,
+        funDef.body().loc(), bodyObjType.completeName(),
+        retObjType.completeName());
+    }
   }
 
   // -- responsibility 3: set properties of associated object: type, sd, access
@@ -390,7 +539,17 @@ void SemanticAnalizer::visit(AstDataDef& dataDef) {
 
   auto&& ctorArgs = dataDef.ctorArgs().childs();
 
-  if (!dataDef.doNotInit()) {
+  // -- responsibility 1 / part 1 of 2: descent declared type's AST subtree
+  // first, so it's known to be valid before a default arg is created from it
+  dispatch(dataDef.declaredAstObjType());
+
+  // A parameter without explicit initializer is initialized by the argument
+  // the caller passes, so there's nothing to analyze or insert. Inserting a
+  // default initializer would not only be useless, it would also fail for
+  // types without an implicit default, e.g. pointers, since nullptr doesn't
+  // implicitly convert to them.
+  const auto isInitializedByCaller = m_isInParamList && ctorArgs.empty();
+  if (!dataDef.doNotInit() && !isInitializedByCaller) {
     // special responsibility: insert new auto created nodes into AST.  Note
     // that the AST nodes created here obviously are not visited by the passes
     // prior to SemanticAnalizer.
@@ -404,11 +563,11 @@ void SemanticAnalizer::visit(AstDataDef& dataDef) {
       ctorArgs.push_back(ot.createDefaultAstObjectForSemanticAnalizer(loc));
     }
 
-    // -- responsibility 1: set access to direct childs and descent AST subtree
+    // -- responsibility 1 / part 2 of 2: set access to ctor args and descent
+    // their AST subtrees
     for (const auto arg : ctorArgs) {
       setAccessAndCallAcceptOn(*arg, Access::eRead);
     }
-    dataDef.declaredAstObjType().accept(*this);
 
     // -- responsibility 2: semantic analysis
     // currently a data object must be initialized with exactly one
@@ -550,6 +709,91 @@ void SemanticAnalizer::visit(AstReturn& return_) {
   postConditionCheck(return_);
 }
 
+void SemanticAnalizer::visit(AstRawNew& rawNew) {
+  preConditionCheck(rawNew);
+
+  // -- responsibility 1: set access to direct childs and descent AST subtree
+  for (const auto arg : rawNew.args().childs()) {
+    setAccessAndCallAcceptOn(*arg, Access::eRead);
+  }
+  dispatch(rawNew.specifiedAstObjType());
+
+  // -- responsibility 2: semantic analysis
+  const auto& args = rawNew.args().childs();
+  if (args.size() != 1U) {
+    Error::throwError(m_errorHandler, Error::eInvalidArguments,
+      rawNew.args().loc(), to_string(args.size()), "1");
+  }
+  const auto& newObjType = rawNew.specifiedAstObjType().objType();
+  const auto& initObjType = args.front()->objType();
+  if (newObjType.is(ObjType::eAbstract)) {
+    Error::throwError(m_errorHandler, Error::eNoSuchCtor, rawNew.loc(),
+      newObjType.completeName(), initObjType.completeName());
+  }
+  if (!initObjType.matchesExceptQualifiers(newObjType)) {
+    Error::throwError(m_errorHandler, Error::eNoImplicitConversion,
+      rawNew.loc(), initObjType.completeName(), newObjType.completeName());
+  }
+
+  // -- responsibility 3: set properties of associated object: type, sd, access
+  // nop - done by AST node itself
+
+  postConditionCheck(rawNew);
+}
+
+void SemanticAnalizer::visit(AstRawDelete& rawDelete) {
+  preConditionCheck(rawDelete);
+
+  // -- responsibility 1: set access to direct childs and descent AST subtree
+  setAccessAndCallAcceptOn(rawDelete.ptr(), Access::eRead);
+
+  // -- responsibility 2: semantic analysis
+  // Only pointers can be deleted, and those are exactly the types which can be
+  // dereferenced.
+  const auto& ptrObjType = rawDelete.ptr().objType();
+  if (!ptrObjType.hasMemberFun(AstOperator::eDeref)) {
+    Error::throwError(m_errorHandler, Error::eNoSuchMemberFun, rawDelete.loc(),
+      ptrObjType.completeName(), "raw_delete");
+  }
+
+  // -- responsibility 3: set properties of associated object: type, sd, access
+  // nop - done by AST node itself
+
+  postConditionCheck(rawDelete);
+}
+
+void SemanticAnalizer::visit(AstMemberAccess& memberAccess) {
+  preConditionCheck(memberAccess);
+
+  // -- responsibility 1: set access to direct childs and descent AST subtree
+  // A data member is accessed via the class object's address
+  setAccessAndCallAcceptOn(memberAccess.obj(), Access::eTakeAddress);
+
+  // -- responsibility 2: semantic analysis
+  const auto& objObjType = memberAccess.obj().objType();
+  const auto class_ =
+    dynamic_cast<const ObjTypeCompound*>(objObjType.unqualifiedObjType().get());
+  const auto memberIndex =
+    class_ ? class_->memberIndexOf(memberAccess.memberName()) : -1;
+  if (memberIndex == -1) {
+    Error::throwError(m_errorHandler, Error::eNoSuchMember,
+      memberAccess.loc(), objObjType.completeName(),
+      memberAccess.memberName());
+  }
+
+  // -- responsibility 3: set properties of associated object: type, sd, access
+  // The data members are mutable if and only if the class object is
+  auto memberObjType = class_->members().at(memberIndex)->unqualifiedObjType();
+  if (objObjType.qualifiers() & ObjType::eMutable) {
+    memberObjType =
+      make_shared<ObjTypeQuali>(ObjType::eMutable, move(memberObjType));
+  }
+  memberAccess.setReferencedObjAndPropagateAccess(
+    make_unique<FreeFromAstObject>(move(memberObjType)));
+
+  postConditionCheck(memberAccess);
+}
+
 void SemanticAnalizer::visit(AstObjTypeSymbol& symbol) {
   // nop, everything was already done in previous passes
   preConditionCheck(symbol);
@@ -563,17 +807,69 @@ void SemanticAnalizer::visit(AstObjTypeSymbol& symbol) {
 void SemanticAnalizer::visit(AstObjTypeQuali& quali) {
   // nop, everything was already done in previous passes
   preConditionCheck(quali);
-  quali.targetType().accept(*this);
+  dispatch(quali.targetType());
   postConditionCheck(quali);
 }
 
 void SemanticAnalizer::visit(AstObjTypePtr& ptr) {
   // nop, everything was already done in previous passes
   preConditionCheck(ptr);
-  ptr.pointee().accept(*this);
+  dispatch(ptr.pointee());
   postConditionCheck(ptr);
 }
 
+void SemanticAnalizer::visit(AstObjTypeSimd& simd) {
+  preConditionCheck(simd);
+  dispatch(simd.element());
+  if (simd.laneCnt() <= 0) {
+    Error::throwError(m_errorHandler, Error::eInvalidSimdLaneCount, simd.loc(),
+      to_string(simd.laneCnt()));
+  }
+  const auto& element = simd.element().objType();
+  if (element.qualifiers() != ObjType::eNoQualifier ||
+    (!element.is(ObjType::eArithmetic) &&
+      !element.matchesFully(ObjTypeFunda(ObjTypeFunda::eBool)))) {
+    Error::throwError(m_errorHandler, Error::eInvalidSimdElementType,
+      simd.loc(), element.completeName());
+  }
+  postConditionCheck(simd);
+}
+
+void SemanticAnalizer::visit(AstObjTypeArray& array) {
+  preConditionCheck(array);
+  dispatch(array.element());
+  if (array.elementCnt() <= 0) {
+    Error::throwError(m_errorHandler, Error::eInvalidArraySize, array.loc(),
+      to_string(array.elementCnt()));
+  }
+  // The elements have no qualifiers of their own; they have those of the
+  // array. Pointers are not yet supported as elements.
+  const auto& element = array.element().objType();
+  const auto isValidElement = [&]() {
+    const auto& type = typeid(element);
+    if (type == typeid(ObjTypeSimd) || type == typeid(ObjTypeArray)) {
+      return true;
+    }
+    if (type != typeid(ObjTypeFunda)) { return false; }
+    switch (static_cast<const ObjTypeFunda&>(element).type()) {
+    case ObjTypeFunda::eChar:
+    case ObjTypeFunda::eInt:
+    case ObjTypeFunda::eBool:
+    case ObjTypeFunda::eDouble:
+    case ObjTypeFunda::eInt64:
+    case ObjTypeFunda::eUInt32:
+    case ObjTypeFunda::eUInt64:
+    case ObjTypeFunda::eFloat: return true;
+    default: return false;
+    }
+  };
+  if (!isValidElement()) {
+    Error::throwError(m_errorHandler, Error::eInvalidArrayElementType,
+      array.loc(), element.completeName());
+  }
+  postConditionCheck(array);
+}
+
 void SemanticAnalizer::visit(AstClassDef& class_) {
   preConditionCheck(class_);
   for (const auto& dataMember : class_.dataMembers()) {
@@ -606,5 +902,5 @@ void SemanticAnalizer::postConditionCheck(const AstObjType& node) {
 // always go together
 void SemanticAnalizer::setAccessAndCallAcceptOn(AstNode& node, Access access) {
   node.setAccessFromAstParent(access);
-  node.accept(*this);
+  dispatch(node);
 }
@@ -1,9 +1,10 @@
 #pragma once
 #include "access.h"
-#include "astvisitor.h"
+#include "aststaticvisitor.h"
 
 #include <cstddef>
 #include <stack>
+#include <string>
 
 class Env;
 class ErrorHandler;
@@ -13,7 +14,7 @@ class ObjType;
 errors via the ErrorHandler.  Some of these responsibilities were already done
 by GenParserExt, see there, and some responsibilities are delegated to others,
 see analyze(AstNode& root). */
-class SemanticAnalizer : private AstVisitor {
+class SemanticAnalizer : private AstStaticVisitor<SemanticAnalizer> {
 public:
   SemanticAnalizer(Env& env, ErrorHandler& errorHandler);
   void analyze(AstNode& root);
@@ -29,24 +30,31 @@ private:
     std::stack<const AstObjType*>& m_funRetAstObjTypes;
   };
 
-  void visit(AstNop& nop) override;
-  void visit(AstBlock& block) override;
-  void visit(AstCast& cast) override;
-  void visit(AstCtList& ctList) override;
-  void visit(AstOperator& op) override;
-  void visit(AstSeq& seq) override;
-  void visit(AstNumber& number) override;
-  void visit(AstSymbol& symbol) override;
-  void visit(AstFunCall& funCall) override;
-  void visit(AstFunDef& funDef) override;
-  void visit(AstDataDef& dataDef) override;
-  void visit(AstIf& if_) override;
-  void visit(AstLoop& loop) override;
-  void visit(AstReturn& return_) override;
-  void visit(AstObjTypeSymbol& symbol) override;
-  void visit(AstObjTypeQuali& quali) override;
-  void visit(AstObjTypePtr& ptr) override;
-  void visit(AstClassDef& class_) override;
+  void visit(AstNop& nop);
+  void visit(AstBlock& block);
+  void visit(AstCast& cast);
+  void visit(AstCtList& ctList);
+  void visit(AstOperator& op);
+  void visit(AstSeq& seq);
+  void visit(AstNumber& number);
+  void visit(AstSymbol& symbol);
+  void visit(AstFunCall& funCall);
+  void visit(AstFunDef& funDef);
+  void visit(AstDataDef& dataDef);
+  void visit(AstIf& if_);
+  void visit(AstLoop& loop);
+  void visit(AstReturn& return_);
+  void visit(AstRawNew& rawNew);
+  void visit(AstRawDelete& rawDelete);
+  void visit(AstMemberAccess& memberAccess);
+  void visit(AstObjTypeSymbol& symbol);
+  void visit(AstObjTypeQuali& quali);
+  void visit(AstObjTypePtr& ptr);
+  void visit(AstObjTypeSimd& simd);
+  void visit(AstObjTypeArray& array);
+  void visit(AstClassDef& class_);
+
+  void analyzeBuiltinFunCall(const AstFunCall& funCall, const std::string& name);
 
   void preConditionCheck(const AstObject& node);
   void preConditionCheck(const AstObjType& node);
@@ -55,9 +63,13 @@ private:
 
   void setAccessAndCallAcceptOn(AstNode& node, Access access);
 
+  friend class AstStaticVisitor<SemanticAnalizer>;
   friend class TestingSemanticAnalizer;
 
   Env& m_env;
   ErrorHandler& m_errorHandler;
   std::stack<const AstObjType*> m_funRetAstObjTypes;
+  /** True while the parameters of a function definition are analyzed. See
+  visit(AstDataDef&): parameters get no default initializer inserted. */
+  bool m_isInParamList;
 };
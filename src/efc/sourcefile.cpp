@@ -0,0 +1,32 @@
+#include "sourcefile.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+SourceFile::SourceFile(string name) : m_name{move(name)}, m_lineStarts{0} {
+}
+
+void SourceFile::setSource(string_view source) {
+  m_lineStarts.assign(1, 0);
+
+  // Every newline in the source starts a new line, also within comments
+  const auto begin = source.data();
+  const auto end = begin + source.size();
+  auto newline = static_cast<const char*>(memchr(begin, '\n', source.size()));
+  while (newline) {
+    m_lineStarts.push_back(static_cast<uint32_t>(newline + 1 - begin));
+    newline =
+      static_cast<const char*>(memchr(newline + 1, '\n', end - newline - 1));
+  }
+}
+
+Position SourceFile::position(uint32_t offset) const {
+  // the last line start being not greater than offset
+  const auto lineStart =
+    upper_bound(m_lineStarts.begin(), m_lineStarts.end(), offset) - 1;
+  return Position{&m_name,
+    static_cast<unsigned int>(lineStart - m_lineStarts.begin() + 1),
+    offset - *lineStart + 1};
+}
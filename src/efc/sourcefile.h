@@ -0,0 +1,32 @@
+#pragma once
+
+#include "position.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/** An EF source file: its name and the table of the offsets at which its lines
+start. A Location denotes a range of byte offsets into a SourceFile. Line and
+column are only decoded from the offsets on demand, e.g. when an error is
+reported, see position. */
+class SourceFile {
+public:
+  explicit SourceFile(std::string name = "");
+
+  const std::string& name() const { return m_name; }
+
+  /** Builds the line start table of the given source, which is the content of
+  this file */
+  void setSource(std::string_view source);
+
+  /** Decodes the given offset into line and column */
+  Position position(std::uint32_t offset) const;
+
+private:
+  std::string m_name;
+  /** Offsets of the start of each line, in ascending order. The first element
+  is always 0. */
+  std::vector<std::uint32_t> m_lineStarts;
+};
@@ -0,0 +1,105 @@
+#include "stackgrowth.h"
+
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <new>
+
+#include <pthread.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace {
+/** When less than that remains on the current stack, the recursion continues
+on a new stack segment. Must be well above what a single recursion step needs,
+including the library calls it makes. */
+const size_t redZoneSize = 256 * 1024;
+
+const size_t segmentSize = 16 * 1024 * 1024;
+
+/** Lowest usable address of the stack, or stack segment, the current thread
+runs on. Stacks grow downwards. nullptr until first needed. */
+thread_local char* t_stackLimit = nullptr;
+
+char* stackLimitOfCurrentThread() {
+  pthread_attr_t attr;
+  void* addr = nullptr;
+  size_t size = 0;
+  if (pthread_getattr_np(pthread_self(), &attr) == 0) {
+    pthread_attr_getstack(&attr, &addr, &size);
+    pthread_attr_destroy(&attr);
+  }
+  assert(addr);
+  return static_cast<char*>(addr);
+}
+
+struct SegmentCall {
+  void (*m_fn)(void*);
+  void* m_arg;
+  exception_ptr m_exception;
+};
+
+/** The call to be made by the segment's entry function. makecontext can only
+pass int arguments. */
+thread_local SegmentCall* t_segmentCall = nullptr;
+
+void segmentEntry() {
+  const auto call = t_segmentCall;
+  try {
+    call->m_fn(call->m_arg);
+  } catch (...) { call->m_exception = current_exception(); }
+  // returning resumes the context uc_link refers to
+}
+
+/** A stack segment with a guard page at its lower end */
+class StackSegment {
+public:
+  StackSegment()
+    : m_pageSize{static_cast<size_t>(sysconf(_SC_PAGESIZE))}
+    , m_addr{static_cast<char*>(mmap(nullptr, segmentSize,
+        PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1,
+        0))} {
+    if (m_addr == MAP_FAILED) { throw bad_alloc(); }
+    mprotect(m_addr, m_pageSize, PROT_NONE);
+  }
+  ~StackSegment() { munmap(m_addr, segmentSize); }
+
+  char* begin() const { return m_addr + m_pageSize; }
+  size_t size() const { return segmentSize - m_pageSize; }
+
+private:
+  const size_t m_pageSize;
+  char* const m_addr;
+};
+}
+
+bool isStackNearlyExhausted() {
+  if (!t_stackLimit) { t_stackLimit = stackLimitOfCurrentThread(); }
+  const auto sp = static_cast<char*>(__builtin_frame_address(0));
+  return sp < t_stackLimit + redZoneSize;
+}
+
+void callOnNewStackSegment(void (*fn)(void*), void* arg) {
+  StackSegment segment;
+  SegmentCall call{fn, arg, nullptr};
+  ucontext_t callerContext;
+  ucontext_t segmentContext;
+  getcontext(&segmentContext);
+  segmentContext.uc_stack.ss_sp = segment.begin();
+  segmentContext.uc_stack.ss_size = segment.size();
+  segmentContext.uc_link = &callerContext;
+  makecontext(&segmentContext, segmentEntry, 0);
+
+  const auto oldStackLimit = t_stackLimit;
+  const auto oldSegmentCall = t_segmentCall;
+  t_stackLimit = segment.begin();
+  t_segmentCall = &call;
+  swapcontext(&callerContext, &segmentContext);
+  t_stackLimit = oldStackLimit;
+  t_segmentCall = oldSegmentCall;
+
+  if (call.m_exception) { rethrow_exception(call.m_exception); }
+}
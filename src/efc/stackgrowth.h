@@ -0,0 +1,39 @@
+#pragma once
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/** Whether the C++ stack of the current thread, or the stack segment it
+currently runs on, see callWithSufficientStack, is nearly exhausted. */
+bool isStackNearlyExhausted();
+
+/** Calls fn(arg) on a fresh stack segment allocated on the heap. Exceptions
+thrown by fn are rethrown on the caller's stack. */
+void callOnNewStackSegment(void (*fn)(void*), void* arg);
+
+/** Calls f and returns its result. If the current stack is nearly exhausted, f
+is called on a fresh stack segment, so recursion, e.g. of the passes descending
+into a deep AST, is only limited by memory. The check is cheap, so it can be
+done at each recursion step. */
+template<typename F>
+auto callWithSufficientStack(F&& f) {
+  using Result = decltype(f());
+  if (!isStackNearlyExhausted()) { return f(); }
+  if constexpr (std::is_void_v<Result>) {
+    callOnNewStackSegment(
+      [](void* p) { (*static_cast<std::remove_reference_t<F>*>(p))(); },
+      static_cast<void*>(&f));
+  }
+  else {
+    using Call = std::pair<std::remove_reference_t<F>*, std::optional<Result>>;
+    Call call{&f, std::nullopt};
+    callOnNewStackSegment(
+      [](void* p) {
+        auto& call = *static_cast<Call*>(p);
+        call.second.emplace((*call.first)());
+      },
+      static_cast<void*>(&call));
+    return std::move(*call.second);
+  }
+}
@@ -0,0 +1,127 @@
+#include "tailcallanalizer.h"
+
+#include "ast.h"
+#include "errorhandler.h"
+
+#include <algorithm>
+
+using namespace std;
+
+TailCallAnalizer::TailCallAnalizer(ErrorHandler& errorHandler)
+  : m_errorHandler{errorHandler} {
+}
+
+void TailCallAnalizer::analyze(AstNode& root) {
+  m_tailPositions.clear();
+  m_funContexts.clear();
+  root.accept(*this);
+}
+
+void TailCallAnalizer::visit(AstBlock& block) {
+  if (isInTailPosition(block)) { m_tailPositions.insert(&block.body()); }
+  AstDefaultIterator::visit(block);
+}
+
+namespace {
+/** The object whose storage contains the object the given expression
+designates, e.g. a for a[i].m. Looks through indexing, member access and
+sequences, whose objects don't have a storage duration of their own. */
+const AstObject& rootObjectOf(const AstObject& expr) {
+  auto res = &expr;
+  for (;;) {
+    if (const auto op = dynamic_cast<const AstOperator*>(res)) {
+      if (op->op() != AstOperator::eIndex) { return *res; }
+      res = op->args().childs().front();
+    }
+    else if (const auto memberAccess =
+               dynamic_cast<const AstMemberAccess*>(res)) {
+      res = &memberAccess->obj();
+    }
+    else if (const auto seq = dynamic_cast<const AstSeq*>(res)) {
+      const auto last = dynamic_cast<const AstObject*>(
+        seq->operands().back().get());
+      if (!last) { return *res; }
+      res = last;
+    }
+    else {
+      return *res;
+    }
+  }
+}
+}
+
+void TailCallAnalizer::visit(AstOperator& op) {
+  if (op.op() == AstOperator::eAddrOf && !m_funContexts.empty() &&
+    rootObjectOf(*op.args().childs().front()).storageDuration() ==
+      StorageDuration::eLocal) {
+    m_funContexts.back().m_isAddrOfLocalTaken = true;
+  }
+  AstDefaultIterator::visit(op);
+}
+
+void TailCallAnalizer::visit(AstSeq& seq) {
+  if (isInTailPosition(seq)) {
+    m_tailPositions.insert(seq.operands().back().get());
+  }
+  AstDefaultIterator::visit(seq);
+}
+
+void TailCallAnalizer::visit(AstFunCall& funCall) {
+  if (funCall.builtin() != AstFunCall::eNoBuiltin) {
+    funCall.args().accept(*this);
+    return;
+  }
+  if (!m_funContexts.empty()) {
+    auto& funContext = m_funContexts.back();
+    if (isInTailPosition(funCall)) {
+      funContext.m_callsInTailPosition.push_back(&funCall);
+    }
+    if (const auto symbol = dynamic_cast<AstSymbol*>(&funCall.address())) {
+      const auto callee = &symbol->referencedObj();
+      const auto isRecursive = any_of(m_funContexts.begin(),
+        m_funContexts.end(), [&](const FunContext& enclosing) {
+          return callee == static_cast<const Object*>(enclosing.m_funDef);
+        });
+      if (isRecursive) { funContext.m_recursiveCalls.push_back(&funCall); }
+    }
+  }
+  AstDefaultIterator::visit(funCall);
+}
+
+void TailCallAnalizer::visit(AstFunDef& funDef) {
+  m_funContexts.push_back(FunContext{&funDef, {}, {}, false});
+  if (!funDef.isHostFunction()) { m_tailPositions.insert(&funDef.body()); }
+  AstDefaultIterator::visit(funDef);
+
+  const auto funContext = move(m_funContexts.back());
+  m_funContexts.pop_back();
+  if (!funContext.m_isAddrOfLocalTaken) {
+    for (const auto& call : funContext.m_callsInTailPosition) {
+      call->setIsTailCall();
+    }
+  }
+  for (const auto& call : funContext.m_recursiveCalls) {
+    if (!call->isTailCall()) {
+      const auto& symbol = static_cast<const AstSymbol&>(call->address());
+      Error::reportWarning(m_errorHandler, Error::eNonTailRecursiveCall,
+        call->loc(), symbol.name());
+    }
+  }
+}
+
+void TailCallAnalizer::visit(AstIf& if_) {
+  if (isInTailPosition(if_)) {
+    m_tailPositions.insert(&if_.action());
+    if (if_.elseAction()) { m_tailPositions.insert(if_.elseAction()); }
+  }
+  AstDefaultIterator::visit(if_);
+}
+
+void TailCallAnalizer::visit(AstReturn& return_) {
+  m_tailPositions.insert(return_.ctorArgs().childs().front());
+  AstDefaultIterator::visit(return_);
+}
+
+bool TailCallAnalizer::isInTailPosition(const AstNode& node) const {
+  return m_tailPositions.count(&node) != 0;
+}
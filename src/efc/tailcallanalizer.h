@@ -0,0 +1,54 @@
+#pragma once
+#include "astdefaultiterator.h"
+
+#include <set>
+#include <vector>
+
+class ErrorHandler;
+
+/** Decides for each function call whether it is a tail call, see
+AstFunCall::isTailCall.
+
+A call is in tail position if its value is directly the value of the
+enclosing function, i.e. if it is the last expression of the function's body,
+of a sequence, block or if arm in tail position, or the argument of a return.
+Such a call is a tail call if additionally the enclosing function takes the
+address of none of its local objects, nor of an element or member of one, since
+then the callee can't access the caller's stack frame which a tail call
+reuses.
+
+Calls to a function enclosing the call, i.e. recursive calls, which are no
+tail calls are each reported as warning eNonTailRecursiveCall. Since reporting
+of that warning is disabled by default, that is a diagnostic mode the user has
+to enable.
+
+\pre SemanticAnalizer must have massaged the AST */
+class TailCallAnalizer : private AstDefaultIterator {
+public:
+  TailCallAnalizer(ErrorHandler& errorHandler);
+  void analyze(AstNode& root);
+
+private:
+  /** What is known about a function definition enclosing the current node */
+  struct FunContext {
+    const AstFunDef* m_funDef;
+    std::vector<AstFunCall*> m_callsInTailPosition;
+    std::vector<const AstFunCall*> m_recursiveCalls;
+    bool m_isAddrOfLocalTaken;
+  };
+
+  void visit(AstBlock& block) override;
+  void visit(AstOperator& op) override;
+  void visit(AstSeq& seq) override;
+  void visit(AstFunCall& funCall) override;
+  void visit(AstFunDef& funDef) override;
+  void visit(AstIf& if_) override;
+  void visit(AstReturn& return_) override;
+
+  bool isInTailPosition(const AstNode& node) const;
+
+  ErrorHandler& m_errorHandler;
+  std::set<const AstNode*> m_tailPositions;
+  /** Innermost enclosing function definition is at the back */
+  std::vector<FunContext> m_funContexts;
+};
@@ -4,12 +4,13 @@
 #include "astdefaultiterator.h"
 #include "env.h"
 #include "errorhandler.h"
+#include "objtype.h"
 
 using namespace std;
 
 TemplateInstanciator::TemplateInstanciator(
-  Env& env, ErrorHandler& /*errorHandler*/)
-  : m_env(env) {
+  Env& env, ErrorHandler& errorHandler)
+  : m_env(env), m_errorHandler(errorHandler) {
 }
 
 void TemplateInstanciator::instanciateTemplates(AstNode& root) {
@@ -34,7 +35,16 @@ void TemplateInstanciator::visit(AstFunDef& funDef) {
 
 void TemplateInstanciator::visit(AstObjTypeSymbol& symbol) {
   AstDefaultIterator::visit(symbol);
-  symbol.createAndSetObjType();
+  if (symbol.denotesFundaType()) {
+    symbol.createAndSetObjType();
+    return;
+  }
+  const auto class_ = dynamic_cast<ObjTypeCompound*>(m_env.find(symbol.name()));
+  if (!class_) {
+    Error::throwError(
+      m_errorHandler, Error::eUnknownName, symbol.loc(), symbol.name());
+  }
+  symbol.setObjType(class_->shared_from_this());
 }
 
 void TemplateInstanciator::visit(AstObjTypeQuali& quali) {
@@ -47,7 +57,21 @@ void TemplateInstanciator::visit(AstObjTypePtr& ptr) {
   ptr.createAndSetObjType();
 }
 
+void TemplateInstanciator::visit(AstObjTypeSimd& simd) {
+  AstDefaultIterator::visit(simd);
+  simd.createAndSetObjType();
+}
+
+void TemplateInstanciator::visit(AstObjTypeArray& array) {
+  AstDefaultIterator::visit(array);
+  array.createAndSetObjType();
+}
+
 void TemplateInstanciator::visit(AstClassDef& class_) {
   AstDefaultIterator::visit(class_);
   class_.createAndSetObjType();
+  if (!m_env.insertLeaf(class_.objType())) {
+    Error::throwError(
+      m_errorHandler, Error::eRedefinition, class_.loc(), class_.name());
+  }
 }
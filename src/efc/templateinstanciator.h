@@ -10,7 +10,10 @@ AstObjType node does the instanciation it represents.
 
 An AST subtree representing a type expression, i.e. all nodes are of type
 AstObjType, really denotes a template instantiation. E.g. "*int" (EF syntax) is
-short for "raw_ptr<int>" (using C++ syntax, since EF syntax is not yet there) */
+short for "raw_ptr<int>" (using C++ syntax, since EF syntax is not yet there)
+
+A class definition instanciates its type and inserts it into the environment,
+so AstObjTypeSymbol nodes following it can refer to it by name. */
 class TemplateInstanciator : private AstDefaultIterator {
 public:
   TemplateInstanciator(Env& env, ErrorHandler& errorHandler);
@@ -23,7 +26,10 @@ private:
   void visit(AstObjTypeSymbol& symbol) override;
   void visit(AstObjTypeQuali& quali) override;
   void visit(AstObjTypePtr& ptr) override;
+  void visit(AstObjTypeSimd& simd) override;
+  void visit(AstObjTypeArray& array) override;
   void visit(AstClassDef& class_) override;
 
   Env& m_env;
+  ErrorHandler& m_errorHandler;
 };
@@ -6,14 +6,13 @@
 #include <cstdlib>
 #include <fstream>
 #include <string>
+#include <string_view>
 
 /** Creates a temporary file with the given content. The file is removed in
 the destructor. */
 class TmpFile {
 public:
   TmpFile(const std::string& content) {
-    // todo: make use of YY_INPUT so that the scanner also can read directly
-    // from memory instead from files via yyin
     memset(m_fileName, 'X', sizeof(m_fileName) - 1);
     m_fileName[sizeof(m_fileName) - 1] = '\0';
     errno = 0;
@@ -40,24 +39,27 @@ public:
   TestingDriver(const std::string& fileName = "",
     std::basic_ostream<char>* ostream = nullptr)
     : Driver(fileName, ostream){};
+  TestingDriver(const std::string& fileName, std::string_view source,
+    std::basic_ostream<char>* ostream = nullptr)
+    : Driver(fileName, source, ostream){};
 
   using Driver::m_env;
   using Driver::m_errorHandler;
 };
 
-/** Wrapps a Driver which operates on a temporary file with the content given
-in the constructor. */
-class DriverOnTmpFile {
+/** Wrapps a Driver which operates on the source given in the constructor,
+without a file being involved. Diagnostics refer to the virtual file name
+test.ef. */
+class DriverOnSource {
 public:
-  DriverOnTmpFile(
+  DriverOnSource(
     const std::string& content, std::basic_ostream<char>* ostream = nullptr)
-    : m_tmpFile(content), m_driver(m_tmpFile.fileName(), ostream){};
+    : m_driver("test.ef", content, ostream){};
   operator TestingDriver&() { return m_driver; }
   TestingDriver& d() { return m_driver; }
   Scanner& scanner() { return m_driver.scanner(); }
   ErrorHandler& errorHandler() { return m_driver.errorHandler(); }
 
 private:
-  TmpFile m_tmpFile;
   TestingDriver m_driver;
 };
@@ -5,18 +5,25 @@
 using namespace std;
 using namespace yy;
 
+namespace {
+vector<Token> toTokens(const vector<Parser::token_type>& tokens) {
+  vector<Token> ret;
+  ret.reserve(tokens.size());
+  for (const auto& token : tokens) { ret.emplace_back(token); }
+  return ret;
+}
+}
+
 LiteralTokenStream::LiteralTokenStream(const vector<Parser::token_type>& tokens)
-  : m_frontPos(0)
-  , m_size(tokens.size())
-  , m_stream(new Parser::symbol_type[m_size]) {
-  for (size_t i = 0; i < tokens.size(); ++i) {
-    auto tmp = Parser::makeToken(tokens[i]);
-    m_stream[i].move(tmp);
-  }
+  : m_frontPos(0), m_stream(toTokens(tokens)) {
 }
 
-Parser::symbol_type LiteralTokenStream::pop() {
-  assert(m_frontPos < m_size);
+Token LiteralTokenStream::pop() {
+  assert(m_frontPos < m_stream.size());
   ++m_frontPos;
   return m_stream[m_frontPos - 1];
 }
+
+Parser::symbol_type LiteralTokenStream::symbol(const Token& token) {
+  return Parser::makeToken(token.token());
+}
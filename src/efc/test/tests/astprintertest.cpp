@@ -22,6 +22,12 @@ TEST(AstPrinterTest, MAKE_TEST_NAME2(
   spec = "AstNumber";
   EXPECT_TOSTR_EQ("42", AstNumber(42), spec);
   EXPECT_TOSTR_EQ("42.77d", AstNumber(42.77, ObjTypeFunda::eDouble), spec);
+  EXPECT_TOSTR_EQ("9007199254740993i64",
+    AstNumber(9007199254740993LL, ObjTypeFunda::eInt64), spec);
+  EXPECT_TOSTR_EQ("42u", AstNumber(42, ObjTypeFunda::eUInt32), spec);
+  EXPECT_TOSTR_EQ("18446744073709551615u64",
+    AstNumber(18446744073709551615ULL, ObjTypeFunda::eUInt64), spec);
+  EXPECT_TOSTR_EQ("1.5f", AstNumber(1.5, ObjTypeFunda::eFloat), spec);
   EXPECT_TOSTR_EQ("42d", AstNumber(42, ObjTypeFunda::eDouble), spec);
   EXPECT_TOSTR_EQ("0bool", AstNumber(0, ObjTypeFunda::eBool), spec);
   EXPECT_TOSTR_EQ("1bool", AstNumber(1, ObjTypeFunda::eBool), spec);
@@ -76,6 +82,18 @@ TEST(AstPrinterTest, MAKE_TEST_NAME2(
   spec = "AstReturn";
   EXPECT_TOSTR_EQ("return(42)", AstReturn(new AstNumber(42)), spec);
 
+  spec = "AstRawNew";
+  EXPECT_TOSTR_EQ("raw_new(int (42))",
+    AstRawNew(new AstObjTypeSymbol(ObjTypeFunda::eInt),
+      new AstCtList(new AstNumber(42))),
+    spec);
+
+  spec = "AstRawDelete";
+  EXPECT_TOSTR_EQ("raw_delete(x)", AstRawDelete(new AstSymbol("x")), spec);
+
+  spec = "AstMemberAccess";
+  EXPECT_TOSTR_EQ(".(x m1)", AstMemberAccess(new AstSymbol("x"), "m1"), spec);
+
   spec = "AstDataDef";
   EXPECT_TOSTR_EQ(
     "data(foo int ())", AstDataDef("foo", ObjTypeFunda::eInt), spec);
@@ -154,10 +172,22 @@ TEST(AstPrinterTest, MAKE_TEST_NAME2(
     "raw*int", AstObjTypePtr(new AstObjTypeSymbol(ObjTypeFunda::eInt)), spec);
   EXPECT_TOSTR_EQ("raw*foo", AstObjTypePtr(new AstObjTypeSymbol("foo")), spec);
 
+  spec = "AstObjTypeSimd";
+  EXPECT_TOSTR_EQ("simd[4]double",
+    AstObjTypeSimd(4, new AstObjTypeSymbol(ObjTypeFunda::eDouble)), spec);
+
+  spec = "AstObjTypeArray";
+  EXPECT_TOSTR_EQ("raw[4]int",
+    AstObjTypeArray(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)), spec);
+
   spec = "AstClassDef";
   EXPECT_TOSTR_EQ("class(foo)", AstClassDef("foo"), spec);
   EXPECT_TOSTR_EQ("class(foo data(m1 int ()) data(m2 int ()))",
     AstClassDef("foo",
       new AstDataDef("m1", ObjTypeFunda::eInt),
       new AstDataDef("m2", ObjTypeFunda::eInt)), spec);
+  EXPECT_TOSTR_EQ("class(foo fixed_layout data(m1 int ()))",
+    AstClassDef("foo",
+      new vector<AstDataDef*>{new AstDataDef("m1", ObjTypeFunda::eInt)},
+      ObjTypeCompound::eFixedLayout), spec);
 }
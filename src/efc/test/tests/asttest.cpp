@@ -1,5 +1,8 @@
 #include "test.h"
 #include "../ast.h"
+#include "../aststaticvisitor.h"
+
+#include <typeinfo>
 
 using namespace std;
 using namespace testing;
@@ -10,6 +13,101 @@ public:
   using AstObjTypeSymbol::toType;
 };
 
+TEST(AstNodeTest, MAKE_TEST_NAME(
+    a_1M_deep_AST,
+    destructor,
+    deletes_all_nodes_without_overflowing_the_stack)) {
+  // setup
+  DisableLocationRequirement dummy;
+  AstObject* tree = new AstNumber{1};
+  for (auto i = 0; i < 1000000; ++i) {
+    tree = new AstOperator{'!', tree};
+  }
+  auto root = unique_ptr<AstObject>{tree};
+
+  // exercise
+  root.reset();
+
+  // verify
+  EXPECT_TRUE(root == nullptr);
+}
+
+/** Records the static type of the node the last visit method was called
+with */
+class TypeRecordingStaticVisitor
+  : public AstStaticVisitor<TypeRecordingStaticVisitor> {
+public:
+  template<typename T>
+  void visit(T& /*node*/) {
+    m_visitedType = &typeid(T);
+  }
+
+  const type_info* m_visitedType = &typeid(void);
+};
+
+TEST(AstStaticVisitorTest, MAKE_TEST_NAME(
+    an_AST_node,
+    dispatch,
+    calls_the_visit_method_of_the_nodes_concrete_class)) {
+  DisableLocationRequirement dummy;
+
+  string spec = "Example: AstObject";
+  {
+    // setup
+    const auto node =
+      unique_ptr<AstNode>{new AstOperator{'!', new AstNumber{1}}};
+    TypeRecordingStaticVisitor UUT;
+
+    // exercise
+    UUT.dispatch(*node);
+
+    // verify
+    EXPECT_TRUE(*UUT.m_visitedType == typeid(AstOperator)) << amendSpec(spec);
+  }
+
+  spec = "Example: AstObjDef";
+  {
+    // setup
+    const auto node =
+      unique_ptr<AstNode>{new AstDataDef{"x", ObjTypeFunda::eInt}};
+    TypeRecordingStaticVisitor UUT;
+
+    // exercise
+    UUT.dispatch(*node);
+
+    // verify
+    EXPECT_TRUE(*UUT.m_visitedType == typeid(AstDataDef)) << amendSpec(spec);
+  }
+
+  spec = "Example: AstObjType";
+  {
+    // setup
+    const auto node =
+      unique_ptr<AstNode>{new AstObjTypePtr{new AstObjTypeSymbol{"int"}}};
+    TypeRecordingStaticVisitor UUT;
+
+    // exercise
+    UUT.dispatch(*node);
+
+    // verify
+    EXPECT_TRUE(*UUT.m_visitedType == typeid(AstObjTypePtr))
+      << amendSpec(spec);
+  }
+
+  spec = "Example: AstCtList";
+  {
+    // setup
+    const auto node = unique_ptr<AstNode>{new AstCtList{new AstNumber{1}}};
+    TypeRecordingStaticVisitor UUT;
+
+    // exercise
+    UUT.dispatch(*node);
+
+    // verify
+    EXPECT_TRUE(*UUT.m_visitedType == typeid(AstCtList)) << amendSpec(spec);
+  }
+}
+
 TEST(AstObjTypeSymbolTest, MAKE_TEST_NAME1(toName)) {
   EXPECT_EQ("int", TestingAstObjTypeSymbol::toName(ObjTypeFunda::eInt));
 }
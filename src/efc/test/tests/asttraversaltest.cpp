@@ -0,0 +1,66 @@
+#include "test.h"
+#include "../ast.h"
+#include "../asttraversal.h"
+#include "../nopastvisitor.h"
+
+#include <sstream>
+
+using namespace testing;
+using namespace std;
+
+namespace {
+/** Records the visited AstOperator, AstCtList and AstNumber nodes */
+class Recorder : public NopAstVisitor {
+public:
+  void visit(AstCtList& /*ctList*/) override { m_trace << "list "; }
+  void visit(AstOperator& op) override {
+    m_trace << op.op() << " ";
+    ++m_operatorCnt;
+  }
+  void visit(AstNumber& number) override { m_trace << number.value() << " "; }
+
+  stringstream m_trace;
+  size_t m_operatorCnt = 0;
+};
+}
+
+TEST(AstTraversalTest, MAKE_TEST_NAME(
+    an_AST,
+    operator_call,
+    calls_the_pre_order_visitor_before_and_the_post_order_visitor_after_a_nodes_childs)) {
+  // setup
+  DisableLocationRequirement dummy;
+  AstOperator root{'+', new AstNumber{1}, new AstNumber{2}};
+  Recorder preOrderRecorder;
+  Recorder postOrderRecorder;
+  AstTraversal UUT{&preOrderRecorder, &postOrderRecorder};
+
+  // exercise
+  UUT(root);
+
+  // verify
+  EXPECT_EQ("+ list 1 2 ", preOrderRecorder.m_trace.str());
+  EXPECT_EQ("1 2 list + ", postOrderRecorder.m_trace.str());
+}
+
+TEST(AstTraversalTest, MAKE_TEST_NAME(
+    a_1M_deep_AST,
+    operator_call,
+    visits_all_nodes_without_overflowing_the_stack)) {
+  // setup
+  DisableLocationRequirement dummy;
+  const size_t depth = 1000000;
+  AstObject* tree = new AstNumber{1};
+  for (size_t i = 0; i < depth; ++i) {
+    tree = new AstOperator{'!', tree};
+  }
+  const auto root = unique_ptr<AstObject>{tree};
+  Recorder recorder;
+  AstTraversal UUT{nullptr, &recorder};
+
+  // exercise
+  UUT(*root);
+
+  // verify
+  EXPECT_EQ(depth, recorder.m_operatorCnt);
+}
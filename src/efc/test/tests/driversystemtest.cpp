@@ -1,7 +1,9 @@
 #include "test.h"
-#include "driverontmpfile.h"
+#include "driveronsource.h"
 #include "../driver.h"
+#include "../efmodule.h"
 #include "../errorhandler.h"
+#include "../executionengineadapter.h"
 #include "../ast.h"
 
 #include <memory>
@@ -81,8 +83,8 @@ TEST(DriverSystemTest, MAKE_TEST_NAME(
   // setup
   string well_formed_ef_program = "42";
   stringstream errorMsgFromDriver;
-  DriverOnTmpFile driverOnTmpFile(well_formed_ef_program, &errorMsgFromDriver);
-  TestingDriver& UUT = driverOnTmpFile;
+  DriverOnSource driverOnSource(well_formed_ef_program, &errorMsgFromDriver);
+  TestingDriver& UUT = driverOnSource;
 
   // execute
   UUT.compile();
@@ -98,19 +100,251 @@ TEST(DriverSystemTest, MAKE_TEST_NAME(
 TEST(DriverSystemTest, MAKE_TEST_NAME(
     an_EF_program_containing_an_error,
     compile,
-    writes_an_error_to_its_error_ostream)) {
+    writes_an_error_refering_to_the_virtual_file_name_to_its_error_ostream)) {
   // setup
   string ef_program_with_error = "42 = 77";
   stringstream errorMsgFromDriver;
-  DriverOnTmpFile driverOnTmpFile(ef_program_with_error, &errorMsgFromDriver);
-  Driver& UUT = driverOnTmpFile;
+  DriverOnSource driverOnSource(ef_program_with_error, &errorMsgFromDriver);
+  Driver& UUT = driverOnSource;
 
   // execute
   UUT.compile();
 
   // verify
   ASSERT_THAT(errorMsgFromDriver.str(),
-    MatchesRegex("\\w+:1:4: error: .* \\[eWriteToImmutable\\]\n"))
+    MatchesRegex("test\\.ef:1:4: error: .* \\[eWriteToImmutable\\]\n"))
     << "\n"
     << "EF program: \"" << ef_program_with_error << "\"\n";
 }
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    an_EF_program_containing_an_error_AND_scanning_on_a_thread_of_its_own,
+    compile,
+    writes_the_same_error_as_without_scanner_thread_to_its_error_ostream)) {
+  // setup
+  string ef_program_with_error = "42 = 77";
+  stringstream errorMsgFromDriver;
+  Driver::Options options;
+  options.m_isScanThreadEnabled = true;
+  Driver UUT("test.ef", ef_program_with_error, &errorMsgFromDriver, options);
+
+  // execute
+  UUT.compile();
+
+  // verify
+  ASSERT_THAT(errorMsgFromDriver.str(),
+    MatchesRegex("test\\.ef:1:4: error: .* \\[eWriteToImmutable\\]\n"))
+    << "\n"
+    << "EF program: \"" << ef_program_with_error << "\"\n";
+}
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    an_EF_program_with_two_non_tail_recursive_calls_AND_reporting_eNonTailRecursiveCall_enabled,
+    compile,
+    writes_a_warning_for_each_call_to_its_error_ostream_AND_still_generates_IR)) {
+  // setup
+  string ef_program =
+    "fun foo: (n:int) int = if n == 0 then 1 else foo(n - 1) + foo(n - 1) end$\n"
+    "foo(3)";
+  stringstream errorMsgFromDriver;
+  DriverOnSource driverOnSource(ef_program, &errorMsgFromDriver);
+  TestingDriver& UUT = driverOnSource;
+  UUT.errorHandler().enableReportingOf(Error::eNonTailRecursiveCall);
+
+  // execute
+  UUT.compile();
+
+  // verify
+  EXPECT_FALSE(UUT.errorHandler().hasErrors()) << amend(*UUT.m_errorHandler);
+  EXPECT_EQ(2U, UUT.errorHandler().warnings().size())
+    << amend(*UUT.m_errorHandler);
+  EXPECT_THAT(errorMsgFromDriver.str(),
+    MatchesRegex("test\\.ef:1:49: warning: .* \\[eNonTailRecursiveCall\\]\n"
+                 "test\\.ef:1:62: warning: .* \\[eNonTailRecursiveCall\\]\n"))
+    << "\n"
+    << "EF program: \"" << ef_program << "\"\n";
+  ASSERT_TRUE(UUT.executionEngine() != nullptr);
+  EXPECT_EQ(8, UUT.jitExecMain());
+}
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    an_EF_program_with_an_expression_nested_1M_levels_deep,
+    compile,
+    succeeds_without_overflowing_the_stack)) {
+  // setup
+  // Each parenthesis pair is an AstSeq, each ! an AstOperator, so the AST is
+  // way deeper than what the passes can recurse on a default sized stack
+  const auto depth = 500000;
+  const auto ef_program = string(depth, '(') + "if " + string(depth, '!') +
+    "false then 1 else 2 end" + string(depth, ')');
+  stringstream errorMsgFromDriver;
+  DriverOnSource driverOnSource(ef_program, &errorMsgFromDriver);
+  TestingDriver& UUT = driverOnSource;
+
+  // execute
+  UUT.compile();
+
+  // verify
+  EXPECT_EQ(0U, errorMsgFromDriver.str().length())
+    << "\n"
+    << "errorMsgFromDriver: \"" << errorMsgFromDriver.str() << "\"\n";
+  ASSERT_TRUE(UUT.executionEngine() != nullptr);
+  EXPECT_EQ(2, UUT.jitExecMain());
+}
+
+/** Compiles an EF program indexing an array by a parameter, i.e. by an index
+not provably in range, and returns whether the IR traps on an out of bounds
+index */
+bool compileIndexingAndCheckIfBoundsChecked(bool isReleaseMode) {
+  string ef_program =
+    "fun foo: (i:int) int = (val a:[4]int$; a[i])$\n"
+    "foo(1)";
+  stringstream errorMsgFromDriver;
+  Driver::Options options;
+  options.m_isReleaseMode = isReleaseMode;
+  Driver UUT("test.ef", ef_program, &errorMsgFromDriver, options);
+  UUT.compile();
+  EXPECT_EQ(0U, errorMsgFromDriver.str().length())
+    << "\n"
+    << "errorMsgFromDriver: \"" << errorMsgFromDriver.str() << "\"\n"
+    << "EF program: \"" << ef_program << "\"\n";
+  if (!UUT.executionEngine()) { return false; }
+  return UUT.executionEngine()->module().getFunction("llvm.trap") != nullptr;
+}
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    an_EF_program_indexing_an_array_AND_debug_mode,
+    compile,
+    generates_a_bounds_check)) {
+  EXPECT_TRUE(compileIndexingAndCheckIfBoundsChecked(false));
+}
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    an_EF_program_indexing_an_array_AND_release_mode,
+    compile,
+    generates_no_bounds_check)) {
+  EXPECT_FALSE(compileIndexingAndCheckIfBoundsChecked(true));
+}
+
+namespace {
+const auto efModuleSource =
+  "fun add: (a:int, b:int) int = a + b$\n"
+  "fun negate: (b:bool) bool = not b$\n"
+  "0";
+
+int square(int x) { return x * x; }
+}
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    an_EfModule_on_source_text_defining_functions_at_the_top_level,
+    compile_and_functions,
+    compile_succeeds_AND_functions_returns_these_functions_with_their_signature)) {
+  // setup
+  stringstream errorMsg;
+  EfModule UUT("test.ef", efModuleSource, &errorMsg);
+
+  // execute
+  const auto isCompiled = UUT.compile();
+
+  // verify
+  ASSERT_TRUE(isCompiled) << errorMsg.str();
+  const auto& functions = UUT.functions();
+  ASSERT_EQ(2U, functions.size());
+  EXPECT_EQ("add", functions[0].m_name);
+  EXPECT_EQ("fun((int, int) int)", functions[0].m_objType->completeName());
+  EXPECT_EQ("negate", functions[1].m_name);
+  EXPECT_EQ("fun((bool) bool)", functions[1].m_objType->completeName());
+}
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    a_compiled_EfModule,
+    lookup_of_a_function_with_matching_signature,
+    returns_a_pointer_calling_that_function)) {
+  // setup
+  stringstream errorMsg;
+  EfModule UUT("test.ef", efModuleSource, &errorMsg);
+  ASSERT_TRUE(UUT.compile()) << errorMsg.str();
+
+  // execute
+  const auto add = UUT.lookup<int(int, int)>("add");
+  const auto negate = UUT.lookup<bool(bool)>("negate");
+
+  // verify
+  ASSERT_TRUE(add != nullptr);
+  EXPECT_EQ(5, add(2, 3));
+  ASSERT_TRUE(negate != nullptr);
+  EXPECT_FALSE(negate(true));
+  EXPECT_TRUE(negate(false));
+}
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    a_compiled_EfModule,
+    lookup_of_a_function_with_a_non_matching_signature,
+    returns_nullptr)) {
+  // setup
+  stringstream errorMsg;
+  EfModule UUT("test.ef", efModuleSource, &errorMsg);
+  ASSERT_TRUE(UUT.compile()) << errorMsg.str();
+
+  // execute & verify
+  EXPECT_TRUE(UUT.lookup<int(int)>("add") == nullptr);
+  EXPECT_TRUE((UUT.lookup<int(int, double)>("add") == nullptr));
+  EXPECT_TRUE((UUT.lookup<double(int, int)>("add") == nullptr));
+}
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    a_compiled_EfModule,
+    lookup_of_a_function_not_defined_at_the_top_level,
+    returns_nullptr)) {
+  // setup
+  stringstream errorMsg;
+  EfModule UUT("test.ef", efModuleSource, &errorMsg);
+  ASSERT_TRUE(UUT.compile()) << errorMsg.str();
+
+  // execute & verify
+  EXPECT_TRUE((UUT.lookup<int(int, int)>("sub") == nullptr));
+  EXPECT_TRUE(UUT.lookup<int()>("main") == nullptr);
+}
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    an_EfModule_with_a_host_function_AND_an_EF_function_calling_it,
+    compile_and_calling_the_EF_function,
+    the_host_function_is_called)) {
+  // setup
+  stringstream errorMsg;
+  EfModule UUT("test.ef",
+    "fun sum_of_squares: (a:int, b:int) int = square(a) + square(b)$\n"
+    "0",
+    &errorMsg);
+  UUT.addHostFunction<int(int)>("square", &square);
+
+  // execute
+  ASSERT_TRUE(UUT.compile()) << errorMsg.str();
+  const auto sumOfSquares = UUT.lookup<int(int, int)>("sum_of_squares");
+
+  // verify
+  ASSERT_TRUE(sumOfSquares != nullptr);
+  EXPECT_EQ(25, sumOfSquares(3, 4));
+}
+
+TEST(DriverSystemTest, MAKE_TEST_NAME(
+    two_EfModules_alive_at_the_same_time_AND_defining_a_function_of_the_same_name,
+    compile_both_and_calling_that_function_of_each,
+    each_call_runs_the_function_of_its_own_module)) {
+  // setup
+  stringstream errorMsg;
+  EfModule UUT1("test1.ef", "fun f: (x:int) int = x + 1$\n0", &errorMsg);
+  EfModule UUT2("test2.ef", "fun f: (x:int) int = x * 2$\n0", &errorMsg);
+
+  // execute
+  ASSERT_TRUE(UUT1.compile()) << errorMsg.str();
+  ASSERT_TRUE(UUT2.compile()) << errorMsg.str();
+  const auto f1 = UUT1.lookup<int(int)>("f");
+  const auto f2 = UUT2.lookup<int(int)>("f");
+
+  // verify
+  ASSERT_TRUE(f1 != nullptr);
+  ASSERT_TRUE(f2 != nullptr);
+  EXPECT_EQ(6, f1(5));
+  EXPECT_EQ(10, f2(5));
+}
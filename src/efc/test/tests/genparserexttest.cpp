@@ -17,7 +17,7 @@ either ParserExt or SemanticAnalizer. */
 
 TEST(GenParserExtTest, MAKE_TEST_NAME2(
     mkOperatorTree_WITH_a_CtList,
-    returns_an_AST_tree_of_Operator_nodes_with_two_child_nodes_each)) {
+    returns_an_AST_tree_of_Operator_nodes)) {
   DisableLocationRequirement dummy;
 
   Env env;
@@ -35,13 +35,24 @@ TEST(GenParserExtTest, MAKE_TEST_NAME2(
   }
 
   spec = "Example with left associative operator and more than two childs in CtList";
+  {
+    auto ctList = new AstCtList(
+      new AstNumber(42),
+      new AstNumber(77),
+      new AstNumber(88));
+    unique_ptr<AstObject> opTree{ UUT.mkOperatorTree("/", ctList) };
+    EXPECT_EQ("/(/(42 77) 88)", opTree->toStr()) << amendSpec(spec) <<
+      "CtList: " << ctList->toStr();
+  }
+
+  spec = "Example with n-ary operator and more than two childs in CtList";
   {
     auto ctList = new AstCtList(
       new AstNumber(42),
       new AstNumber(77),
       new AstNumber(88));
     unique_ptr<AstObject> opTree{ UUT.mkOperatorTree("+", ctList) };
-    EXPECT_EQ("+(+(42 77) 88)", opTree->toStr()) << amendSpec(spec) <<
+    EXPECT_EQ("+(42 77 88)", opTree->toStr()) << amendSpec(spec) <<
       "CtList: " << ctList->toStr();
   }
 
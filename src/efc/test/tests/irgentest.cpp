@@ -7,11 +7,13 @@
 #include "../env.h"
 #include "../errorhandler.h"
 
+#include "llvm/IR/Intrinsics.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/Module.h"
 #include "llvm/ExecutionEngine/ExecutionEngine.h"
 
 #include <memory>
+#include <set>
 
 using namespace testing;
 using namespace std;
@@ -24,10 +26,10 @@ private:
 
 class TestingIrGen : public IrGen {
 public:
-  TestingIrGen()
-    : IrGen(*(m_errorHandler = new ErrorHandler()))
+  TestingIrGen(const Options& options = Options{})
+    : IrGen(*(m_errorHandler = new ErrorHandler()), options)
     , m_semanticAnalizer(m_env, *m_errorHandler){};
-  ~TestingIrGen() override { delete m_errorHandler; };
+  ~TestingIrGen() { delete m_errorHandler; };
   Env m_env;
   ErrorHandler* m_errorHandler;
   SemanticAnalizer m_semanticAnalizer;
@@ -92,6 +94,18 @@ void testgenIr(TestingIrGen& UUT, AstObject* astRoot, const string& spec,
   TEST_GEN_IR_0ARG(pe.mkFunDef("foo", ObjTypeFunda::eDouble, astRoot), spec,  \
     double, ".foo", expectedResult)
 
+#define TEST_GEN_IR_IN_IMPLICIT_FOO_RET_INT64(astRoot, expectedResult, spec) \
+  TEST_GEN_IR_0ARG(pe.mkFunDef("foo", ObjTypeFunda::eInt64, astRoot), spec,  \
+    int64_t, ".foo", expectedResult)
+
+#define TEST_GEN_IR_IN_IMPLICIT_FOO_RET_UINT32(astRoot, expectedResult, spec) \
+  TEST_GEN_IR_0ARG(pe.mkFunDef("foo", ObjTypeFunda::eUInt32, astRoot), spec,  \
+    uint32_t, ".foo", expectedResult)
+
+#define TEST_GEN_IR_IN_IMPLICIT_FOO_RET_FLOAT(astRoot, expectedResult, spec) \
+  TEST_GEN_IR_0ARG(pe.mkFunDef("foo", ObjTypeFunda::eFloat, astRoot), spec,  \
+    float, ".foo", expectedResult)
+
 #define TEST_GEN_IR_0ARG(                                                   \
   astRoot, spec, rettype, fqFunctionName, expectedResult)                   \
   {                                                                         \
@@ -121,6 +135,15 @@ void testgenIr(TestingIrGen& UUT, AstObject* astRoot, const string& spec,
       UUT, astRoot, spec, expectedResult, fqFunctionName, arg1, arg2);     \
   }
 
+/** Runs semantic analysis and genIr on the given AST and returns the
+resulting module. For tests which verify properties of the generated IR itself
+rather than its behaviour when JIT executed. */
+unique_ptr<Module> genIrForInspection(TestingIrGen& UUT, AstObject& astRoot) {
+  SemanticAnalizer semanticAnalizer(UUT.m_env, *UUT.m_errorHandler);
+  semanticAnalizer.analyze(astRoot);
+  return UUT.genIr(astRoot);
+}
+
 TEST_F(IrGenTest, MAKE_TEST_NAME(
     a_single_literal,
     genIrInImplicitMain,
@@ -283,6 +306,30 @@ TEST_F(IrGenTest, MAKE_TEST_NAME(
       new AstNumber(2.5, ObjTypeFunda::eDouble),
       new AstNumber(2.0, ObjTypeFunda::eDouble)),
     2.5 / 2.0, "");
+
+  // n-ary
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator('+',
+      new AstCtList(new AstNumber(1), new AstNumber(2), new AstNumber(3))),
+    1 + 2 + 3, "");
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator('*',
+      new AstCtList(new AstNumber(2), new AstNumber(3), new AstNumber(4))),
+    2 * 3 * 4, "");
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_BOOL(
+    new AstOperator(AstOperator::eAnd,
+      new AstCtList(
+        new AstNumber(1, ObjTypeFunda::eBool),
+        new AstNumber(1, ObjTypeFunda::eBool),
+        new AstNumber(0, ObjTypeFunda::eBool))),
+    true && true && false, "");
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_BOOL(
+    new AstOperator(AstOperator::eOr,
+      new AstCtList(
+        new AstNumber(0, ObjTypeFunda::eBool),
+        new AstNumber(0, ObjTypeFunda::eBool),
+        new AstNumber(1, ObjTypeFunda::eBool))),
+    false || false || true, "");
 }
 
 TEST_F(IrGenTest, MAKE_TEST_NAME2(
@@ -407,6 +454,21 @@ TEST_F(IrGenTest, MAKE_TEST_NAME(
         new AstOperator("=<", new AstSymbol("x"), new AstNumber(0, ObjTypeFunda::eBool))),
       new AstSymbol("x")),
     false, "");
+
+  spec = "Example: middle operand of n-ary 'and' operator is false -> last "
+    "operand is not evaluated";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_BOOL(
+    new AstSeq(
+      new AstDataDef("x",
+        new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eBool)),
+        new AstNumber(1, ObjTypeFunda::eBool)),
+      new AstOperator(AstOperator::eAnd,
+        new AstCtList(
+          new AstNumber(1, ObjTypeFunda::eBool),
+          new AstNumber(0, ObjTypeFunda::eBool),
+          new AstOperator("=<", new AstSymbol("x"), new AstNumber(0, ObjTypeFunda::eBool)))),
+      new AstSymbol("x")),
+    true, spec);
 }
 
 TEST_F(IrGenTest, MAKE_TEST_NAME(
@@ -747,6 +809,67 @@ TEST_F(IrGenTest, MAKE_TEST_NAME(
     << amendAst(ast) << amend(&ee.module());
 }
 
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_function_defintion_AND_a_pointer_to_it_looked_up_once,
+    THEN_calling_the_pointer_repeatedly_executes_the_function)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> ast(
+    pe.mkFunDef("foo",
+      AstFunDef::createArgs(
+        new AstDataDef("x", ObjTypeFunda::eInt),
+        new AstDataDef("y", ObjTypeFunda::eInt)),
+      new AstObjTypeSymbol(ObjTypeFunda::eInt),
+      new AstOperator('*',
+        new AstSymbol("x"),
+        new AstSymbol("y"))));
+  UUT.m_semanticAnalizer.analyze(*ast.get());
+  ExecutionEngineApater ee(UUT.genIr(*ast));
+
+  // exercise
+  const auto foo = ee.lookup<int(int, int)>(".foo");
+
+  // verify
+  ASSERT_TRUE(foo != nullptr) << amendAst(ast) << amend(&ee.module());
+  EXPECT_EQ(3 * 4, foo(3, 4));
+  EXPECT_EQ(5 * 6, foo(5, 6));
+  EXPECT_TRUE(ee.lookup<int(int, int)>(".bar") == nullptr);
+}
+
+int twiceOf(int x) {
+  return 2 * x;
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_host_function_declaration_without_body_AND_a_function_calling_it,
+    THEN_the_call_calls_the_host_function_mapped_to_the_declaration)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> ast(new AstSeq(
+    new AstFunDef("twice",
+      AstFunDef::createArgs(new AstDataDef("x", ObjTypeFunda::eInt)),
+      new AstObjTypeSymbol(ObjTypeFunda::eInt), nullptr),
+    pe.mkFunDef("foo",
+      AstFunDef::createArgs(new AstDataDef("x", ObjTypeFunda::eInt)),
+      new AstObjTypeSymbol(ObjTypeFunda::eInt),
+      new AstOperator('+',
+        new AstFunCall(
+          new AstSymbol("twice"), new AstCtList(new AstSymbol("x"))),
+        new AstNumber(1)))));
+  UUT.m_semanticAnalizer.analyze(*ast.get());
+  ExecutionEngineApater ee(UUT.genIr(*ast));
+
+  // exercise
+  ee.addGlobalMapping(".twice", reinterpret_cast<void*>(&twiceOf));
+  const auto foo = ee.lookup<int(int)>(".foo");
+
+  // verify
+  ASSERT_TRUE(foo != nullptr) << amendAst(ast) << amend(&ee.module());
+  EXPECT_EQ(2 * 20 + 1, foo(20)) << amendAst(ast) << amend(&ee.module());
+}
+
 TEST_F(IrGenTest, MAKE_TEST_NAME2(
     GIVEN_a_function_defintion_returning_a_value,
     THEN_JIT_executing_it_returns_that_value)) {
@@ -827,6 +950,235 @@ TEST_F(IrGenTest, MAKE_TEST_NAME(
     2 * 1, "");
 }
 
+/** Returns: fun get(q: raw*mut-int) int = *q$ */
+AstFunDef* mkGetFunDef(GenParserExt& pe) {
+  return pe.mkFunDef("get",
+    AstFunDef::createArgs(new AstDataDef("q",
+      new AstObjTypePtr(new AstObjTypeQuali(
+        ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt))))),
+    new AstObjTypeSymbol(ObjTypeFunda::eInt),
+    new AstOperator(AstOperator::eDeref, new AstSymbol("q")));
+}
+
+/** Returns an AST which raw_new's a mutable int initialized to 42, assigns 77
+to it, and then returns its value, read either directly via dereferencing or,
+letting the new object escape, via a call to the function get. The pointer
+variable p is mutable if isPtrMutable is true. */
+AstObject* mkRawNewAndDelete(
+  GenParserExt& pe, bool doesEscape, bool isPtrMutable = false) {
+  const auto mkMutInt = []() {
+    return new AstObjTypeQuali(
+      ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt));
+  };
+  AstObjType* ptrType = new AstObjTypePtr(mkMutInt());
+  if (isPtrMutable) { ptrType = new AstObjTypeQuali(ObjType::eMutable, ptrType); }
+  AstObject* read = new AstOperator(AstOperator::eDeref, new AstSymbol("p"));
+  if (doesEscape) {
+    read = new AstFunCall(
+      new AstSymbol("get"), new AstCtList(new AstSymbol("p")));
+  }
+  return new AstSeq(mkGetFunDef(pe),
+    new AstSeq(
+      new AstDataDef("p", ptrType,
+        new AstRawNew(mkMutInt(), new AstCtList(new AstNumber(42)))),
+      new AstOperator('=',
+        new AstOperator(AstOperator::eDeref, new AstSymbol("p")),
+        new AstNumber(77)),
+      new AstDataDef("x", ObjTypeFunda::eInt, read),
+      new AstRawDelete(new AstSymbol("p")),
+      new AstSymbol("x")));
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_raw_new_and_a_raw_delete,
+    THEN_the_new_data_object_can_be_accessed_via_the_returned_pointer_until_it_is_deleted)) {
+  string spec = "Example: the new data object does not escape";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(mkRawNewAndDelete(pe, false), 77, spec);
+
+  spec = "Example: the new data object escapes";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(mkRawNewAndDelete(pe, true), 77, spec);
+
+  spec = "Example: the new data object escapes, arena allocation";
+  {
+    IrGen::Options options;
+    options.m_isArenaAllocEnabled = true;
+    TestingIrGen UUT(options);
+    GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+    testgenIr<int>(
+      UUT, pe.mkMainFunDef(mkRawNewAndDelete(pe, true)), spec, 77, ".main");
+  }
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_raw_new_and_a_raw_delete,
+    THEN_only_an_escaping_new_data_object_is_allocated_by_the_runtime_AND_with_arena_allocation_there_is_no_free_but_a_release_when_main_returns)) {
+  struct Example {
+    string m_spec;
+    bool m_doesEscape;
+    bool m_isArenaAllocEnabled;
+    set<string> m_expectedRuntimeFunctions;
+  };
+  const vector<Example> examples{
+    {"Example: not escaping", false, false, {}},
+    {"Example: escaping", true, false, {"efrt_alloc", "efrt_free"}},
+    {"Example: escaping, arena allocation", true, true,
+      {"efrt_arena_alloc", "efrt_arena_release"}}};
+  const vector<string> runtimeFunctions{
+    "efrt_alloc", "efrt_free", "efrt_arena_alloc", "efrt_arena_release"};
+
+  for (const auto& example : examples) {
+    // setup
+    IrGen::Options options;
+    options.m_isArenaAllocEnabled = example.m_isArenaAllocEnabled;
+    TestingIrGen UUT(options);
+    GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+    unique_ptr<AstObject> astRoot(
+      pe.mkMainFunDef(mkRawNewAndDelete(pe, example.m_doesEscape)));
+
+    // execute
+    const auto module = genIrForInspection(UUT, *astRoot);
+
+    // verify
+    for (const auto& function : runtimeFunctions) {
+      const auto isExpected =
+        example.m_expectedRuntimeFunctions.count(function) != 0;
+      EXPECT_EQ(isExpected, module->getFunction(function) != nullptr)
+        << "runtime function: " << function << "\n"
+        << amendSpec(example.m_spec) << amend(module);
+    }
+  }
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_raw_delete_of_a_mutable_pointer_variable,
+    THEN_the_size_of_the_pointee_is_passed_to_efrt_free)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> astRoot(
+    pe.mkMainFunDef(mkRawNewAndDelete(pe, true, true)));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto efrtFree = module->getFunction("efrt_free");
+  ASSERT_TRUE(efrtFree != nullptr) << amend(module);
+  ASSERT_EQ(1U, efrtFree->getNumUses()) << amend(module);
+  const auto call = dyn_cast<CallInst>(efrtFree->user_back());
+  ASSERT_TRUE(call != nullptr) << amend(module);
+  EXPECT_EQ(ConstantExpr::getSizeOf(Type::getInt32Ty(module->getContext())),
+    call->getArgOperand(1))
+    << amend(module);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_recursive_call_in_tail_position,
+    THEN_it_is_a_musttail_call_AND_deep_recursion_does_not_grow_the_stack)) {
+  // count(n, acc) = if n == 0 then acc else count(n-1, acc+1)
+  const auto mkCount = [](GenParserExt& pe) {
+    return pe.mkFunDef("count",
+      AstFunDef::createArgs(
+        new AstDataDef("n", ObjTypeFunda::eInt),
+        new AstDataDef("acc", ObjTypeFunda::eInt)),
+      new AstObjTypeSymbol(ObjTypeFunda::eInt),
+      new AstIf(
+        new AstOperator("==", new AstSymbol("n"), new AstNumber(0)),
+        new AstSymbol("acc"),
+        new AstFunCall(new AstSymbol("count"),
+          new AstCtList(
+            new AstOperator('-', new AstSymbol("n"), new AstNumber(1)),
+            new AstOperator('+', new AstSymbol("acc"), new AstNumber(1))))));
+  };
+
+  {
+    // setup
+    TestingIrGen UUT;
+    GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+    unique_ptr<AstObject> astRoot(mkCount(pe));
+
+    // execute
+    const auto module = genIrForInspection(UUT, *astRoot);
+
+    // verify
+    const auto functionIr = module->getFunction(".count");
+    ASSERT_TRUE(functionIr != nullptr);
+    int mustTailCallCnt = 0;
+    for (const auto& bb : *functionIr) {
+      for (const auto& inst : bb) {
+        const auto call = dyn_cast<CallInst>(&inst);
+        if (call && call->isMustTailCall()) { ++mustTailCallCnt; }
+      }
+    }
+    EXPECT_EQ(1, mustTailCallCnt) << amend(module);
+  }
+
+  string spec = "A recursion depth which would overflow the stack if each call "
+                "needed a stack frame";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstSeq(
+      mkCount(pe),
+      new AstFunCall(new AstSymbol("count"),
+        new AstCtList(new AstNumber(10000000), new AstNumber(0)))),
+    10000000, spec);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_calls_in_tail_position_passing_the_address_of_an_element_or_a_member_of_a_local,
+    THEN_the_calls_are_not_marked_tail)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  // fun g: (p:*int) int = 0$
+  // class c: m:int$ end$
+  // fun f1: () int = (val a:[4]int$; g(&a[0]))$
+  // fun f2: () int = (val x:c$; g(&x.m))$
+  unique_ptr<AstObject> astRoot(pe.mkFunDef("foo", ObjTypeFunda::eInt,
+    new AstSeq(
+      pe.mkFunDef("g",
+        AstFunDef::createArgs(new AstDataDef(
+          "p", new AstObjTypePtr(new AstObjTypeSymbol(ObjTypeFunda::eInt)))),
+        new AstObjTypeSymbol(ObjTypeFunda::eInt), new AstNumber(0)),
+      new AstClassDef("c",
+        new AstDataDef("m", new AstObjTypeSymbol(ObjTypeFunda::eInt),
+          StorageDuration::eMember)),
+      pe.mkFunDef("f1", ObjTypeFunda::eInt,
+        new AstSeq(
+          new AstDataDef("a",
+            new AstObjTypeArray(4, new AstObjTypeSymbol(ObjTypeFunda::eInt))),
+          new AstFunCall(new AstSymbol("g"),
+            new AstCtList(new AstOperator(AstOperator::eAddrOf,
+              new AstOperator(AstOperator::eIndex, new AstSymbol("a"),
+                new AstNumber(0))))))),
+      pe.mkFunDef("f2", ObjTypeFunda::eInt,
+        new AstSeq(new AstDataDef("x", new AstObjTypeSymbol("c")),
+          new AstFunCall(new AstSymbol("g"),
+            new AstCtList(new AstOperator(AstOperator::eAddrOf,
+              new AstMemberAccess(new AstSymbol("x"), "m")))))),
+      new AstNumber(0))));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  for (const auto& caller : {".foo.f1", ".foo.f2"}) {
+    const auto callerIr = module->getFunction(caller);
+    ASSERT_TRUE(callerIr != nullptr) << caller << amend(module);
+    int callCnt = 0;
+    for (const auto& bb : *callerIr) {
+      for (const auto& inst : bb) {
+        const auto call = dyn_cast<CallInst>(&inst);
+        if (!call || call->getCalledFunction() != module->getFunction(".foo.g")) {
+          continue;
+        }
+        ++callCnt;
+        EXPECT_FALSE(call->isTailCall()) << caller << amend(module);
+      }
+    }
+    EXPECT_EQ(1, callCnt) << caller << amend(module);
+  }
+}
+
 TEST_F(IrGenTest, MAKE_TEST_NAME2(
     GIVEN_a_function_call_before_that_functions_definition,
     THEN_that_changes_nothing)) {
@@ -1188,3 +1540,1036 @@ TEST_F(IrGenTest, MAKE_TEST_NAME2(
       new AstSymbol("x")),
     0, spec);
 }
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_loads_and_stores_of_data_objects,
+    THEN_they_carry_TBAA_metadata)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> astRoot(
+    pe.mkFunDef("foo",
+      AstFunDef::createArgs(
+        new AstDataDef("p",
+          new AstObjTypePtr(new AstObjTypeSymbol(ObjTypeFunda::eDouble)))),
+      new AstObjTypeSymbol(ObjTypeFunda::eDouble),
+      new AstSeq(
+        new AstDataDef("x",
+          new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+          new AstNumber(1)),
+        new AstOperator('=', new AstSymbol("x"), new AstNumber(2)),
+        new AstOperator(AstOperator::eDeref, new AstSymbol("p")))));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto functionIr = module->getFunction(".foo");
+  ASSERT_TRUE(functionIr != nullptr);
+  int memoryAccessCnt = 0;
+  for (const auto& bb : *functionIr) {
+    for (const auto& inst : bb) {
+      if (isa<LoadInst>(inst) || isa<StoreInst>(inst)) {
+        ++memoryAccessCnt;
+        EXPECT_TRUE(inst.getMetadata(LLVMContext::MD_tbaa) != nullptr)
+          << amendAst(astRoot.get()) << amend(module);
+      }
+    }
+  }
+  EXPECT_LT(0, memoryAccessCnt) << amend(module);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_function_with_a_pointer_to_immutable_parameter,
+    THEN_that_parameter_is_noalias_and_readonly)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> astRoot(
+    pe.mkFunDef("foo",
+      AstFunDef::createArgs(
+        new AstDataDef("p",
+          new AstObjTypePtr(new AstObjTypeSymbol(ObjTypeFunda::eInt))),
+        new AstDataDef("q",
+          new AstObjTypePtr(new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt))))),
+      new AstObjTypeSymbol(ObjTypeFunda::eInt),
+      new AstOperator(AstOperator::eDeref, new AstSymbol("p"))));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto functionIr = module->getFunction(".foo");
+  ASSERT_TRUE(functionIr != nullptr);
+  EXPECT_TRUE(functionIr->hasParamAttribute(0, Attribute::NoAlias))
+    << amend(module);
+  EXPECT_TRUE(functionIr->hasParamAttribute(0, Attribute::ReadOnly))
+    << amend(module);
+  EXPECT_FALSE(functionIr->hasParamAttribute(1, Attribute::NoAlias))
+    << amend(module);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_simd_values_and_lane_wise_operators,
+    THEN_the_operators_act_on_each_lane)) {
+
+  string spec = "splat, lane-wise add and horizontal add";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstSeq(
+      new AstDataDef("v",
+        new AstObjTypeSimd(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+        StorageDuration::eLocal,
+        new AstCast(
+          new AstObjTypeSimd(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+          new AstNumber(2))),
+      new AstOperator(AstOperator::eHAdd,
+        new AstOperator('+', new AstSymbol("v"), new AstSymbol("v")))),
+    16, spec);
+
+  spec = "withlane replaces exactly one lane, lane extracts it again";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstSeq(
+      new AstDataDef("v",
+        new AstObjTypeSimd(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+        StorageDuration::eLocal,
+        new AstOperator(AstOperator::eWithLane,
+          new AstCtList(
+            new AstCast(
+              new AstObjTypeSimd(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+              new AstNumber(1)),
+            new AstNumber(2),
+            new AstNumber(42)))),
+      new AstOperator('+',
+        new AstOperator(AstOperator::eLane,
+          new AstSymbol("v"), new AstNumber(2)),
+        new AstOperator(AstOperator::eHMul, new AstSymbol("v")))),
+    42 + 42, spec);
+
+  spec = "horizontal add of double lanes";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_DOUBLE(
+    new AstOperator(AstOperator::eHAdd,
+      new AstCast(
+        new AstObjTypeSimd(8, new AstObjTypeSymbol(ObjTypeFunda::eDouble)),
+        new AstNumber(0.5, ObjTypeFunda::eDouble))),
+    4.0, spec);
+
+  spec = "comparison yields a simd of bool";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_BOOL(
+    new AstOperator(AstOperator::eLane,
+      new AstOperator("==",
+        new AstCast(
+          new AstObjTypeSimd(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+          new AstNumber(3)),
+        new AstCast(
+          new AstObjTypeSimd(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+          new AstNumber(3))),
+      new AstNumber(1)),
+    true, spec);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_an_array_and_index_operators,
+    THEN_the_elements_can_be_written_and_read)) {
+  string spec = "Example: fill an array in a loop and sum up its elements";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstSeq(
+      new AstDataDef("a",
+        new AstObjTypeQuali(ObjType::eMutable,
+          new AstObjTypeArray(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)))),
+      new AstDataDef("i",
+        new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+        new AstNumber(0)),
+      new AstDataDef("sum",
+        new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+        new AstNumber(0)),
+      new AstLoop(
+        new AstOperator('<', new AstSymbol("i"), new AstNumber(4)),
+        new AstSeq(
+          new AstOperator('=',
+            new AstOperator(AstOperator::eIndex,
+              new AstSymbol("a"), new AstSymbol("i")),
+            new AstOperator('+', new AstSymbol("i"), new AstNumber(1))),
+          new AstOperator('=',
+            new AstSymbol("sum"),
+            new AstOperator('+',
+              new AstSymbol("sum"),
+              new AstOperator(AstOperator::eIndex,
+                new AstSymbol("a"), new AstSymbol("i")))),
+          new AstOperator('=',
+            new AstSymbol("i"),
+            new AstOperator('+', new AstSymbol("i"), new AstNumber(1))))),
+      new AstSymbol("sum")),
+    1 + 2 + 3 + 4, spec);
+
+  spec = "Example: elements are default initialized to zero";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstSeq(
+      new AstDataDef("a",
+        new AstObjTypeArray(4, new AstObjTypeSymbol(ObjTypeFunda::eInt))),
+      new AstOperator(AstOperator::eIndex, new AstSymbol("a"), new AstNumber(3))),
+    0, spec);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_less_operator,
+    THEN_it_compares_according_to_the_operands_type)) {
+  string spec = "Example: int is signed";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_BOOL(
+    new AstOperator('<', new AstNumber(-1), new AstNumber(1)), true, spec);
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_BOOL(
+    new AstOperator('<', new AstNumber(1), new AstNumber(1)), false, spec);
+
+  spec = "Example: double";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_BOOL(
+    new AstOperator('<',
+      new AstNumber(1.5, ObjTypeFunda::eDouble),
+      new AstNumber(2.5, ObjTypeFunda::eDouble)),
+    true, spec);
+}
+
+namespace {
+bool containsBoundsCheck(const Function& functionIr) {
+  for (const auto& bb : functionIr) {
+    for (const auto& inst : bb) {
+      const auto call = dyn_cast<CallInst>(&inst);
+      if (call && call->getIntrinsicID() == Intrinsic::trap) { return true; }
+    }
+  }
+  return false;
+}
+
+/** fun foo(i :int) :int = val a :[4]int$ a[i] $ */
+AstObject* mkFunIndexingWithArg(GenParserExt& pe) {
+  return pe.mkFunDef("foo",
+    AstFunDef::createArgs(
+      new AstDataDef("i", new AstObjTypeSymbol(ObjTypeFunda::eInt))),
+    new AstObjTypeSymbol(ObjTypeFunda::eInt),
+    new AstSeq(
+      new AstDataDef("a",
+        new AstObjTypeArray(4, new AstObjTypeSymbol(ObjTypeFunda::eInt))),
+      new AstOperator(AstOperator::eIndex,
+        new AstSymbol("a"), new AstSymbol("i"))));
+}
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_default_initialized_array,
+    THEN_its_initial_value_is_a_zeroinitializer)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> astRoot(mkFunIndexingWithArg(pe));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto functionIr = module->getFunction(".foo");
+  ASSERT_TRUE(functionIr != nullptr);
+  int zeroInitializerCnt = 0;
+  for (const auto& bb : *functionIr) {
+    for (const auto& inst : bb) {
+      for (const auto& operand : inst.operands()) {
+        EXPECT_FALSE(isa<ConstantArray>(operand.get())) << amend(module);
+        if (isa<ConstantAggregateZero>(operand.get())) { ++zeroInitializerCnt; }
+      }
+    }
+  }
+  EXPECT_LT(0, zeroInitializerCnt) << amend(module);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_an_AST_already_passed_to_genIr,
+    THEN_genIr_of_the_same_or_a_second_IrGen_again_generates_valid_IR)) {
+  // setup
+  TestingIrGen UUT;
+  TestingIrGen UUT2;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> astRoot(mkFunIndexingWithArg(pe));
+  const auto firstModule = genIrForInspection(UUT, *astRoot);
+  ASSERT_TRUE(firstModule->getFunction(".foo") != nullptr);
+
+  // execute
+  const auto secondModule = UUT.genIr(*astRoot);
+  const auto thirdModule = UUT2.genIr(*astRoot);
+
+  // verify
+  EXPECT_TRUE(secondModule->getFunction(".foo") != nullptr);
+  EXPECT_TRUE(thirdModule->getFunction(".foo") != nullptr);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_an_index_operator_whose_index_is_provably_in_range,
+    THEN_no_bounds_check_is_emitted)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> astRoot(
+    pe.mkFunDef("foo",
+      AstFunDef::createArgs(),
+      new AstObjTypeSymbol(ObjTypeFunda::eInt),
+      new AstSeq(
+        new AstDataDef("a",
+          new AstObjTypeArray(4, new AstObjTypeSymbol(ObjTypeFunda::eInt))),
+        new AstDataDef("i",
+          new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+          new AstNumber(0)),
+        new AstDataDef("sum",
+          new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+          new AstNumber(0)),
+        new AstLoop(
+          new AstOperator('<', new AstSymbol("i"), new AstNumber(4)),
+          new AstSeq(
+            new AstOperator('=',
+              new AstSymbol("sum"),
+              new AstOperator('+',
+                new AstSymbol("sum"),
+                new AstOperator(AstOperator::eIndex,
+                  new AstSymbol("a"), new AstSymbol("i")))),
+            new AstOperator('=',
+              new AstSymbol("i"),
+              new AstOperator('+', new AstSymbol("i"), new AstNumber(1))))),
+        new AstSymbol("sum"))));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto functionIr = module->getFunction(".foo");
+  ASSERT_TRUE(functionIr != nullptr);
+  EXPECT_FALSE(containsBoundsCheck(*functionIr))
+    << amendAst(astRoot.get()) << amend(module);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_an_index_operator_whose_index_is_not_provably_in_range,
+    THEN_a_bounds_check_is_emitted_unless_bounds_checks_are_disabled)) {
+  {
+    // setup
+    TestingIrGen UUT;
+    GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+    unique_ptr<AstObject> astRoot(mkFunIndexingWithArg(pe));
+
+    // execute
+    const auto module = genIrForInspection(UUT, *astRoot);
+
+    // verify
+    const auto functionIr = module->getFunction(".foo");
+    ASSERT_TRUE(functionIr != nullptr);
+    EXPECT_TRUE(containsBoundsCheck(*functionIr))
+      << amendAst(astRoot.get()) << amend(module);
+  }
+
+  {
+    // setup
+    IrGen::Options options;
+    options.m_isBoundsCheckEnabled = false;
+    TestingIrGen UUT{options};
+    GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+    unique_ptr<AstObject> astRoot(mkFunIndexingWithArg(pe));
+
+    // execute
+    const auto module = genIrForInspection(UUT, *astRoot);
+
+    // verify
+    const auto functionIr = module->getFunction(".foo");
+    ASSERT_TRUE(functionIr != nullptr);
+    EXPECT_FALSE(containsBoundsCheck(*functionIr))
+      << amendAst(astRoot.get()) << amend(module);
+  }
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_64bit_unsigned_and_float_types,
+    THEN_literals_operators_and_casts_respect_width_and_signedness)) {
+  string spec = "Example: int64 literal not representable by a double";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_INT64(
+    new AstOperator('+',
+      new AstNumber(9007199254740993LL, ObjTypeFunda::eInt64),
+      new AstNumber(1, ObjTypeFunda::eInt64)),
+    9007199254740994LL, spec);
+
+  spec = "Example: unsigned division";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_UINT32(
+    new AstOperator('/',
+      new AstNumber(4294967294u, ObjTypeFunda::eUInt32),
+      new AstNumber(2, ObjTypeFunda::eUInt32)),
+    2147483647u, spec);
+
+  spec = "Example: unsigned comparison";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_BOOL(
+    new AstOperator('<',
+      new AstNumber(1, ObjTypeFunda::eUInt32),
+      new AstNumber(4294967295u, ObjTypeFunda::eUInt32)),
+    true, spec);
+
+  spec = "Example: float arithmetic";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_FLOAT(
+    new AstOperator('*',
+      new AstNumber(1.5, ObjTypeFunda::eFloat),
+      new AstNumber(2.0, ObjTypeFunda::eFloat)),
+    3.0f, spec);
+
+  spec = "int -> int64 sign extends";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_INT64(
+    new AstCast(
+      new AstObjTypeSymbol(ObjTypeFunda::eInt64),
+      new AstOperator('-', new AstNumber(1))),
+    -1, spec);
+
+  spec = "uint32 -> int64 zero extends";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_INT64(
+    new AstCast(
+      new AstObjTypeSymbol(ObjTypeFunda::eInt64),
+      new AstNumber(4294967295u, ObjTypeFunda::eUInt32)),
+    4294967295LL, spec);
+
+  spec = "int64 -> int truncates";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstCast(
+      new AstObjTypeSymbol(ObjTypeFunda::eInt),
+      new AstNumber(4294967338LL, ObjTypeFunda::eInt64)),
+    42, spec);
+
+  spec = "float -> double";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_DOUBLE(
+    new AstCast(
+      new AstObjTypeSymbol(ObjTypeFunda::eDouble),
+      new AstNumber(1.5, ObjTypeFunda::eFloat)),
+    1.5, spec);
+
+  spec = "uint32 -> double";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_DOUBLE(
+    new AstCast(
+      new AstObjTypeSymbol(ObjTypeFunda::eDouble),
+      new AstNumber(4294967295u, ObjTypeFunda::eUInt32)),
+    4294967295.0, spec);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_call_to_a_builtin_math_function,
+    THEN_it_computes_the_mathematical_result)) {
+  string spec = "Example: sqrt";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_DOUBLE(
+    new AstFunCall(new AstSymbol("sqrt"),
+      new AstCtList(new AstNumber(2.25, ObjTypeFunda::eDouble))),
+    1.5, spec);
+
+  spec = "Example: fma";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_FLOAT(
+    new AstFunCall(new AstSymbol("fma"),
+      new AstCtList(
+        new AstNumber(2.0, ObjTypeFunda::eFloat),
+        new AstNumber(3.0, ObjTypeFunda::eFloat),
+        new AstNumber(0.5, ObjTypeFunda::eFloat))),
+    6.5f, spec);
+
+  spec = "Example: floor, ceil, trunc and round";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_DOUBLE(
+    new AstFunCall(new AstSymbol("floor"),
+      new AstCtList(new AstNumber(-1.5, ObjTypeFunda::eDouble))),
+    -2.0, spec);
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_DOUBLE(
+    new AstFunCall(new AstSymbol("ceil"),
+      new AstCtList(new AstNumber(-1.5, ObjTypeFunda::eDouble))),
+    -1.0, spec);
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_DOUBLE(
+    new AstFunCall(new AstSymbol("trunc"),
+      new AstCtList(new AstNumber(-1.5, ObjTypeFunda::eDouble))),
+    -1.0, spec);
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_DOUBLE(
+    new AstFunCall(new AstSymbol("round"),
+      new AstCtList(new AstNumber(-1.5, ObjTypeFunda::eDouble))),
+    -2.0, spec);
+
+  spec = "Example: abs of a floating point and of a signed integral type";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_DOUBLE(
+    new AstFunCall(new AstSymbol("abs"),
+      new AstCtList(new AstNumber(-1.5, ObjTypeFunda::eDouble))),
+    1.5, spec);
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstFunCall(new AstSymbol("abs"),
+      new AstCtList(new AstOperator('-', new AstNumber(42)))),
+    42, spec);
+
+  spec = "min and max respect signedness";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstFunCall(new AstSymbol("min"),
+      new AstCtList(new AstOperator('-', new AstNumber(1)), new AstNumber(42))),
+    -1, spec);
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_UINT32(
+    new AstFunCall(new AstSymbol("max"),
+      new AstCtList(
+        new AstNumber(4294967295u, ObjTypeFunda::eUInt32),
+        new AstNumber(42, ObjTypeFunda::eUInt32))),
+    4294967295u, spec);
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_DOUBLE(
+    new AstFunCall(new AstSymbol("max"),
+      new AstCtList(
+        new AstNumber(1.5, ObjTypeFunda::eDouble),
+        new AstNumber(-2.0, ObjTypeFunda::eDouble))),
+    1.5, spec);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_branch_hint_as_condition_of_an_if_or_a_loop,
+    THEN_the_conditional_branch_has_according_branch_weights)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> astRoot(
+    pe.mkFunDef("foo",
+      AstFunDef::createArgs(new AstDataDef("x", ObjTypeFunda::eInt)),
+      new AstObjTypeSymbol(ObjTypeFunda::eInt),
+      new AstSeq(
+        new AstLoop(
+          new AstFunCall(new AstSymbol("expect_trips"),
+            new AstCtList(
+              new AstOperator('<', new AstSymbol("x"), new AstNumber(10)),
+              new AstNumber(100))),
+          new AstNop()),
+        new AstIf(
+          new AstFunCall(new AstSymbol("unlikely"),
+            new AstCtList(
+              new AstOperator('<', new AstSymbol("x"), new AstNumber(3)))),
+          new AstNumber(1),
+          new AstNumber(2)))));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto functionIr = module->getFunction(".foo");
+  ASSERT_TRUE(functionIr != nullptr);
+  vector<const BranchInst*> condBranches;
+  for (const auto& bb : *functionIr) {
+    const auto branch = dyn_cast<BranchInst>(bb.getTerminator());
+    if (branch && branch->isConditional()) { condBranches.push_back(branch); }
+  }
+  ASSERT_EQ(2U, condBranches.size()) << amend(module);
+  uint64_t trueWeight{};
+  uint64_t falseWeight{};
+  ASSERT_TRUE(condBranches[0]->extractProfMetadata(trueWeight, falseWeight))
+    << amend(module);
+  EXPECT_EQ(100U, trueWeight) << amend(module);
+  EXPECT_EQ(1U, falseWeight) << amend(module);
+  ASSERT_TRUE(condBranches[1]->extractProfMetadata(trueWeight, falseWeight))
+    << amend(module);
+  EXPECT_LT(trueWeight, falseWeight) << amend(module);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_loop_with_loop_hints,
+    THEN_its_back_edge_has_according_llvm_loop_metadata)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  LoopHints hints;
+  hints.m_vectorizeWidth = 4;
+  hints.m_unrollCount = 2;
+  hints.m_isIndependent = true;
+  unique_ptr<AstObject> astRoot(
+    pe.mkFunDef("foo", ObjTypeFunda::eInt,
+      new AstSeq(
+        new AstDataDef("a",
+          new AstObjTypeQuali(ObjType::eMutable,
+            new AstObjTypeArray(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)))),
+        new AstDataDef("i",
+          new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+          new AstNumber(0)),
+        new AstLoop(
+          new AstOperator('<', new AstSymbol("i"), new AstNumber(4)),
+          new AstSeq(
+            new AstOperator('=',
+              new AstOperator(AstOperator::eIndex,
+                new AstSymbol("a"), new AstSymbol("i")),
+              new AstSymbol("i")),
+            new AstOperator('=',
+              new AstSymbol("i"),
+              new AstOperator('+', new AstSymbol("i"), new AstNumber(1)))),
+          hints),
+        new AstSymbol("i"))));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto functionIr = module->getFunction(".foo");
+  ASSERT_TRUE(functionIr != nullptr);
+  const MDNode* loopId{};
+  for (const auto& bb : *functionIr) {
+    if (const auto md = bb.getTerminator()->getMetadata(LLVMContext::MD_loop)) {
+      EXPECT_TRUE(loopId == nullptr) << amend(module);
+      loopId = md;
+    }
+  }
+  ASSERT_TRUE(loopId != nullptr) << amend(module);
+  EXPECT_EQ(loopId, loopId->getOperand(0).get()) << amend(module);
+  set<string> hintNames;
+  for (unsigned i = 1; i < loopId->getNumOperands(); ++i) {
+    const auto hint = cast<MDNode>(loopId->getOperand(i));
+    hintNames.insert(cast<MDString>(hint->getOperand(0))->getString().str());
+  }
+  EXPECT_EQ(
+    (set<string>{"llvm.loop.vectorize.enable", "llvm.loop.vectorize.width",
+      "llvm.loop.unroll.count", "llvm.loop.parallel_accesses"}),
+    hintNames) << amend(module);
+
+  int accessGroupCnt = 0;
+  for (const auto& bb : *functionIr) {
+    for (const auto& inst : bb) {
+      if (inst.getMetadata(LLVMContext::MD_access_group)) { ++accessGroupCnt; }
+    }
+  }
+  EXPECT_LT(0, accessGroupCnt) << amend(module);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_nested_loops_both_hinted_to_be_independent,
+    THEN_the_inner_loops_accesses_are_in_the_access_groups_of_both_loops)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  LoopHints hints;
+  hints.m_isIndependent = true;
+  unique_ptr<AstObject> astRoot(
+    pe.mkFunDef("foo", ObjTypeFunda::eInt,
+      new AstSeq(
+        new AstDataDef("a",
+          new AstObjTypeQuali(ObjType::eMutable,
+            new AstObjTypeArray(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)))),
+        new AstDataDef("i",
+          new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+          new AstNumber(0)),
+        new AstDataDef("j",
+          new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+          new AstNumber(0)),
+        new AstLoop(
+          new AstOperator('<', new AstSymbol("i"), new AstNumber(2)),
+          new AstSeq(
+            new AstOperator('=', new AstSymbol("j"), new AstNumber(0)),
+            new AstLoop(
+              new AstOperator('<', new AstSymbol("j"), new AstNumber(4)),
+              new AstSeq(
+                new AstOperator('=',
+                  new AstOperator(AstOperator::eIndex,
+                    new AstSymbol("a"), new AstSymbol("j")),
+                  new AstSymbol("i")),
+                new AstOperator('=',
+                  new AstSymbol("j"),
+                  new AstOperator('+', new AstSymbol("j"), new AstNumber(1)))),
+              hints),
+            new AstOperator('=',
+              new AstSymbol("i"),
+              new AstOperator('+', new AstSymbol("i"), new AstNumber(1)))),
+          hints),
+        new AstSymbol("i"))));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto functionIr = module->getFunction(".foo");
+  ASSERT_TRUE(functionIr != nullptr);
+  vector<const MDNode*> accessGroups;
+  for (const auto& bb : *functionIr) {
+    if (const auto loopId = bb.getTerminator()->getMetadata(LLVMContext::MD_loop)) {
+      for (unsigned i = 1; i < loopId->getNumOperands(); ++i) {
+        const auto hint = cast<MDNode>(loopId->getOperand(i));
+        if (cast<MDString>(hint->getOperand(0))->getString() ==
+          "llvm.loop.parallel_accesses") {
+          accessGroups.push_back(cast<MDNode>(hint->getOperand(1)));
+        }
+      }
+    }
+  }
+  ASSERT_EQ(2U, accessGroups.size()) << amend(module);
+  ASSERT_NE(accessGroups[0], accessGroups[1]) << amend(module);
+
+  const auto isInAccessGroup = [](const Instruction& inst, const MDNode* group) {
+    const auto md = inst.getMetadata(LLVMContext::MD_access_group);
+    if (!md) { return false; }
+    if (md == group) { return true; }
+    for (const auto& operand : md->operands()) {
+      if (operand.get() == group) { return true; }
+    }
+    return false;
+  };
+  int inBothCnt = 0;
+  for (const auto& bb : *functionIr) {
+    for (const auto& inst : bb) {
+      if (isInAccessGroup(inst, accessGroups[0]) &&
+        isInAccessGroup(inst, accessGroups[1])) {
+        ++inBothCnt;
+      }
+    }
+  }
+  EXPECT_LT(0, inBothCnt) << amend(module);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_branch_hint,
+    THEN_it_evaluates_to_its_condition)) {
+  string spec = "Example: likely";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstIf(
+      new AstFunCall(new AstSymbol("likely"),
+        new AstCtList(new AstNumber(0, ObjTypeFunda::eBool))),
+      new AstNumber(77),
+      new AstNumber(42)),
+    42, spec);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_bitwise_shift_and_bit_counting_operators,
+    THEN_they_compute_the_bit_level_result)) {
+  string spec = "Example: and, or, xor";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator(AstOperator::eBitAnd,
+      new AstNumber(0x2e), new AstNumber(0x7b)),
+    0x2a, spec);
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator('|', new AstNumber(0x28), new AstNumber(0x02)), 0x2a, spec);
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator('^', new AstNumber(0x6b), new AstNumber(0x41)), 0x2a, spec);
+
+  spec = "Example: shift left";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator(AstOperator::eShl, new AstNumber(21), new AstNumber(1)),
+    42, spec);
+
+  spec = "The shift amount is taken modulo the bit width of the left operand";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator(AstOperator::eShl, new AstNumber(21), new AstNumber(33)),
+    42, spec);
+
+  spec = "Shift right of a signed type is arithmetic";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator(AstOperator::eShr,
+      new AstOperator('-', new AstNumber(84)),
+      new AstNumber(1)),
+    -42, spec);
+
+  spec = "Shift right of an unsigned type is logical";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_UINT32(
+    new AstOperator(AstOperator::eShr,
+      new AstNumber(4294967295u, ObjTypeFunda::eUInt32),
+      new AstNumber(31, ObjTypeFunda::eUInt32)),
+    1u, spec);
+
+  spec = "Example: ctpop counts the set bits";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator(AstOperator::eCtpop, new AstNumber(0xff0f)), 12, spec);
+
+  spec = "Example: ctlz and cttz count the leading/trailing zero bits";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator(AstOperator::eCtlz, new AstNumber(1)), 31, spec);
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator(AstOperator::eCttz, new AstNumber(8)), 3, spec);
+
+  spec = "ctlz and cttz of zero is the bit width";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator(AstOperator::eCtlz, new AstNumber(0)), 32, spec);
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstOperator(AstOperator::eCttz, new AstNumber(0)), 32, spec);
+
+  spec = "Example: bswap reverses the byte order";
+  TEST_GEN_IR_IN_IMPLICIT_FOO_RET_UINT32(
+    new AstOperator(AstOperator::eBswap,
+      new AstNumber(0x12345678u, ObjTypeFunda::eUInt32)),
+    0x78563412u, spec);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_mutable_class_object,
+    THEN_its_data_members_can_be_written_and_read)) {
+  string spec = "Example: assigned data member";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstSeq(
+      new AstClassDef("point",
+        new AstDataDef("x", new AstObjTypeSymbol(ObjTypeFunda::eChar),
+          StorageDuration::eMember),
+        new AstDataDef("y", new AstObjTypeSymbol(ObjTypeFunda::eInt),
+          StorageDuration::eMember)),
+      new AstDataDef("p",
+        new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol("point"))),
+      new AstOperator('=',
+        new AstMemberAccess(new AstSymbol("p"), "y"), new AstNumber(42)),
+      new AstMemberAccess(new AstSymbol("p"), "y")),
+    42, spec);
+
+  spec = "Data members are default initialized to zero";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstSeq(
+      new AstClassDef("point",
+        new AstDataDef("x", new AstObjTypeSymbol(ObjTypeFunda::eChar),
+          StorageDuration::eMember),
+        new AstDataDef("y", new AstObjTypeSymbol(ObjTypeFunda::eInt),
+          StorageDuration::eMember)),
+      new AstDataDef("p",
+        new AstObjTypeQuali(ObjType::eMutable, new AstObjTypeSymbol("point"))),
+      new AstOperator('=',
+        new AstMemberAccess(new AstSymbol("p"), "x"),
+        new AstNumber(1, ObjTypeFunda::eChar)),
+      new AstMemberAccess(new AstSymbol("p"), "y")),
+    0, spec);
+}
+
+namespace {
+/** fun foo() :int64 = $
+  class big = $ data a int64 $ data b int64 $ data c int64 $
+  fun get_b(x :big) :int64 = x.b
+  fun mk() :big = $ data r mut big $ r.b = 42 $ r $
+  get_b(mk()) $ */
+AstObject* mkFunPassingAndReturningLargeClass(GenParserExt& pe) {
+  return pe.mkFunDef("foo", ObjTypeFunda::eInt64,
+    new AstSeq(
+      new AstClassDef("big",
+        new AstDataDef("a", new AstObjTypeSymbol(ObjTypeFunda::eInt64),
+          StorageDuration::eMember),
+        new AstDataDef("b", new AstObjTypeSymbol(ObjTypeFunda::eInt64),
+          StorageDuration::eMember),
+        new AstDataDef("c", new AstObjTypeSymbol(ObjTypeFunda::eInt64),
+          StorageDuration::eMember)),
+      pe.mkFunDef("get_b",
+        AstFunDef::createArgs(
+          new AstDataDef("x", new AstObjTypeSymbol("big"))),
+        new AstObjTypeSymbol(ObjTypeFunda::eInt64),
+        new AstMemberAccess(new AstSymbol("x"), "b")),
+      pe.mkFunDef("mk", new AstObjTypeSymbol("big"),
+        new AstSeq(
+          new AstDataDef("r",
+            new AstObjTypeQuali(
+              ObjType::eMutable, new AstObjTypeSymbol("big"))),
+          new AstOperator('=',
+            new AstMemberAccess(new AstSymbol("r"), "b"),
+            new AstNumber(42, ObjTypeFunda::eInt64)),
+          new AstSymbol("r"))),
+      new AstFunCall(new AstSymbol("get_b"),
+        new AstCtList(new AstFunCall(new AstSymbol("mk"))))));
+}
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_functions_taking_and_returning_a_large_class_object,
+    THEN_the_argument_is_passed_by_pointer_and_the_result_via_an_sret_pointer)) {
+  string spec = "Example: the object created by mk is passed to get_b";
+  TEST_GEN_IR_0ARG(
+    mkFunPassingAndReturningLargeClass(pe), spec, int64_t, ".foo", 42);
+
+  spec = "The IR of the functions reflects the passing convention";
+  {
+    // setup
+    TestingIrGen UUT;
+    GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+    unique_ptr<AstObject> astRoot(mkFunPassingAndReturningLargeClass(pe));
+
+    // execute
+    const auto module = genIrForInspection(UUT, *astRoot);
+
+    // verify
+    const auto getBIr = module->getFunction(".foo.get_b");
+    ASSERT_TRUE(getBIr != nullptr);
+    EXPECT_TRUE(getBIr->getArg(0)->getType()->isPointerTy())
+      << amendSpec(spec) << amend(module);
+    EXPECT_TRUE(getBIr->hasParamAttribute(0, Attribute::ReadOnly))
+      << amendSpec(spec) << amend(module);
+    EXPECT_TRUE(getBIr->hasParamAttribute(0, Attribute::NoAlias))
+      << amendSpec(spec) << amend(module);
+
+    const auto mkIr = module->getFunction(".foo.mk");
+    ASSERT_TRUE(mkIr != nullptr);
+    EXPECT_TRUE(mkIr->hasStructRetAttr()) << amendSpec(spec) << amend(module);
+    EXPECT_TRUE(mkIr->getReturnType()->isVoidTy())
+      << amendSpec(spec) << amend(module);
+  }
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_function_taking_a_class_object_whose_data_members_are_small_but_whose_padding_makes_it_large,
+    THEN_the_argument_is_passed_by_pointer)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  // The data members sum up to 64 + 9 bits, but in memory the object occupies
+  // 24 bytes due to the bools occupying a byte each and the padding
+  auto dataMembers = new vector<AstDataDef*>{new AstDataDef("a",
+    new AstObjTypeSymbol(ObjTypeFunda::eInt64), StorageDuration::eMember)};
+  for (int i = 0; i < 9; ++i) {
+    dataMembers->push_back(new AstDataDef("b" + to_string(i),
+      new AstObjTypeSymbol(ObjTypeFunda::eBool), StorageDuration::eMember));
+  }
+  unique_ptr<AstObject> astRoot(pe.mkFunDef("foo", ObjTypeFunda::eInt64,
+    new AstSeq(new AstClassDef("flags", dataMembers),
+      pe.mkFunDef("get_a",
+        AstFunDef::createArgs(
+          new AstDataDef("x", new AstObjTypeSymbol("flags"))),
+        new AstObjTypeSymbol(ObjTypeFunda::eInt64),
+        new AstMemberAccess(new AstSymbol("x"), "a")),
+      new AstNumber(0, ObjTypeFunda::eInt64))));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto getAIr = module->getFunction(".foo.get_a");
+  ASSERT_TRUE(getAIr != nullptr) << amend(module);
+  EXPECT_TRUE(getAIr->getArg(0)->getType()->isPointerTy()) << amend(module);
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_a_function_taking_a_bool_and_a_char_and_returning_a_bool,
+    THEN_the_parameters_and_the_return_value_are_zero_extended)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> astRoot(pe.mkFunDef("foo",
+    AstFunDef::createArgs(
+      new AstDataDef("b", new AstObjTypeSymbol(ObjTypeFunda::eBool)),
+      new AstDataDef("c", new AstObjTypeSymbol(ObjTypeFunda::eChar))),
+    new AstObjTypeSymbol(ObjTypeFunda::eBool), new AstSymbol("b")));
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto fooIr = module->getFunction(".foo");
+  ASSERT_TRUE(fooIr != nullptr) << amend(module);
+  EXPECT_TRUE(fooIr->hasParamAttribute(0, Attribute::ZExt))
+    << amend(module);
+  EXPECT_TRUE(fooIr->hasParamAttribute(1, Attribute::ZExt))
+    << amend(module);
+  EXPECT_TRUE(fooIr->hasRetAttribute(Attribute::ZExt)) << amend(module);
+}
+
+namespace {
+/** fun foo() :int = $
+  data sum mut int = 0 $ data i mut int = 0 $
+  while i < 4 do $
+    i = i + 1 $
+    if i == 2 then sum = sum + 10 else sum = sum + 1 $
+  sum $ */
+AstObject* mkFunModifyingLocalsInLoopAndIf(GenParserExt& pe) {
+  const auto mutInt = [] {
+    return new AstObjTypeQuali(
+      ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eInt));
+  };
+  const auto increment = [](const string& name, int amount) {
+    return new AstOperator('=',
+      new AstSymbol(name),
+      new AstOperator('+', new AstSymbol(name), new AstNumber(amount)));
+  };
+  return pe.mkFunDef("foo", ObjTypeFunda::eInt,
+    new AstSeq(
+      new AstDataDef("sum", mutInt(), new AstNumber(0)),
+      new AstDataDef("i", mutInt(), new AstNumber(0)),
+      new AstLoop(
+        new AstOperator('<', new AstSymbol("i"), new AstNumber(4)),
+        new AstSeq(
+          increment("i", 1),
+          new AstIf(
+            new AstOperator(AstOperator::eEqualTo,
+              new AstSymbol("i"), new AstNumber(2)),
+            increment("sum", 10),
+            increment("sum", 1)))),
+      new AstSymbol("sum")));
+}
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_local_data_objects_which_are_modified_but_whose_address_is_not_taken,
+    THEN_they_are_SSA_values_merged_by_phis_and_no_alloca_is_emitted)) {
+  string spec = "Example: modifications in a loop and in the branches of an if";
+  TEST_GEN_IR_0ARG(
+    mkFunModifyingLocalsInLoopAndIf(pe), spec, int, ".foo", 1 + 10 + 1 + 1);
+
+  spec = "Example: modification in the rhs of a short circuit operator";
+  TEST_GEN_IR_IN_IMPLICIT_MAIN(
+    new AstSeq(
+      new AstDataDef("b",
+        new AstObjTypeQuali(
+          ObjType::eMutable, new AstObjTypeSymbol(ObjTypeFunda::eBool)),
+        new AstNumber(0, ObjTypeFunda::eBool)),
+      new AstOperator(AstOperator::eAnd,
+        new AstNumber(1, ObjTypeFunda::eBool),
+        new AstOperator(AstOperator::eAssign,
+          new AstSymbol("b"), new AstNumber(1, ObjTypeFunda::eBool))),
+      new AstIf(new AstSymbol("b"), new AstNumber(42), new AstNumber(0))),
+    42, spec);
+
+  spec = "The generated IR has phis but no allocas";
+  {
+    // setup
+    TestingIrGen UUT;
+    GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+    unique_ptr<AstObject> astRoot(mkFunModifyingLocalsInLoopAndIf(pe));
+
+    // execute
+    const auto module = genIrForInspection(UUT, *astRoot);
+
+    // verify
+    const auto functionIr = module->getFunction(".foo");
+    ASSERT_TRUE(functionIr != nullptr);
+    auto allocaCnt = 0;
+    auto phiCnt = 0;
+    for (const auto& bb : *functionIr) {
+      for (const auto& inst : bb) {
+        if (isa<AllocaInst>(inst)) { ++allocaCnt; }
+        if (isa<PHINode>(inst)) { ++phiCnt; }
+      }
+    }
+    EXPECT_EQ(0, allocaCnt) << amendSpec(spec) << amend(module);
+    // One phi for each of sum and i in the loop header, plus one for sum
+    // where the branches of the if join
+    EXPECT_EQ(3, phiCnt) << amendSpec(spec) << amend(module);
+  }
+}
+
+namespace {
+/** Sets whether llvmContext discards value names, and restores the previous
+setting on destruction, so a failing test doesn't leak it into others */
+class AutoDiscardValueNames {
+public:
+  explicit AutoDiscardValueNames(bool discard)
+    : m_oldDiscard{llvmContext.shouldDiscardValueNames()} {
+    llvmContext.setDiscardValueNames(discard);
+  }
+  ~AutoDiscardValueNames() { llvmContext.setDiscardValueNames(m_oldDiscard); }
+
+private:
+  const bool m_oldDiscard;
+};
+}
+
+TEST_F(IrGenTest, MAKE_TEST_NAME2(
+    GIVEN_the_LLVM_context_discards_value_names,
+    THEN_the_generated_IR_values_have_no_names)) {
+  // setup
+  TestingIrGen UUT;
+  GenParserExt pe(UUT.m_env, *UUT.m_errorHandler);
+  unique_ptr<AstObject> astRoot(
+    pe.mkFunDef("foo",
+      AstFunDef::createArgs(new AstDataDef("x", ObjTypeFunda::eInt)),
+      new AstObjTypeSymbol(ObjTypeFunda::eInt64),
+      new AstSeq(
+        new AstDataDef("y", ObjTypeFunda::eInt, new AstSymbol("x")),
+        new AstCast(new AstObjTypeSymbol(ObjTypeFunda::eInt64),
+          new AstSymbol("y")))));
+  AutoDiscardValueNames discardValueNames{true};
+
+  // execute
+  const auto module = genIrForInspection(UUT, *astRoot);
+
+  // verify
+  const auto functionIr = module->getFunction(".foo");
+  ASSERT_TRUE(functionIr != nullptr);
+  for (const auto& arg : functionIr->args()) {
+    EXPECT_FALSE(arg.hasName()) << amend(module);
+  }
+  for (const auto& bb : *functionIr) {
+    EXPECT_FALSE(bb.hasName()) << amend(module);
+    for (const auto& inst : bb) {
+      EXPECT_FALSE(inst.hasName()) << amend(module);
+    }
+  }
+}
@@ -1,6 +1,8 @@
 #include "test.h"
 #include "../objtype.h"
 
+#include "llvm/IR/DerivedTypes.h"
+
 #include <string>
 #include <memory>
 
@@ -127,6 +129,21 @@ TEST(ObjTypeTest, MAKE_TEST_NAME1(match)) {
     ObjTypePtr(make_shared<ObjTypeQuali>(ObjType::eMutable, make_shared<ObjTypeFunda>(ObjTypeFunda::eInt))));
 
 
+  // array <-> array
+  // ---------------
+  TEST_MATCH("full match", ObjType::eFullMatch,
+    ObjTypeArray(4, make_shared<ObjTypeFunda>(ObjTypeFunda::eInt)),
+    ObjTypeArray(4, make_shared<ObjTypeFunda>(ObjTypeFunda::eInt)));
+
+  TEST_MATCH("element count differs", ObjType::eNoMatch,
+    ObjTypeArray(4, make_shared<ObjTypeFunda>(ObjTypeFunda::eInt)),
+    ObjTypeArray(8, make_shared<ObjTypeFunda>(ObjTypeFunda::eInt)));
+
+  TEST_MATCH("element type differs", ObjType::eNoMatch,
+    ObjTypeArray(4, make_shared<ObjTypeFunda>(ObjTypeFunda::eInt)),
+    ObjTypeArray(4, make_shared<ObjTypeFunda>(ObjTypeFunda::eBool)));
+
+
   // fundamental type <-> pointer <-> function
   // -----------------------------------------
   TEST_MATCH("any fundamental type mismatches any pointer type", ObjType::eNoMatch,
@@ -183,6 +200,14 @@ TEST(ObjTypeTest, MAKE_TEST_NAME1(match)) {
   TEST_MATCH("", ObjType::eFullMatch, compound1, compound1);
   TEST_MATCH("", ObjType::eNoMatch, compound1, compound2);
 
+  const auto compound3 = make_shared<ObjTypeCompound>("foo");
+  TEST_MATCH("type matches, but dst has weaker qualifiers",
+    ObjType::eMatchButAllQualifiersAreWeaker,
+    *compound3, ObjTypeQuali(ObjType::eMutable, compound3));
+  TEST_MATCH("type matches, but dst has stronger qualifiers",
+    ObjType::eMatchButAnyQualifierIsStronger,
+    ObjTypeQuali(ObjType::eMutable, compound3), *compound3);
+
   // compound <-> other / other <-> compound
   // ---------------------------------
   TEST_MATCH("", ObjType::eNoMatch,
@@ -344,6 +369,30 @@ TEST(ObjTypeTest, MAKE_TEST_NAME1(class_)) {
     {false, ObjTypeFunda::eDouble, ObjType::eStoredAsIntegral},
     {false, ObjTypeFunda::eDouble, ObjType::eFunction},
 
+    {true, ObjTypeFunda::eInt, ObjType::eSigned},
+    {false, ObjTypeFunda::eChar, ObjType::eSigned},
+    {false, ObjTypeFunda::eBool, ObjType::eSigned},
+    {true, ObjTypeFunda::eDouble, ObjType::eSigned},
+
+    {true, ObjTypeFunda::eInt64, ObjType::eArithmetic},
+    {true, ObjTypeFunda::eInt64, ObjType::eIntegral},
+    {true, ObjTypeFunda::eInt64, ObjType::eSigned},
+    {true, ObjTypeFunda::eInt64, ObjType::eStoredAsIntegral},
+
+    {true, ObjTypeFunda::eUInt32, ObjType::eArithmetic},
+    {true, ObjTypeFunda::eUInt32, ObjType::eIntegral},
+    {false, ObjTypeFunda::eUInt32, ObjType::eSigned},
+    {true, ObjTypeFunda::eUInt32, ObjType::eStoredAsIntegral},
+
+    {true, ObjTypeFunda::eUInt64, ObjType::eIntegral},
+    {false, ObjTypeFunda::eUInt64, ObjType::eSigned},
+
+    {true, ObjTypeFunda::eFloat, ObjType::eArithmetic},
+    {false, ObjTypeFunda::eFloat, ObjType::eIntegral},
+    {true, ObjTypeFunda::eFloat, ObjType::eFloatingPoint},
+    {true, ObjTypeFunda::eFloat, ObjType::eSigned},
+    {false, ObjTypeFunda::eFloat, ObjType::eStoredAsIntegral},
+
     {false, ObjTypeFunda::ePointer, ObjType::eAbstract},
     {true, ObjTypeFunda::ePointer, ObjType::eScalar},
     {false, ObjTypeFunda::ePointer, ObjType::eArithmetic},
@@ -379,6 +428,10 @@ TEST(ObjTypeTest, MAKE_TEST_NAME1(size)) {
   EXPECT_EQ(8, ObjTypeFunda(ObjTypeFunda::eChar).size());
   EXPECT_EQ(32, ObjTypeFunda(ObjTypeFunda::eInt).size());
   EXPECT_EQ(64, ObjTypeFunda(ObjTypeFunda::eDouble).size());
+  EXPECT_EQ(64, ObjTypeFunda(ObjTypeFunda::eInt64).size());
+  EXPECT_EQ(32, ObjTypeFunda(ObjTypeFunda::eUInt32).size());
+  EXPECT_EQ(64, ObjTypeFunda(ObjTypeFunda::eUInt64).size());
+  EXPECT_EQ(32, ObjTypeFunda(ObjTypeFunda::eFloat).size());
 
   EXPECT_EQ(-1, ObjTypeFun(ObjTypeFun::createArgs()).size());
 
@@ -388,4 +441,91 @@ TEST(ObjTypeTest, MAKE_TEST_NAME1(size)) {
   EXPECT_EQ(charType->size(), ObjTypeCompound("", charType).size());
   EXPECT_EQ(charType->size() + intType->size(),
     ObjTypeCompound("", charType, intType).size());
+  EXPECT_EQ(4 * intType->size(), ObjTypeArray(4, intType).size());
+}
+
+TEST(ObjTypeTest, MAKE_TEST_NAME1(alignment)) {
+  const auto charType = make_shared<ObjTypeFunda>(ObjTypeFunda::eChar);
+  const auto intType = make_shared<ObjTypeFunda>(ObjTypeFunda::eInt);
+  const auto doubleType = make_shared<ObjTypeFunda>(ObjTypeFunda::eDouble);
+
+  string spec = "Scalars are aligned to their size";
+  EXPECT_EQ(32, intType->alignment()) << amendSpec(spec);
+  EXPECT_EQ(64, doubleType->alignment()) << amendSpec(spec);
+
+  spec = "Arrays are aligned like their elements";
+  EXPECT_EQ(32, ObjTypeArray(4, intType).alignment()) << amendSpec(spec);
+
+  spec = "Classes are aligned like their most aligned data member";
+  EXPECT_EQ(
+    64, ObjTypeCompound("", charType, doubleType, intType).alignment())
+    << amendSpec(spec);
+  EXPECT_EQ(8, ObjTypeCompound("").alignment()) << amendSpec(spec);
+}
+
+TEST(ObjTypeTest, MAKE_TEST_NAME2(
+    GIVEN_a_class_with_data_members_of_different_alignment,
+    THEN_its_fields_are_ordered_by_descending_alignment_unless_its_layout_is_fixed)) {
+  const auto boolType = make_shared<ObjTypeFunda>(ObjTypeFunda::eBool);
+  const auto intType = make_shared<ObjTypeFunda>(ObjTypeFunda::eInt);
+  const auto doubleType = make_shared<ObjTypeFunda>(ObjTypeFunda::eDouble);
+  const auto int64Type = make_shared<ObjTypeFunda>(ObjTypeFunda::eInt64);
+
+  string spec = "Example: optimized layout. Data members of equal alignment "
+    "keep their relative order";
+  {
+    ObjTypeCompound UUT("foo", {boolType, doubleType, intType, int64Type},
+      {"b", "d", "i", "i64"}, ObjTypeCompound::eOptimizedLayout);
+    EXPECT_EQ(3U, UUT.fieldIndexOf(0)) << amendSpec(spec);
+    EXPECT_EQ(0U, UUT.fieldIndexOf(1)) << amendSpec(spec);
+    EXPECT_EQ(2U, UUT.fieldIndexOf(2)) << amendSpec(spec);
+    EXPECT_EQ(1U, UUT.fieldIndexOf(3)) << amendSpec(spec);
+    const auto structType = llvm::cast<llvm::StructType>(UUT.llvmType());
+    EXPECT_EQ(doubleType->llvmType(), structType->getElementType(0))
+      << amendSpec(spec);
+    EXPECT_EQ(boolType->llvmType(), structType->getElementType(3))
+      << amendSpec(spec);
+  }
+
+  spec = "Example: fixed layout";
+  {
+    ObjTypeCompound UUT("foo", {boolType, doubleType, intType},
+      {"b", "d", "i"}, ObjTypeCompound::eFixedLayout);
+    for (auto i = 0; i < 3; ++i) {
+      EXPECT_EQ(static_cast<unsigned>(i), UUT.fieldIndexOf(i))
+        << amendSpec(spec);
+    }
+  }
+
+  spec = "Data members are found by name, independent of the layout";
+  {
+    ObjTypeCompound UUT("foo", {boolType, doubleType}, {"b", "d"},
+      ObjTypeCompound::eOptimizedLayout);
+    EXPECT_EQ(0, UUT.memberIndexOf("b")) << amendSpec(spec);
+    EXPECT_EQ(1, UUT.memberIndexOf("d")) << amendSpec(spec);
+    EXPECT_EQ(-1, UUT.memberIndexOf("x")) << amendSpec(spec);
+  }
+}
+
+TEST(ObjTypeTest, MAKE_TEST_NAME1(llvmTbaaTypeNode)) {
+  const auto charType = make_shared<ObjTypeFunda>(ObjTypeFunda::eChar);
+  const auto intType = make_shared<ObjTypeFunda>(ObjTypeFunda::eInt);
+  const auto doubleType = make_shared<ObjTypeFunda>(ObjTypeFunda::eDouble);
+
+  string spec = "Different types have different TBAA type nodes";
+  EXPECT_NE(intType->llvmTbaaTypeNode(), doubleType->llvmTbaaTypeNode())
+    << amendSpec(spec);
+  EXPECT_NE(intType->llvmTbaaTypeNode(), charType->llvmTbaaTypeNode())
+    << amendSpec(spec);
+
+  spec = "Qualifiers don't influence the TBAA type node";
+  EXPECT_EQ(intType->llvmTbaaTypeNode(),
+    ObjTypeQuali(ObjType::eMutable, intType).llvmTbaaTypeNode())
+    << amendSpec(spec);
+
+  spec = "Abstract objects are never accessed, thus have no TBAA type node";
+  EXPECT_EQ(nullptr, ObjTypeFunda(ObjTypeFunda::eVoid).llvmTbaaTypeNode())
+    << amendSpec(spec);
+  EXPECT_EQ(nullptr, ObjTypeFunda(ObjTypeFunda::eVoid).llvmTbaaAccessTag())
+    << amendSpec(spec);
 }
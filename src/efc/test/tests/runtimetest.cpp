@@ -0,0 +1,70 @@
+#include "test.h"
+#include "../runtime.h"
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+
+using namespace testing;
+using namespace std;
+
+TEST(RuntimeTest, MAKE_TEST_NAME3(
+    storage_freed_with_efrt_free,
+    efrt_alloc_WITH_the_same_size_class,
+    returns_that_storage_again)) {
+  auto spec = "Example: small object, same size";
+  {
+    // setup
+    const auto ptr = efrt_alloc(8);
+    efrt_free(ptr, 8);
+
+    // exercise
+    const auto newPtr = efrt_alloc(8);
+
+    // verify
+    EXPECT_EQ(ptr, newPtr) << amendSpec(spec);
+    efrt_free(newPtr, 8);
+  }
+
+  spec = "Example: small object, different size of the same size class";
+  {
+    // setup
+    const auto ptr = efrt_alloc(20);
+    efrt_free(ptr, 20);
+
+    // exercise
+    const auto newPtr = efrt_alloc(30);
+
+    // verify
+    EXPECT_EQ(ptr, newPtr) << amendSpec(spec);
+    efrt_free(newPtr, 30);
+  }
+}
+
+TEST(RuntimeTest, MAKE_TEST_NAME3(
+    efrt_alloc_and_efrt_arena_alloc,
+    called_multiple_times,
+    return_distinct_aligned_and_writable_storage)) {
+  using AllocFun = void* (*)(uint64_t);
+  for (const auto alloc : {AllocFun{efrt_alloc}, AllocFun{efrt_arena_alloc}}) {
+    set<void*> ptrs;
+    for (const auto size : {1U, 16U, 17U, 256U, 1000U, 100000U}) {
+      // exercise
+      const auto ptr = alloc(size);
+
+      // verify
+      ASSERT_TRUE(ptr != nullptr);
+      EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(ptr) % 16);
+      EXPECT_TRUE(ptrs.insert(ptr).second);
+      memset(ptr, 0xFF, size);
+    }
+  }
+  efrt_arena_release();
+}
+
+TEST(RuntimeTest, MAKE_TEST_NAME3(
+    efrt_free,
+    called_WITH_nullptr,
+    does_nothing)) {
+  efrt_free(nullptr, 8);
+}
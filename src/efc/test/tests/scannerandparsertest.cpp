@@ -1,5 +1,5 @@
 #include "test.h"
-#include "driverontmpfile.h"
+#include "driveronsource.h"
 #include "../ast.h"
 #include "../errorhandler.h"
 #include "../parser.h"
@@ -29,7 +29,7 @@ void testParse(const string efProgram, const string& expectedAst,
   const string& expectedMsgParam2, const string& expectedMsgParam3,
   const string& spec) {
   // setup
-  DriverOnTmpFile driver(efProgram);
+  DriverOnSource driver(efProgram);
   unique_ptr<AstNode> actualAst{};
 
   // exercise
@@ -127,6 +127,43 @@ TEST(ScannerAndParserTest, MAKE_TEST_NAME(
   spec = "more than one arguments (is valid from the parser point of view)";
   TEST_PARSE("int(42, 77)", ":;int(;42 ;77)", spec);
   TEST_PARSE("bool(42, 77)", ":;bool(;42 ;77)", spec);
+
+  spec = "Example: simd type";
+  TEST_PARSE("simd[4]double(1.0)", ":;simd[4]double(;1d)", spec);
+}
+
+TEST(ScannerAndParserTest, MAKE_TEST_NAME(
+    a_simd_type,
+    scanAndParse,
+    succeeds_AND_returns_correct_AST)) {
+  TEST_PARSE("val foo :simd[4]double$", ":;data(foo simd[4]double ())", "");
+  TEST_PARSE("val foo :simd[8]mut int$", ":;data(foo simd[8]mut-int ())",
+    "Qualifiers of the element are valid from the parser point of view");
+}
+
+TEST(ScannerAndParserTest, MAKE_TEST_NAME(
+    a_simd_type_with_a_non_integral_lane_count,
+    scanAndParse,
+    reports_eInvalidSimdLaneCount)) {
+  TEST_PARSE_REPORTS_ERROR_1MSGPARAM("val foo :simd[4.5]double$",
+    Error::eInvalidSimdLaneCount, "4.5", "");
+}
+
+TEST(ScannerAndParserTest, MAKE_TEST_NAME(
+    an_array_type,
+    scanAndParse,
+    succeeds_AND_returns_correct_AST)) {
+  TEST_PARSE("val foo :[4]int$", ":;data(foo raw[4]int ())", "");
+  TEST_PARSE("val foo :[2][4]double$",
+    ":;data(foo raw[2]raw[4]double ())", "");
+}
+
+TEST(ScannerAndParserTest, MAKE_TEST_NAME(
+    an_array_type_with_a_non_integral_element_count,
+    scanAndParse,
+    reports_eInvalidArraySize)) {
+  TEST_PARSE_REPORTS_ERROR_1MSGPARAM("val foo :[4.5]int$",
+    Error::eInvalidArraySize, "4.5", "");
 }
 
 TEST(ScannerAndParserTest, MAKE_TEST_NAME(
@@ -210,8 +247,8 @@ TEST(ScannerAndParserTest, MAKE_TEST_NAME(
   TEST_PARSE("+foo()", ":;+(call(foo))", spec);
 
   // precedence level group: binary * /
-  spec = "* is left associative";
-  TEST_PARSE("a*b*c", ":;*(*(a b) c)", spec);
+  spec = "a chain of * results in a single n-ary *";
+  TEST_PARSE("a*b*c", ":;*(a b c)", spec);
 
   spec = "* has lower precedence than !";
   TEST_PARSE("!a *  b", ":;*(!(a) b)", spec);
@@ -225,8 +262,8 @@ TEST(ScannerAndParserTest, MAKE_TEST_NAME(
   TEST_PARSE("a*b/c", ":;/(*(a b) c)", spec);
 
   // precedence level group: binary + -
-  spec = "+ is left associative";
-  TEST_PARSE("a+b+c", ":;+(+(a b) c)", spec);
+  spec = "a chain of + results in a single n-ary +";
+  TEST_PARSE("a+b+c", ":;+(a b c)", spec);
 
   spec = "+ has lower precedence than *";
   TEST_PARSE("a+b*c", ":;+(a *(b c))", spec);
@@ -247,12 +284,33 @@ TEST(ScannerAndParserTest, MAKE_TEST_NAME(
   TEST_PARSE("a==b+c", ":;==(a +(b c))", spec);
   TEST_PARSE("a+b==c", ":;==(+(a b) c)", spec);
 
+  spec = "< has same precedence as ==";
+  TEST_PARSE("a<b==c", ":;==(<(a b) c)", spec);
+  TEST_PARSE("a==b<c", ":;<(==(a b) c)", spec);
+
+  // precedence level group: bitwise
+  spec = "| has lower precedence than ^ which has lower precedence than &";
+  TEST_PARSE("a|b^c&d", ":;|(a ^(b &(c d)))", spec);
+  TEST_PARSE("a&b^c|d", ":;|(^(&(a b) c) d)", spec);
+
+  spec = "bitwise operators have higher precedence than ==";
+  TEST_PARSE("a&b==c", ":;==(&(a b) c)", spec);
+  TEST_PARSE("a==b|c", ":;==(a |(b c))", spec);
+
+  spec = "shift operators have lower precedence than + and higher than &";
+  TEST_PARSE("a<<b+c", ":;<<(a +(b c))", spec);
+  TEST_PARSE("a&b>>c", ":;&(a >>(b c))", spec);
+
+  spec = "Unary & (address-of) has higher precedence than binary &";
+  TEST_PARSE("&a&b", ":;&(&(a) b)", spec);
+
   // precedence level group: binary and &&
-  spec = "&& aka 'and' is left associative. && and 'and' are synonyms.";
-  TEST_PARSE("a &&  b &&  c", ":;and(and(a b) c)", spec);
-  TEST_PARSE("a &&  b and c", ":;and(and(a b) c)", spec);
-  TEST_PARSE("a and b &&  c", ":;and(and(a b) c)", spec);
-  TEST_PARSE("a and b and c", ":;and(and(a b) c)", spec);
+  spec = "a chain of && aka 'and' results in a single n-ary and. "
+    "&& and 'and' are synonyms.";
+  TEST_PARSE("a &&  b &&  c", ":;and(a b c)", spec);
+  TEST_PARSE("a &&  b and c", ":;and(a b c)", spec);
+  TEST_PARSE("a and b &&  c", ":;and(a b c)", spec);
+  TEST_PARSE("a and b and c", ":;and(a b c)", spec);
 
   spec = "&& aka 'and' has lower precedence than +";
   TEST_PARSE("a &&  b +   c", ":;and(a +(b c))", spec);
@@ -261,11 +319,12 @@ TEST(ScannerAndParserTest, MAKE_TEST_NAME(
   TEST_PARSE("a +   b and c", ":;and(+(a b) c)", spec);
 
   // precedence level group: binary or ||
-  spec = "|| aka 'or' is left associative. || and 'or' are synonyms.";
-  TEST_PARSE("a || b || c", ":;or(or(a b) c)", spec);
-  TEST_PARSE("a || b or c", ":;or(or(a b) c)", spec);
-  TEST_PARSE("a or b || c", ":;or(or(a b) c)", spec);
-  TEST_PARSE("a or b or c", ":;or(or(a b) c)", spec);
+  spec = "a chain of || aka 'or' results in a single n-ary or. "
+    "|| and 'or' are synonyms.";
+  TEST_PARSE("a || b || c", ":;or(a b c)", spec);
+  TEST_PARSE("a || b or c", ":;or(a b c)", spec);
+  TEST_PARSE("a or b || c", ":;or(a b c)", spec);
+  TEST_PARSE("a or b or c", ":;or(a b c)", spec);
 
   spec = "|| aka 'or' has lower precedence than && aka 'and'";
   TEST_PARSE("a ||  b &&  c", ":;or(a and(b c))", spec);
@@ -414,8 +473,18 @@ TEST(ScannerAndParserTest, MAKE_TEST_NAME(
   TEST_PARSE("op+(1,2)", ":;+(;1 ;2)", "");
   TEST_PARSE("op-(1,2)", ":;-(;1 ;2)", "");
 
-  // binary with more than two args result in a tree
-  TEST_PARSE("op+(1,2,3)", ":;+(+(;1 ;2) ;3)", ""); // left associative
+  // n-ary with more than two args result in a single node
+  TEST_PARSE("op+(1,2,3)", ":;+(;1 ;2 ;3)", "");
+
+  // simd operators
+  TEST_PARSE("op_lane(x,1)", ":;lane(;x ;1)", "");
+  TEST_PARSE("op_withlane(x,1,y)", ":;withlane(;x ;1 ;y)", "");
+  TEST_PARSE("op_hadd(x)", ":;hadd(;x)", "");
+  TEST_PARSE("op_hmul(x)", ":;hmul(;x)", "");
+  TEST_PARSE("op_ctpop(x)", ":;ctpop(;x)", "");
+  TEST_PARSE("op_ctlz(x)", ":;ctlz(;x)", "");
+  TEST_PARSE("op_cttz(x)", ":;cttz(;x)", "");
+  TEST_PARSE("op_bswap(x)", ":;bswap(;x)", "");
 }
 
 TEST(ScannerAndParserTest, MAKE_TEST_NAME(
@@ -702,3 +771,38 @@ TEST(ScannerAndParserTest, MAKE_TEST_NAME(
   TEST_PARSE("while  x do y end", ":;:while(x :;y)", "");
   TEST_PARSE("while( x :  y )"  , ":;:while(x :;y)", "");
 }
+
+TEST(ScannerAndParserTest, MAKE_TEST_NAME(
+    an_loop_control_expression_with_loop_hints,
+    scanAndParse,
+    succeeds_AND_returns_correct_AST)) {
+  TEST_PARSE("while [vectorize=4] x do y end",
+    ":;:while[vectorize=4](x :;y)", "");
+  TEST_PARSE("while( [unroll=2, interleave=2] x :  y )",
+    ":;:while[interleave=2 unroll=2](x :;y)", "");
+  TEST_PARSE("while [vectorize=8, independent] x do y end",
+    ":;:while[vectorize=8 independent](x :;y)", "");
+}
+
+TEST(ScannerAndParserTest, MAKE_TEST_NAME(
+    a_memory_management_expression,
+    scanAndParse,
+    succeeds_AND_returns_correct_AST)) {
+  TEST_PARSE("raw_new int = 42$"     , ":;raw_new(int (;42))", "");
+  TEST_PARSE("raw_new( int = 42 )"   , ":;raw_new(int (;42))", "");
+  TEST_PARSE("raw_new mut int = 42$" , ":;raw_new(mut-int (;42))", "");
+  TEST_PARSE("raw_delete x$"         , ":;raw_delete(x)", "");
+  TEST_PARSE("raw_delete( x )"       , ":;raw_delete(x)", "");
+}
+
+TEST(ScannerAndParserTest, MAKE_TEST_NAME(
+    an_loop_control_expression_with_an_invalid_loop_hint,
+    scanAndParse,
+    reports_eInvalidLoopHint)) {
+  TEST_PARSE_REPORTS_ERROR_1MSGPARAM("while [foo] x do y end",
+    Error::eInvalidLoopHint, "foo", "Example: unknown hint");
+  TEST_PARSE_REPORTS_ERROR_1MSGPARAM("while [unroll=0] x do y end",
+    Error::eInvalidLoopHint, "unroll=0", "Example: non-positive count");
+  TEST_PARSE_REPORTS_ERROR_1MSGPARAM("while [vectorize] x do y end",
+    Error::eInvalidLoopHint, "vectorize", "Example: missing count");
+}
@@ -1,10 +1,11 @@
 #include "test.h"
 #include "../errorhandler.h"
 #include "../scanner.h"
-#include "driverontmpfile.h"
+#include "driveronsource.h"
 #include "tokentesthelper.h"
 
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <vector>
 
@@ -18,7 +19,7 @@ expected token sequence for the caller's convenience. */
 void testScanner(const string& input, const string& spec,
   vector<Parser::token_type>&& expectedTokenSequence) {
   // setup
-  DriverOnTmpFile driver(input);
+  DriverOnSource driver(input);
   Scanner& UUT = driver.scanner();
   expectedTokenSequence.push_back(Parser::token::TOK_END_OF_FILE);
 
@@ -47,7 +48,7 @@ void testScannerReportsError(const string& input, Error::No expectedErrorNo,
   const string& expectedMsgParam1, const string& expectedMsgParam2,
   const string& expectedMsgParam3, const string& spec) {
   // setup
-  DriverOnTmpFile driver(input);
+  DriverOnSource driver(input);
   Scanner& UUT = driver.scanner();
   stringstream tokenSs;
 
@@ -153,11 +154,11 @@ TEST(ScannerTest, MAKE_TEST_NAME(
     pop,
     returns_TOK_ID_AND_the_ids_name_as_semantic_value_AND_succeeds)) {
   {
-    DriverOnTmpFile driver("foo");
+    DriverOnSource driver("foo");
     Scanner& UUT = driver.scanner(); 
-    Parser::symbol_type st = UUT.pop();
+    const auto st = UUT.pop();
     EXPECT_TOK_EQ(TOK_ID, st);
-    EXPECT_EQ("foo", st.value.as<string>());
+    EXPECT_EQ("foo", UUT.symbol(st).value.as<string_view>());
   }
 
   string spec = "Example: An identifier composed of parts which each for"
@@ -174,17 +175,62 @@ TEST(ScannerTest, MAKE_TEST_NAME(
   TEST_SCANNER("if foo", "", TOKIL2(TOK_IF, TOK_ID));
 }
 
+TEST(ScannerTest, MAKE_TEST_NAME(
+    multiple_ids,
+    pop_is_called_repeatedly,
+    returns_semantic_values_which_stay_valid_while_the_scanner_lives)) {
+  // setup
+  DriverOnSource driver("foo bar");
+  Scanner& UUT = driver.scanner();
+
+  // exercise
+  const auto st1 = UUT.pop();
+  const auto st2 = UUT.pop();
+  UUT.pop();
+
+  // verify
+  EXPECT_EQ("foo", UUT.symbol(st1).value.as<string_view>());
+  EXPECT_EQ("bar", UUT.symbol(st2).value.as<string_view>());
+}
+
+TEST(ScannerTest, MAKE_TEST_NAME(
+    a_file_whose_size_is_a_multiple_of_the_page_size,
+    pop_is_called_repeatedly,
+    returns_all_its_tokens)) {
+  // setup
+  // Each "foo " is 4 bytes, so the source is 4096 bytes in total. The source
+  // is given as file so it is memory mapped.
+  string input;
+  for (auto i = 0; i < 1024; ++i) {
+    input += "foo ";
+  }
+  TmpFile tmpFile(input);
+  TestingDriver driver(tmpFile.fileName());
+  Scanner& UUT = driver.scanner();
+
+  for (auto i = 0; i < 1024; ++i) {
+    // exercise
+    const auto st = UUT.pop();
+
+    // verify
+    EXPECT_TOK_EQ(TOK_ID, st);
+    EXPECT_EQ("foo", UUT.symbol(st).value.as<string_view>());
+  }
+  EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop());
+}
+
 TEST(ScannerTest, MAKE_TEST_NAME(
     a_literal_char,
     pop,
     returns_TOK_NUMBER_AND_the_char_s_value_and_it_s_type_as_semantic_value)) {
-  DriverOnTmpFile driver("'x'");
+  DriverOnSource driver("'x'");
   Scanner& UUT = driver.scanner(); 
 
-  Parser::symbol_type st = UUT.pop();
+  const auto st = UUT.pop();
   EXPECT_TOK_EQ(TOK_NUMBER, st);
-  EXPECT_EQ('x', st.value.as<NumberToken>().m_value);
-  EXPECT_EQ(ObjTypeFunda::eChar, st.value.as<NumberToken>().m_objType);
+  EXPECT_EQ('x', UUT.symbol(st).value.as<NumberToken>().m_value);
+  EXPECT_EQ(ObjTypeFunda::eChar,
+    UUT.symbol(st).value.as<NumberToken>().m_objType);
 
   EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop());
 }
@@ -195,26 +241,91 @@ TEST(ScannerTest, MAKE_TEST_NAME(
     returns_TOK_NUMBER_AND_the_number_s_value_and_it_s_type_as_semantic_value)) {
   string spec = "Example: a literal integral value";
   {
-    DriverOnTmpFile driver("42");
+    DriverOnSource driver("42");
     Scanner& UUT = driver.scanner(); 
 
-    Parser::symbol_type st = UUT.pop();
+    const auto st = UUT.pop();
     EXPECT_TOK_EQ(TOK_NUMBER, st);
-    EXPECT_EQ(42, st.value.as<NumberToken>().m_value);
-    EXPECT_EQ(ObjTypeFunda::eInt, st.value.as<NumberToken>().m_objType);
+    EXPECT_EQ(42, UUT.symbol(st).value.as<NumberToken>().m_value);
+    EXPECT_EQ(ObjTypeFunda::eInt,
+      UUT.symbol(st).value.as<NumberToken>().m_objType);
 
     EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop());
   }
 
   spec = "Example: a literal floating point value";
   {
-    DriverOnTmpFile driver("42.77");
+    DriverOnSource driver("42.77");
     Scanner& UUT = driver.scanner();
 
-    Parser::symbol_type st = UUT.pop();
+    const auto st = UUT.pop();
     EXPECT_TOK_EQ(TOK_NUMBER, st);
-    EXPECT_EQ(42.77, st.value.as<NumberToken>().m_value);
-    EXPECT_EQ(ObjTypeFunda::eDouble, st.value.as<NumberToken>().m_objType);
+    EXPECT_EQ(42.77, UUT.symbol(st).value.as<NumberToken>().m_value);
+    EXPECT_EQ(ObjTypeFunda::eDouble,
+      UUT.symbol(st).value.as<NumberToken>().m_objType);
+
+    EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop());
+  }
+}
+
+TEST(ScannerTest, MAKE_TEST_NAME(
+    a_literal_number_WITH_a_type_suffix,
+    pop,
+    returns_TOK_NUMBER_AND_the_type_denoted_by_the_suffix)) {
+  struct T {
+    string m_literal;
+    GeneralValue m_value;
+    ObjTypeFunda::EType m_type;
+  };
+  const vector<T> inputs{
+    {"9007199254740993i64", 9007199254740993LL, ObjTypeFunda::eInt64},
+    {"4294967295u", 4294967295u, ObjTypeFunda::eUInt32},
+    {"18446744073709551615u64", 18446744073709551615ULL, ObjTypeFunda::eUInt64},
+    {"1.5f", 1.5, ObjTypeFunda::eFloat},
+    {"2f", 2, ObjTypeFunda::eFloat}};
+  for (const auto& input : inputs) {
+    DriverOnSource driver(input.m_literal);
+    Scanner& UUT = driver.scanner();
+
+    const auto st = UUT.pop();
+    EXPECT_TOK_EQ(TOK_NUMBER, st) << input.m_literal;
+    EXPECT_EQ(input.m_value, UUT.symbol(st).value.as<NumberToken>().m_value)
+      << input.m_literal;
+    EXPECT_EQ(input.m_type, UUT.symbol(st).value.as<NumberToken>().m_objType)
+      << input.m_literal;
+
+    EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop());
+  }
+}
+
+TEST(ScannerTest, MAKE_TEST_NAME(
+    literal_numbers_of_different_notations,
+    pop,
+    returns_TOK_NUMBER_AND_the_number_s_value_and_it_s_type_as_semantic_value)) {
+  struct T {
+    string m_literal;
+    GeneralValue m_value;
+    ObjTypeFunda::EType m_type;
+  };
+  const vector<T> inputs{
+    {"007", 7, ObjTypeFunda::eInt},
+    {"2147483647", 2147483647, ObjTypeFunda::eInt},
+    {"0x10", 16, ObjTypeFunda::eInt},
+    {"1.", 1.0, ObjTypeFunda::eDouble},
+    {"1e3", 1000.0, ObjTypeFunda::eDouble},
+    {"1E5", 100000, ObjTypeFunda::eInt},
+    {"2.5E2", 250.0, ObjTypeFunda::eDouble},
+    {"0.1f", 0.1f, ObjTypeFunda::eFloat}};
+  for (const auto& input : inputs) {
+    DriverOnSource driver(input.m_literal);
+    Scanner& UUT = driver.scanner();
+
+    const auto st = UUT.pop();
+    EXPECT_TOK_EQ(TOK_NUMBER, st) << input.m_literal;
+    EXPECT_EQ(input.m_value, UUT.symbol(st).value.as<NumberToken>().m_value)
+      << input.m_literal;
+    EXPECT_EQ(input.m_type, UUT.symbol(st).value.as<NumberToken>().m_objType)
+      << input.m_literal;
 
     EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop());
   }
@@ -224,13 +335,14 @@ TEST(ScannerTest, MAKE_TEST_NAME(
     the_literal_false,
     pop,
     returns_TOK_NUMBER_WITH_the_semantic_value_0_as_value_and_bool_as_type)) {
-  DriverOnTmpFile driver("false");
+  DriverOnSource driver("false");
   Scanner& UUT = driver.scanner();
 
-  Parser::symbol_type st = UUT.pop();
+  const auto st = UUT.pop();
   EXPECT_TOK_EQ(TOK_NUMBER, st);
-  EXPECT_EQ(0, st.value.as<NumberToken>().m_value);
-  EXPECT_EQ(ObjTypeFunda::eBool, st.value.as<NumberToken>().m_objType);
+  EXPECT_EQ(0, UUT.symbol(st).value.as<NumberToken>().m_value);
+  EXPECT_EQ(ObjTypeFunda::eBool,
+    UUT.symbol(st).value.as<NumberToken>().m_objType);
 
   EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop());
 }
@@ -239,13 +351,14 @@ TEST(ScannerTest, MAKE_TEST_NAME(
     the_literal_true,
     pop,
     returns_TOK_NUMBER_WITH_the_semantic_value_1_as_value_and_bool_as_type)) {
-  DriverOnTmpFile driver("true");
+  DriverOnSource driver("true");
   Scanner& UUT = driver.scanner();
 
-  Parser::symbol_type st = UUT.pop();
+  const auto st = UUT.pop();
   EXPECT_TOK_EQ(TOK_NUMBER, st);
-  EXPECT_EQ(1, st.value.as<NumberToken>().m_value);
-  EXPECT_EQ(ObjTypeFunda::eBool, st.value.as<NumberToken>().m_objType);
+  EXPECT_EQ(1, UUT.symbol(st).value.as<NumberToken>().m_value);
+  EXPECT_EQ(ObjTypeFunda::eBool,
+    UUT.symbol(st).value.as<NumberToken>().m_objType);
 
   EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop());
 }
@@ -256,7 +369,7 @@ TEST(ScannerTest, MAKE_TEST_NAME(
     reports_eUnknownIntegralLiteralSuffix)) {
   // setup
   stringstream errorStream;
-  DriverOnTmpFile driver("42if", &errorStream);
+  DriverOnSource driver("42if", &errorStream);
   Scanner& UUT = driver.scanner();
 
   // exercise
@@ -285,6 +398,17 @@ TEST(ScannerTest, MAKE_TEST_NAME(
     "");
 }
 
+TEST(ScannerTest, MAKE_TEST_NAME(
+    a_literal_integral_number_which_is_not_representable_by_type_uint32,
+    pop,
+    reports_eLiteralOutOfValidRange)) {
+  TEST_SCANNER_REPORTS_ERROR_2MSGPARAMS("4294967296u",
+    Error::eLiteralOutOfValidRange,
+    "0",
+    "4294967295",
+    "");
+}
+
 TEST(ScannerTest, MAKE_TEST_NAME(
     a_literal_float_number_which_is_not_representable_by_type_double,
     pop,
@@ -302,31 +426,31 @@ TEST(ScannerTest, MAKE_TEST_NAME(
     returns_the_single_token_OP_NAME_AND_the_oparators_char_as_semantic_value)) {
   string spec = "trivial example";
   {
-    DriverOnTmpFile driver("op*");
+    DriverOnSource driver("op*");
     Scanner& UUT = driver.scanner();
-    Parser::symbol_type st = UUT.pop();
+    const auto st = UUT.pop();
     EXPECT_TOK_EQ(TOK_OP_NAME, st) << amendSpec(spec);
-    EXPECT_EQ("*", st.value.as<string>()) << amendSpec(spec);
+    EXPECT_EQ("*", UUT.symbol(st).value.as<string_view>()) << amendSpec(spec);
     EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop()) << amendSpec(spec);
   }
 
   spec = "an operator with multiple chars (punctuation)";
   {
-    DriverOnTmpFile driver("op&&");
+    DriverOnSource driver("op&&");
     Scanner& UUT = driver.scanner(); 
-    Parser::symbol_type st = UUT.pop();
+    const auto st = UUT.pop();
     EXPECT_TOK_EQ(TOK_OP_NAME, st) << amendSpec(spec);
-    EXPECT_EQ("&&", st.value.as<string>()) << amendSpec(spec);
+    EXPECT_EQ("&&", UUT.symbol(st).value.as<string_view>()) << amendSpec(spec);
     EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop()) << amendSpec(spec);
   }
 
   spec = "an operator with multiple chars (alphanumeric, thus preceded by an underscore)";
   {
-    DriverOnTmpFile driver("op_and");
+    DriverOnSource driver("op_and");
     Scanner& UUT = driver.scanner();
-    Parser::symbol_type st = UUT.pop();
+    const auto st = UUT.pop();
     EXPECT_TOK_EQ(TOK_OP_NAME, st) << amendSpec(spec);
-    EXPECT_EQ("and", st.value.as<string>()) << amendSpec(spec);
+    EXPECT_EQ("and", UUT.symbol(st).value.as<string_view>()) << amendSpec(spec);
     EXPECT_TOK_EQ(TOK_END_OF_FILE, UUT.pop()) << amendSpec(spec);
   }
 }
@@ -414,12 +538,34 @@ TEST(ScannerTest, MAKE_TEST_NAME(
   TEST_SCANNER("/* foo**bar */", spec, TOKIL0());
 }
 
+TEST(ScannerTest, MAKE_TEST_NAME(
+    a_token_not_on_the_first_line,
+    location,
+    returns_the_token_s_line_and_columns)) {
+  // setup
+  DriverOnSource driver("foo\n  bar");
+  Scanner& UUT = driver.scanner();
+  UUT.pop();
+  EXPECT_TOK_EQ(TOK_NEWLINE, UUT.pop());
+  const auto token = UUT.pop();
+
+  // exercise
+  const auto actualLocation = UUT.location(token);
+
+  // verify
+  EXPECT_EQ(Position(actualLocation.begin().m_fileName, 2, 3),
+    actualLocation.begin());
+  EXPECT_EQ(
+    Position(actualLocation.end().m_fileName, 2, 6), actualLocation.end());
+  EXPECT_EQ("bar", UUT.text(token));
+}
+
 TEST(ScannerTest, MAKE_TEST_NAME2(
     GIVEN_a_multiline_comment,
     THEN_the_following_token_has_the_correct_location_info)) {
-  DriverOnTmpFile driver("/*\n*/\n42");
+  DriverOnSource driver("/*\n*/\n42");
   Scanner& UUT = driver.scanner();
-  const auto& actualPosition = UUT.pop().location.begin;
+  const auto actualPosition = UUT.location(UUT.pop()).begin();
   EXPECT_EQ(
     Position(actualPosition.m_fileName, 3, 1),
     actualPosition);
@@ -1723,6 +1723,337 @@ TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
     spec);
 }
 
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_raw_new_WITH_an_initializer_not_matching_the_new_data_object_s_type,
+    transform,
+    reports_eNoImplicitConversion)) {
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstRawNew(new AstObjTypeSymbol(ObjTypeFunda::eInt),
+      new AstCtList(new AstNumber(1.5, ObjTypeFunda::eDouble))),
+    Error::eNoImplicitConversion, "double", "int", "");
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_raw_delete_WITH_an_operand_not_being_a_pointer,
+    transform,
+    reports_eNoSuchMemberFun)) {
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstRawDelete(new AstNumber(42)),
+    Error::eNoSuchMemberFun, "int", "raw_delete", "");
+}
+
+/** Returns: val p: raw*int = raw_new int = 42$ followed by the given uses of p,
+a raw_delete p and 0 */
+AstObject* mkRawNewUsedBy(AstRawNew*& rawNew, AstRawDelete*& rawDelete,
+  AstObject* use1, AstObject* use2 = nullptr) {
+  rawNew = new AstRawNew(new AstObjTypeSymbol(ObjTypeFunda::eInt),
+    new AstCtList(new AstNumber(42)));
+  rawDelete = new AstRawDelete(new AstSymbol("p"));
+  return new AstSeq(
+    new AstDataDef("p",
+      new AstObjTypePtr(new AstObjTypeSymbol(ObjTypeFunda::eInt)), rawNew),
+    use1, use2 ? use2 : new AstNop(), rawDelete, new AstNumber(0));
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_raw_new_initializing_a_local_data_object,
+    transform,
+    marks_the_raw_new_and_its_raw_deletes_as_stack_promoted_iff_the_new_data_object_does_not_escape)) {
+  struct Example {
+    string m_spec;
+    AstObject* m_use1;
+    AstObject* m_use2;
+    bool m_isStackPromoted;
+  };
+  const auto mkDeref = []() {
+    return new AstOperator(AstOperator::eDeref, new AstSymbol("p"));
+  };
+  const vector<Example> examples{
+    {"Example: p is only dereferenced", mkDeref(), nullptr, true},
+    {"Example: p is copied to another data object",
+      new AstDataDef("q",
+        new AstObjTypePtr(new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+        new AstSymbol("p")),
+      nullptr, false},
+    {"Example: p's address is taken", new AstOperator('&', new AstSymbol("p")),
+      nullptr, false},
+    {"Example: the address of the new data object is taken",
+      new AstOperator('&', mkDeref()), nullptr, false},
+    {"Example: p is passed to a function",
+      new AstFunDef("foo",
+        AstFunDef::createArgs(new AstDataDef("x",
+          new AstObjTypePtr(new AstObjTypeSymbol(ObjTypeFunda::eInt)))),
+        new AstObjTypeSymbol(ObjTypeFunda::eInt), new AstNumber(0)),
+      new AstFunCall(new AstSymbol("foo"), new AstCtList(new AstSymbol("p"))),
+      false}};
+
+  for (const auto& example : examples) {
+    // setup
+    ErrorHandler errorHandler;
+    Env env;
+    GenParserExt pe(env, errorHandler);
+    AstRawNew* rawNew = nullptr;
+    AstRawDelete* rawDelete = nullptr;
+    unique_ptr<AstObject> ast{pe.mkMainFunDef(
+      mkRawNewUsedBy(rawNew, rawDelete, example.m_use1, example.m_use2))};
+    Env::AutoLetLooseNodes dummy(env);
+    TestingSemanticAnalizer UUT(env, errorHandler);
+
+    // exercise
+    UUT.analyze(*ast.get());
+
+    // verify
+    EXPECT_EQ(example.m_isStackPromoted, rawNew->isStackPromoted())
+      << amendAst(ast) << amendSpec(example.m_spec);
+    EXPECT_EQ(example.m_isStackPromoted, rawDelete->isStackPromoted())
+      << amendAst(ast) << amendSpec(example.m_spec);
+  }
+}
+
+/** Returns a definition of function foo which calls itself via the given
+call, which shall be or contain a call to foo with the argument x-1 */
+AstFunDef* mkRecursiveFoo(GenParserExt& pe, AstObject* recursion,
+  AstObject* preamble = nullptr) {
+  auto body = new AstIf(
+    new AstOperator("==", new AstSymbol("x"), new AstNumber(0)),
+    new AstNumber(0),
+    recursion);
+  return pe.mkFunDef("foo",
+    AstFunDef::createArgs(new AstDataDef("x", ObjTypeFunda::eInt)),
+    new AstObjTypeSymbol(ObjTypeFunda::eInt),
+    preamble ? static_cast<AstObject*>(new AstSeq(preamble, body)) : body);
+}
+
+AstFunCall* mkRecursiveCallToFoo() {
+  return new AstFunCall(new AstSymbol("foo"),
+    new AstCtList(new AstOperator('-', new AstSymbol("x"), new AstNumber(1))));
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_function_call,
+    transform,
+    marks_it_as_tail_call_iff_it_is_in_tail_position_and_the_caller_takes_no_address_of_a_local)) {
+
+  string spec = "Example: call being an if arm of the function's body";
+  {
+    // setup
+    ErrorHandler errorHandler;
+    Env env;
+    GenParserExt pe(env, errorHandler);
+    const auto call = mkRecursiveCallToFoo();
+    unique_ptr<AstObject> ast{mkRecursiveFoo(pe, call)};
+    Env::AutoLetLooseNodes dummy(env);
+    TestingSemanticAnalizer UUT(env, errorHandler);
+
+    // exercise
+    UUT.analyze(*ast.get());
+
+    // verify
+    EXPECT_TRUE(call->isTailCall()) << amendAst(ast) << amendSpec(spec);
+  }
+
+  spec = "Example: call being the argument of a return";
+  {
+    // setup
+    ErrorHandler errorHandler;
+    Env env;
+    GenParserExt pe(env, errorHandler);
+    const auto call = mkRecursiveCallToFoo();
+    unique_ptr<AstObject> ast{mkRecursiveFoo(pe, new AstReturn(call))};
+    Env::AutoLetLooseNodes dummy(env);
+    TestingSemanticAnalizer UUT(env, errorHandler);
+
+    // exercise
+    UUT.analyze(*ast.get());
+
+    // verify
+    EXPECT_TRUE(call->isTailCall()) << amendAst(ast) << amendSpec(spec);
+  }
+
+  spec = "Example: call being an operand of an operator";
+  {
+    // setup
+    ErrorHandler errorHandler;
+    Env env;
+    GenParserExt pe(env, errorHandler);
+    const auto call = mkRecursiveCallToFoo();
+    unique_ptr<AstObject> ast{
+      mkRecursiveFoo(pe, new AstOperator('+', call, new AstNumber(1)))};
+    Env::AutoLetLooseNodes dummy(env);
+    TestingSemanticAnalizer UUT(env, errorHandler);
+
+    // exercise
+    UUT.analyze(*ast.get());
+
+    // verify
+    EXPECT_FALSE(call->isTailCall()) << amendAst(ast) << amendSpec(spec);
+  }
+
+  spec = "Example: call in tail position, but the caller takes the address of "
+         "a local";
+  {
+    // setup
+    ErrorHandler errorHandler;
+    Env env;
+    GenParserExt pe(env, errorHandler);
+    const auto call = mkRecursiveCallToFoo();
+    unique_ptr<AstObject> ast{mkRecursiveFoo(pe, call,
+      new AstSeq(
+        new AstDataDef("y", ObjTypeFunda::eInt,
+          new AstNumber(42, ObjTypeFunda::eInt)),
+        new AstOperator('&', new AstSymbol("y"))))};
+    Env::AutoLetLooseNodes dummy(env);
+    TestingSemanticAnalizer UUT(env, errorHandler);
+
+    // exercise
+    UUT.analyze(*ast.get());
+
+    // verify
+    EXPECT_FALSE(call->isTailCall()) << amendAst(ast) << amendSpec(spec);
+  }
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_recursive_call_which_is_not_a_tail_call,
+    transform,
+    reports_the_warning_eNonTailRecursiveCall_iff_reporting_it_is_enabled)) {
+
+  for (const auto isEnabled : {false, true}) {
+    // setup
+    ErrorHandler errorHandler;
+    if (isEnabled) {
+      errorHandler.enableReportingOf(Error::eNonTailRecursiveCall);
+    }
+    Env env;
+    GenParserExt pe(env, errorHandler);
+    unique_ptr<AstObject> ast{mkRecursiveFoo(
+      pe, new AstOperator('+', mkRecursiveCallToFoo(), new AstNumber(1)))};
+    Env::AutoLetLooseNodes dummy(env);
+    TestingSemanticAnalizer UUT(env, errorHandler);
+
+    // exercise
+    UUT.analyze(*ast.get());
+
+    // verify
+    EXPECT_FALSE(errorHandler.hasErrors()) << amendAst(ast);
+    if (isEnabled) {
+      ASSERT_EQ(1U, errorHandler.warnings().size()) << amendAst(ast);
+      EXPECT_EQ(
+        Error::eNonTailRecursiveCall, errorHandler.warnings().front()->no())
+        << amendAst(ast);
+      EXPECT_EQ("foo", errorHandler.warnings().front()->msgParam1())
+        << amendAst(ast);
+    }
+    else {
+      EXPECT_TRUE(errorHandler.warnings().empty()) << amendAst(ast);
+    }
+  }
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_function_call_to_a_builtin_function,
+    transform,
+    sets_the_objectType_of_the_AstFunCall_node_to_the_type_of_the_arguments)) {
+
+  string spec = "Example: sqrt of a double";
+  {
+    // setup
+    ErrorHandler errorHandler;
+    Env env;
+    AstFunCall* funCall = new AstFunCall(new AstSymbol("sqrt"),
+      new AstCtList(new AstNumber(2.0, ObjTypeFunda::eDouble)));
+    unique_ptr<AstObject> ast{funCall};
+    Env::AutoLetLooseNodes dummy(env);
+    TestingSemanticAnalizer UUT(env, errorHandler);
+
+    // exercise
+    UUT.analyze(*ast.get());
+
+    // verify
+    EXPECT_EQ(AstFunCall::eSqrt, funCall->builtin()) <<
+      amendAst(ast) << amendSpec(spec);
+    EXPECT_MATCHES_FULLY(ObjTypeFunda(ObjTypeFunda::eDouble), funCall->objType()) <<
+      amendAst(ast) << amendSpec(spec);
+  }
+
+  spec = "A user defined object shadows the builtin function of the same name";
+  {
+    // setup
+    ErrorHandler errorHandler;
+    Env env;
+    GenParserExt pe(env, errorHandler);
+    AstFunCall* funCall = new AstFunCall(new AstSymbol("abs"),
+      new AstCtList(new AstNumber(0)));
+    unique_ptr<AstObject> ast{
+      new AstSeq(
+        pe.mkFunDef("abs",
+          AstFunDef::createArgs(
+            new AstDataDef("x", ObjTypeFunda::eInt)),
+          new AstObjTypeSymbol(ObjTypeFunda::eBool),
+          new AstNumber(0, ObjTypeFunda::eBool)),
+        funCall)};
+    Env::AutoLetLooseNodes dummy(env);
+    TestingSemanticAnalizer UUT(env, errorHandler);
+
+    // exercise
+    UUT.analyze(*ast.get());
+
+    // verify
+    EXPECT_EQ(AstFunCall::eNoBuiltin, funCall->builtin()) <<
+      amendAst(ast) << amendSpec(spec);
+    EXPECT_MATCHES_FULLY(ObjTypeFunda(ObjTypeFunda::eBool), funCall->objType()) <<
+      amendAst(ast) << amendSpec(spec);
+  }
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_function_call_to_a_builtin_function_WITH_invalid_arguments,
+    transform,
+    reports_an_error)) {
+
+  string spec = "fma expects three args, but two where passed";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstFunCall(new AstSymbol("fma"),
+      new AstCtList(
+        new AstNumber(1.0, ObjTypeFunda::eDouble),
+        new AstNumber(2.0, ObjTypeFunda::eDouble))),
+    Error::eInvalidArguments, "2", "3", spec);
+
+  spec = "sqrt is only defined for floating point types";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstFunCall(new AstSymbol("sqrt"), new AstCtList(new AstNumber(4))),
+    Error::eNoSuchBuiltinFunOverload, "sqrt", "int", spec);
+
+  spec = "min is only defined for arithmetic types";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstFunCall(new AstSymbol("min"),
+      new AstCtList(
+        new AstNumber(0, ObjTypeFunda::eBool),
+        new AstNumber(1, ObjTypeFunda::eBool))),
+    Error::eNoSuchBuiltinFunOverload, "min", "bool", spec);
+
+  spec = "All arguments must have the type of the first argument";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstFunCall(new AstSymbol("max"),
+      new AstCtList(
+        new AstNumber(1.0, ObjTypeFunda::eDouble),
+        new AstNumber(2))),
+    Error::eNoImplicitConversion, "int", "double", spec);
+
+  spec = "Branch hints are only defined for bool";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstFunCall(new AstSymbol("likely"), new AstCtList(new AstNumber(1))),
+    Error::eNoSuchBuiltinFunOverload, "likely", "int", spec);
+
+  spec = "The expected trip count must be an integral literal";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR(
+    new AstFunCall(new AstSymbol("expect_trips"),
+      new AstCtList(
+        new AstNumber(1, ObjTypeFunda::eBool),
+        new AstNumber(1.5, ObjTypeFunda::eDouble))),
+    Error::eInvalidTripCount, spec);
+}
+
 TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
     a_function_call_to_an_defined_function_WITH_correct_number_of_arguments_and_types,
     transform,
@@ -1778,6 +2109,42 @@ TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
     // verify
     EXPECT_FALSE(errorHandler.hasErrors()) << amendSpec(spec) << amendAst(ast);
   }
+
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    parameters_without_initializer,
+    transform,
+    inserts_no_default_initializer_AND_thus_succeeds_also_for_a_pointer_parameter)) {
+  // setup
+  ErrorHandler errorHandler;
+  Env env;
+  GenParserExt pe(env, errorHandler);
+  // A pointer has no implicit default initializer; a nullptr doesn't
+  // implicitly convert to a pointer type
+  const auto p =
+    new AstDataDef("p", new AstObjTypePtr(new AstObjTypeSymbol(ObjTypeFunda::eInt)));
+  const auto i = new AstDataDef("i", ObjTypeFunda::eInt);
+  unique_ptr<AstObject> ast{
+    new AstSeq(
+      pe.mkFunDef("foo",
+        AstFunDef::createArgs(p, i),
+        new AstObjTypeSymbol(ObjTypeFunda::eInt),
+        new AstNumber(42)),
+      new AstDataDef("x", ObjTypeFunda::eInt),
+      new AstFunCall(new AstSymbol("foo"),
+        new AstCtList(
+          new AstOperator('&', new AstSymbol("x")), new AstSymbol("x"))))};
+  Env::AutoLetLooseNodes dummy(env);
+  TestingSemanticAnalizer UUT(env, errorHandler);
+
+  // exercise
+  UUT.analyze(*ast.get());
+
+  // verify
+  EXPECT_FALSE(errorHandler.hasErrors()) << amendAst(ast);
+  EXPECT_TRUE(p->ctorArgs().childs().empty()) << amendAst(ast);
+  EXPECT_TRUE(i->ctorArgs().childs().empty()) << amendAst(ast);
 }
 
 TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
@@ -1828,6 +2195,19 @@ TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
       new AstNumber(0, ObjTypeFunda::eInt)),
     Error::eNoSuchMemberFun, "int", "operator_and", spec);
 
+  spec = "Example: Bitwise operator (|) with argument not being integral (here double)";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstOperator('|',
+      new AstNumber(0, ObjTypeFunda::eDouble),
+      new AstNumber(0, ObjTypeFunda::eDouble)),
+    Error::eNoSuchMemberFun, "double", "operator|", spec);
+
+  spec = "Example: Bit counting operator with argument not being integral (here bool)";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstOperator(AstOperator::eCtpop,
+      new AstNumber(0, ObjTypeFunda::eBool)),
+    Error::eNoSuchMemberFun, "bool", "operator_ctpop", spec);
+
   spec = "Example: Comparision operator (==) with argument not being of scalar class (here function)";
   TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
     new AstSeq(
@@ -1886,6 +2266,12 @@ TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME2(
     {ObjTypeFunda::eDouble, ObjTypeFunda::eInt, true},
     {ObjTypeFunda::eDouble, ObjTypeFunda::eNullptr, false},
 
+    {ObjTypeFunda::eInt64, ObjTypeFunda::eInt, true},
+    {ObjTypeFunda::eUInt32, ObjTypeFunda::eInt64, true},
+    {ObjTypeFunda::eUInt64, ObjTypeFunda::eFloat, true},
+    {ObjTypeFunda::eFloat, ObjTypeFunda::eDouble, true},
+    {ObjTypeFunda::eFloat, ObjTypeFunda::eNullptr, false},
+
     {ObjTypeFunda::eNullptr, ObjTypeFunda::eVoid, false},
     {ObjTypeFunda::eNullptr, ObjTypeFunda::eNoreturn, false},
     {ObjTypeFunda::eNullptr, ObjTypeFunda::eBool, false},
@@ -1907,6 +2293,10 @@ TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME2(
     case ObjTypeFunda::eChar:  // fall through
     case ObjTypeFunda::eInt:  // fall through
     case ObjTypeFunda::eDouble:  // fall through
+    case ObjTypeFunda::eInt64:  // fall through
+    case ObjTypeFunda::eUInt32:  // fall through
+    case ObjTypeFunda::eUInt64:  // fall through
+    case ObjTypeFunda::eFloat:  // fall through
     case ObjTypeFunda::eNullptr:
       castChild = new AstNumber(0, inputSpec.oldType);
       break; 
@@ -2027,3 +2417,190 @@ TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME3(
       new AstNumber(42)),
     Error::eTypeInferenceIsNotYetSupported, spec);
 }
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_simd_type_WITH_a_non_positive_lane_count,
+    transform,
+    reports_eInvalidSimdLaneCount)) {
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_1MSGPARAM(
+    new AstDataDef("x",
+      new AstObjTypeSimd(0, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+      StorageDuration::eLocal),
+    Error::eInvalidSimdLaneCount, "0", "");
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_simd_type_WITH_an_invalid_element_type,
+    transform,
+    reports_eInvalidSimdElementType)) {
+  string spec = "example: qualified element type";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_1MSGPARAM(
+    new AstDataDef("x",
+      new AstObjTypeSimd(4,
+        new AstObjTypeQuali(ObjType::eMutable,
+          new AstObjTypeSymbol(ObjTypeFunda::eInt))),
+      StorageDuration::eLocal),
+    Error::eInvalidSimdElementType, "mut-int", spec);
+
+  spec = "example: pointer element type";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_1MSGPARAM(
+    new AstDataDef("x",
+      new AstObjTypeSimd(4,
+        new AstObjTypePtr(new AstObjTypeSymbol(ObjTypeFunda::eInt))),
+      StorageDuration::eLocal),
+    Error::eInvalidSimdElementType, "<dont_verify>", spec);
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_lane_operator_WITH_a_non_int_lane_index,
+    transform,
+    reports_eNoImplicitConversion)) {
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstSeq(
+      new AstDataDef("v",
+        new AstObjTypeSimd(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+        StorageDuration::eLocal),
+      new AstOperator(AstOperator::eLane,
+        new AstSymbol("v"),
+        new AstNumber(0, ObjTypeFunda::eBool))),
+    Error::eNoImplicitConversion, "bool", "int", "");
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    an_array_type_WITH_a_non_positive_element_count,
+    transform,
+    reports_eInvalidArraySize)) {
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_1MSGPARAM(
+    new AstDataDef("x",
+      new AstObjTypeArray(0, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+      StorageDuration::eLocal),
+    Error::eInvalidArraySize, "0", "");
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    an_array_type_WITH_an_invalid_element_type,
+    transform,
+    reports_eInvalidArrayElementType)) {
+  string spec = "example: qualified element type";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_1MSGPARAM(
+    new AstDataDef("x",
+      new AstObjTypeArray(4,
+        new AstObjTypeQuali(ObjType::eMutable,
+          new AstObjTypeSymbol(ObjTypeFunda::eInt))),
+      StorageDuration::eLocal),
+    Error::eInvalidArrayElementType, "mut-int", spec);
+
+  spec = "example: pointer element type";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_1MSGPARAM(
+    new AstDataDef("x",
+      new AstObjTypeArray(4,
+        new AstObjTypePtr(new AstObjTypeSymbol(ObjTypeFunda::eInt))),
+      StorageDuration::eLocal),
+    Error::eInvalidArrayElementType, "<dont_verify>", spec);
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    an_index_operator_WITH_a_non_int_index,
+    transform,
+    reports_eNoImplicitConversion)) {
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstSeq(
+      new AstDataDef("a",
+        new AstObjTypeArray(4, new AstObjTypeSymbol(ObjTypeFunda::eInt)),
+        StorageDuration::eLocal),
+      new AstOperator(AstOperator::eIndex,
+        new AstSymbol("a"),
+        new AstNumber(0, ObjTypeFunda::eBool))),
+    Error::eNoImplicitConversion, "bool", "int", "");
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_member_access_WITH_a_name_which_is_no_data_member,
+    transform,
+    reports_eNoSuchMember)) {
+  string spec = "Example: class object";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstSeq(
+      new AstClassDef("foo",
+        new AstDataDef("x", new AstObjTypeSymbol(ObjTypeFunda::eInt),
+          StorageDuration::eMember)),
+      new AstDataDef("o", new AstObjTypeSymbol("foo"),
+        StorageDuration::eLocal),
+      new AstMemberAccess(new AstSymbol("o"), "y")),
+    Error::eNoSuchMember, "class(foo int)", "y", spec);
+
+  spec = "Example: object of fundamental type";
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_2MSGPARAM(
+    new AstSeq(
+      new AstDataDef("o", new AstObjTypeSymbol(ObjTypeFunda::eInt),
+        StorageDuration::eLocal),
+      new AstMemberAccess(new AstSymbol("o"), "x")),
+    Error::eNoSuchMember, "int", "x", spec);
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    an_assignment_to_a_data_member_of_an_immutable_class_object,
+    transform,
+    reports_an_eWriteToImmutable)) {
+  TEST_ASTTRAVERSAL_REPORTS_ERROR(
+    new AstSeq(
+      new AstClassDef("foo",
+        new AstDataDef("x", new AstObjTypeSymbol(ObjTypeFunda::eInt),
+          StorageDuration::eMember)),
+      new AstDataDef("o", new AstObjTypeSymbol("foo"),
+        StorageDuration::eLocal),
+      new AstOperator('=',
+        new AstMemberAccess(new AstSymbol("o"), "x"),
+        new AstNumber(42))),
+    Error::eWriteToImmutable, "");
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    an_object_type_symbol_WITH_a_name_which_is_neither_fundamental_nor_a_class,
+    transform,
+    reports_eUnknownName)) {
+  TEST_ASTTRAVERSAL_REPORTS_ERROR_1MSGPARAM(
+    new AstDataDef("o", new AstObjTypeSymbol("foo"), StorageDuration::eLocal),
+    Error::eUnknownName, "foo", "");
+}
+
+TEST_F(SemanticAnalizerTest, MAKE_TEST_NAME(
+    a_member_access,
+    transform,
+    denotes_the_data_member_being_mutable_if_and_only_if_the_class_object_is)) {
+  for (const auto isMutable : {false, true}) {
+    // setup
+    ErrorHandler errorHandler;
+    Env env;
+    AstObjType* objAstObjType = new AstObjTypeSymbol("foo");
+    if (isMutable) {
+      objAstObjType = new AstObjTypeQuali(ObjType::eMutable, objAstObjType);
+    }
+    const auto memberAccess = new AstMemberAccess(new AstSymbol("o"), "y");
+    auto ast = make_unique<AstSeq>(
+      new AstClassDef("foo",
+        new AstDataDef("x", new AstObjTypeSymbol(ObjTypeFunda::eBool),
+          StorageDuration::eMember),
+        new AstDataDef("y", new AstObjTypeSymbol(ObjTypeFunda::eDouble),
+          StorageDuration::eMember)),
+      new AstDataDef("o", objAstObjType, StorageDuration::eLocal),
+      memberAccess);
+    Env::AutoLetLooseNodes dummy(env);
+    TestingSemanticAnalizer UUT(env, errorHandler);
+
+    // exercise
+    UUT.analyze(*ast);
+
+    // verify
+    const auto doubleObjType = make_shared<ObjTypeFunda>(ObjTypeFunda::eDouble);
+    if (isMutable) {
+      EXPECT_MATCHES_FULLY(ObjTypeQuali(ObjType::eMutable, doubleObjType),
+        memberAccess->objType())
+        << amendAst(ast.get());
+    }
+    else {
+      EXPECT_MATCHES_FULLY(*doubleObjType, memberAccess->objType())
+        << amendAst(ast.get());
+    }
+  }
+}
@@ -0,0 +1,37 @@
+#include "test.h"
+#include "../location.h"
+#include "../sourcefile.h"
+
+using namespace testing;
+using namespace std;
+
+TEST(SourceFileTest, MAKE_TEST_NAME(
+    a_multiline_source,
+    position,
+    returns_the_line_and_column_of_the_given_offset)) {
+  // setup
+  SourceFile UUT{"foo.ef"};
+  UUT.setSource("ab\n\ncd\n");
+
+  // exercise & verify
+  EXPECT_EQ(Position(&UUT.name(), 1, 1), UUT.position(0));
+  EXPECT_EQ(Position(&UUT.name(), 1, 3), UUT.position(2));
+  EXPECT_EQ(Position(&UUT.name(), 2, 1), UUT.position(3));
+  EXPECT_EQ(Position(&UUT.name(), 3, 2), UUT.position(5));
+  EXPECT_EQ(Position(&UUT.name(), 4, 1), UUT.position(7));
+}
+
+TEST(SourceFileTest, MAKE_TEST_NAME(
+    a_location_referring_to_a_source_file,
+    begin_and_end,
+    return_the_positions_decoded_via_the_source_file)) {
+  // setup
+  SourceFile sourceFile{"foo.ef"};
+  sourceFile.setSource("ab\ncde");
+  const Location UUT{&sourceFile, 4, 6};
+
+  // exercise & verify
+  EXPECT_EQ(Position(&sourceFile.name(), 2, 2), UUT.begin());
+  EXPECT_EQ(Position(&sourceFile.name(), 2, 4), UUT.end());
+  EXPECT_EQ("foo.ef:2.2-3", toString(UUT));
+}
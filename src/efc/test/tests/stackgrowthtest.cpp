@@ -0,0 +1,35 @@
+#include "test.h"
+#include "../stackgrowth.h"
+
+#include <cstddef>
+#include <stdexcept>
+
+using namespace testing;
+using namespace std;
+
+namespace {
+/** Recurses depth times, each recursion step through callWithSufficientStack.
+Throws at the deepest level if requested, else returns depth. */
+size_t recurse(size_t depth, bool throwAtDeepestLevel) {
+  if (depth == 0) {
+    if (throwAtDeepestLevel) { throw runtime_error("deepest level"); }
+    return 0;
+  }
+  return 1 + callWithSufficientStack(
+               [&] { return recurse(depth - 1, throwAtDeepestLevel); });
+}
+}
+
+TEST(StackGrowthTest, MAKE_TEST_NAME(
+    a_recursion_1M_levels_deep_where_each_step_goes_through_callWithSufficientStack,
+    callWithSufficientStack,
+    returns_the_result_without_overflowing_the_stack)) {
+  EXPECT_EQ(1000000U, recurse(1000000, false));
+}
+
+TEST(StackGrowthTest, MAKE_TEST_NAME(
+    a_recursion_1M_levels_deep_throwing_at_the_deepest_level,
+    callWithSufficientStack,
+    propagates_the_exception_to_the_caller)) {
+  EXPECT_THROW(recurse(1000000, true), runtime_error);
+}
@@ -0,0 +1,121 @@
+#include "test.h"
+#include "../errorhandler.h"
+#include "../threadedtokenstream.h"
+#include "literaltokenstream.h"
+#include "tokentesthelper.h"
+
+using namespace testing;
+using namespace std;
+using namespace yy;
+
+namespace {
+/** Returns the given number of TOK_ID tokens and then reports an error */
+class FailingTokenStream : public TokenStream {
+public:
+  FailingTokenStream(size_t tokenCnt, ErrorHandler& errorHandler)
+    : m_tokenCnt{tokenCnt}, m_errorHandler{errorHandler} {}
+  Token pop() override {
+    if (m_tokenCnt == 0) {
+      Error::throwError(m_errorHandler, Error::eUnexpectedCharacter);
+    }
+    --m_tokenCnt;
+    return Token{Parser::token::TOK_ID};
+  }
+  Parser::symbol_type symbol(const Token& token) override {
+    return Parser::makeToken(token.token());
+  }
+
+private:
+  size_t m_tokenCnt;
+  ErrorHandler& m_errorHandler;
+};
+
+/** Returns TOK_ID tokens and counts how often it was popped */
+class CountingTokenStream : public TokenStream {
+public:
+  Token pop() override {
+    ++m_popCnt;
+    return Token{Parser::token::TOK_ID};
+  }
+  Parser::symbol_type symbol(const Token& token) override {
+    return Parser::makeToken(token.token());
+  }
+
+  atomic<size_t> m_popCnt{0};
+};
+}
+
+TEST(ThreadedTokenStreamTest, MAKE_TEST_NAME2(
+    pop,
+    returns_the_tokens_of_the_input_in_the_same_order)) {
+  // setup
+  // More tokens than the ring buffer can hold at once
+  vector<Parser::token_type> tokens;
+  for (auto i = 0; i < 5000; ++i) {
+    tokens.push_back(i % 2 ? Parser::token::TOK_ID : Parser::token::TOK_IF);
+  }
+  tokens.push_back(Parser::token::TOK_END_OF_FILE);
+  LiteralTokenStream input(tokens);
+  ErrorHandler inputErrorHandler;
+  ErrorHandler errorHandler;
+  ThreadedTokenStream UUT(input, inputErrorHandler, errorHandler);
+
+  for (const auto& expectedToken : tokens) {
+    // exercise & verify
+    EXPECT_EQ(expectedToken, UUT.pop().token());
+  }
+}
+
+TEST(ThreadedTokenStreamTest, MAKE_TEST_NAME(
+    an_input_reporting_an_error,
+    pop,
+    returns_the_tokens_before_the_error_AND_then_reports_the_error)) {
+  // setup
+  ErrorHandler inputErrorHandler;
+  FailingTokenStream input(3, inputErrorHandler);
+  ErrorHandler errorHandler;
+  ThreadedTokenStream UUT(input, inputErrorHandler, errorHandler);
+
+  // exercise & verify
+  for (auto i = 0; i < 3; ++i) {
+    EXPECT_TOK_EQ(TOK_ID, UUT.pop());
+  }
+  EXPECT_THROW(UUT.pop(), BuildError);
+  ASSERT_EQ(1U, errorHandler.errors().size());
+  EXPECT_EQ(Error::eUnexpectedCharacter, errorHandler.errors().front()->no());
+}
+
+TEST(ThreadedTokenStreamTest, MAKE_TEST_NAME(
+    an_input_with_more_tokens_than_are_popped,
+    destructor,
+    stops_the_producing_thread)) {
+  // setup
+  ErrorHandler inputErrorHandler;
+  FailingTokenStream input(100000, inputErrorHandler);
+  ErrorHandler errorHandler;
+
+  // exercise
+  {
+    ThreadedTokenStream UUT(input, inputErrorHandler, errorHandler);
+    UUT.pop();
+  }
+
+  // verify
+  EXPECT_TRUE(errorHandler.errors().empty());
+}
+
+TEST(ThreadedTokenStreamTest, MAKE_TEST_NAME(
+    a_ThreadedTokenStream_which_is_never_popped,
+    destructor,
+    returns_without_having_popped_the_input)) {
+  // setup
+  CountingTokenStream input;
+  ErrorHandler inputErrorHandler;
+  ErrorHandler errorHandler;
+
+  // exercise
+  { ThreadedTokenStream UUT(input, inputErrorHandler, errorHandler); }
+
+  // verify
+  EXPECT_EQ(0U, input.m_popCnt.load());
+}
@@ -0,0 +1,73 @@
+#include "threadedtokenstream.h"
+
+#include "errorhandler.h"
+
+using namespace std;
+
+ThreadedTokenStream::ThreadedTokenStream(TokenStream& input,
+  ErrorHandler& inputErrorHandler, ErrorHandler& errorHandler)
+  : m_input{input}
+  , m_inputErrorHandler{inputErrorHandler}
+  , m_errorHandler{errorHandler}
+  , m_head{0}
+  , m_tail{0}
+  , m_isCancelled{false}
+  , m_isEndOfStream{false} {
+}
+
+ThreadedTokenStream::~ThreadedTokenStream() {
+  if (!m_producer.joinable()) { return; }
+  m_isCancelled.store(true, memory_order_relaxed);
+  m_producer.join();
+}
+
+Token ThreadedTokenStream::pop() {
+  if (m_isEndOfStream) { return Token{}; }
+  if (!m_producer.joinable()) {
+    m_producer = thread{&ThreadedTokenStream::produce, this};
+  }
+
+  const auto head = m_head.load(memory_order_relaxed);
+  while (m_tail.load(memory_order_acquire) == head) { this_thread::yield(); }
+  const auto token = m_buf[head % sm_bufSize];
+  m_head.store(head + 1, memory_order_release);
+
+  if (token.token() == Parser::token::TOK_END_OF_FILE) {
+    m_isEndOfStream = true;
+    if (m_exception) {
+      // The producer has terminated, so m_inputErrorHandler is no longer
+      // written to
+      for (const auto& error : m_inputErrorHandler.errors()) {
+        m_errorHandler.add(error);
+      }
+      rethrow_exception(m_exception);
+    }
+  }
+  return token;
+}
+
+Parser::symbol_type ThreadedTokenStream::symbol(const Token& token) {
+  return m_input.symbol(token);
+}
+
+void ThreadedTokenStream::produce() {
+  for (size_t tail = 0; !m_isCancelled.load(memory_order_relaxed); ++tail) {
+    Token token;
+    try {
+      token = m_input.pop();
+    }
+    catch (...) {
+      m_exception = current_exception();
+      token = Token{};
+    }
+
+    while (tail - m_head.load(memory_order_acquire) == sm_bufSize) {
+      if (m_isCancelled.load(memory_order_relaxed)) { return; }
+      this_thread::yield();
+    }
+    m_buf[tail % sm_bufSize] = token;
+    m_tail.store(tail + 1, memory_order_release);
+
+    if (token.token() == Parser::token::TOK_END_OF_FILE) { return; }
+  }
+}
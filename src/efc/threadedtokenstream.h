@@ -0,0 +1,65 @@
+#pragma once
+#include "tokenstream.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+
+class ErrorHandler;
+
+/** Pops the tokens of the given input token stream on a thread of its own, so
+that producing the tokens, e.g. scanning, overlaps with consuming them, e.g.
+parsing. The tokens are passed through a lock-free single-producer /
+single-consumer ring buffer.
+
+The input must report errors via the input error handler, which must not be
+used by anyone else. An error the input reports is forwarded to the error
+handler and rethrown when the consumer pops the token at which the error
+occurred. Thus errors are reported in the same order as if the input were
+popped directly.
+
+The producing thread is only started by the first pop, so no input is popped,
+e.g. no file read, unless there is demand for it.
+
+The input's symbol method must be safe to be called concurrently with its pop
+method. The input must stay alive as long as the ThreadedTokenStream. */
+class ThreadedTokenStream : public TokenStream {
+public:
+  ThreadedTokenStream(TokenStream& input, ErrorHandler& inputErrorHandler,
+    ErrorHandler& errorHandler);
+  /** Stops the producing thread without waiting for it to pop the input's
+  remaining tokens */
+  ~ThreadedTokenStream() override;
+
+  Token pop() override;
+  Parser::symbol_type symbol(const Token& token) override;
+
+private:
+  /** Body of m_producer */
+  void produce();
+
+  /** Must be a power of two */
+  static constexpr std::size_t sm_bufSize = 1024;
+
+  TokenStream& m_input;
+  ErrorHandler& m_inputErrorHandler;
+  ErrorHandler& m_errorHandler;
+  /** Ring buffer. The tokens in the range [m_head, m_tail), each modulo
+  sm_bufSize, are the ones produced but not yet consumed. */
+  std::array<Token, sm_bufSize> m_buf;
+  /** Written only by the consumer. On a cache line of its own, so producer
+  and consumer don't contend for it when the other index changes. */
+  alignas(64) std::atomic<std::size_t> m_head;
+  /** Written only by the producer */
+  alignas(64) std::atomic<std::size_t> m_tail;
+  std::atomic<bool> m_isCancelled;
+  /** Set by the producer before it publishes its last token, an END_OF_FILE
+  token, if popping the input threw */
+  std::exception_ptr m_exception;
+  /** Only used by the consumer */
+  bool m_isEndOfStream;
+  /** Not joinable until the first pop */
+  std::thread m_producer;
+};
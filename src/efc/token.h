@@ -0,0 +1,36 @@
+#pragma once
+#include "parser.h"
+
+#include <cstdint>
+
+/** Compact representation of a token as passed through the token pipeline,
+i.e. from the Scanner through TokenStreamLookAhead and TokenFilter to the
+generated parser.
+
+In contrast to Parser::symbol_type, it neither stores the semantic value nor
+the location. The lexeme is denoted by its byte offset and length within the
+source, the semantic value, if any, by a payload id whose meaning depends on
+the token kind and on the TokenStream which produced the token. That
+TokenStream translates the token into a Parser::symbol_type only when the
+generated parser asks for it, see TokenStream::symbol. */
+class Token {
+public:
+  Token(Parser::token_type token = Parser::token::TOK_END_OF_FILE,
+    std::uint32_t offset = 0, std::uint32_t length = 0,
+    std::uint32_t payloadId = 0)
+    : m_token{token}
+    , m_offset{offset}
+    , m_length{length}
+    , m_payloadId{payloadId} {}
+
+  Parser::token_type token() const { return m_token; }
+  std::uint32_t offset() const { return m_offset; }
+  std::uint32_t length() const { return m_length; }
+  std::uint32_t payloadId() const { return m_payloadId; }
+
+private:
+  Parser::token_type m_token;
+  std::uint32_t m_offset;
+  std::uint32_t m_length;
+  std::uint32_t m_payloadId;
+};
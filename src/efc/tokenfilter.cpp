@@ -8,38 +8,30 @@ TokenFilter::TokenFilter(TokenStream& input)
   : m_input{input}, m_bIsStartOfStream{true} {
 }
 
-Parser::symbol_type TokenFilter::pop() {
+Token TokenFilter::pop() {
   if (m_bIsStartOfStream) {
-    while (m_input.front().token() == Parser::token::TOK_NEWLINE) {
-      m_input.pop();
-    }
+    dropNewlines();
     m_bIsStartOfStream = false;
   }
   switch (Parser::tokenClass(m_input.front().token())) {
   case Parser::TKSeparator: // fall trough
   case Parser::TKStarter: {
-    auto ret = m_input.pop();
-    while (m_input.front().token() == Parser::token::TOK_NEWLINE) {
-      m_input.pop();
-    }
+    const auto ret = m_input.pop();
+    dropNewlines();
     return ret;
   }
 
   case Parser::TKNewline: {
-    auto newlineToken = m_input.pop();
-    while (m_input.front().token() == Parser::token::TOK_NEWLINE) {
-      m_input.pop();
-    }
+    const auto newlineToken = m_input.pop();
+    dropNewlines();
     switch (Parser::tokenClass(m_input.front().token())) {
     case Parser::TKStarter: // fall trough
     case Parser::TKComponentOrAmbigous: return newlineToken;
     case Parser::TKDelimiter: return m_input.pop(); // i.e. drop newline
     case Parser::TKNewline: assert(false); return newlineToken;
     case Parser::TKSeparator: {
-      auto ret = m_input.pop();
-      while (m_input.front().token() == Parser::token::TOK_NEWLINE) {
-        m_input.pop();
-      }
+      const auto ret = m_input.pop();
+      dropNewlines();
       return ret;
     }
     default: assert(false); return newlineToken;
@@ -52,3 +44,13 @@ Parser::symbol_type TokenFilter::pop() {
   assert(false);
   return {};
 }
+
+Parser::symbol_type TokenFilter::symbol(const Token& token) {
+  return m_input.symbol(token);
+}
+
+void TokenFilter::dropNewlines() {
+  while (m_input.front().token() == Parser::token::TOK_NEWLINE) {
+    m_input.pop();
+  }
+}
@@ -8,9 +8,13 @@ class TokenFilter : public TokenStream {
 public:
   TokenFilter(TokenStream& input);
 
-  Parser::symbol_type pop() override;
+  Token pop() override;
+  Parser::symbol_type symbol(const Token& token) override;
 
 private:
+  /** Removes all NEWLINE tokens at the front of m_input */
+  void dropNewlines();
+
   TokenStreamLookAhead m_input;
   bool m_bIsStartOfStream;
 };
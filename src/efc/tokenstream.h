@@ -1,13 +1,19 @@
 #pragma once
 #include "declutils.h"
 #include "parser.h"
+#include "token.h"
 
 class TokenStream {
 public:
   virtual ~TokenStream() = default;
 
   /** Removes and returns front token */
-  virtual Parser::symbol_type pop() = 0;
+  virtual Token pop() = 0;
+
+  /** Returns the given token, which must have been returned by pop of this
+  stream, as symbol as expected by the generated parser, i.e. including its
+  semantic value and its location. */
+  virtual Parser::symbol_type symbol(const Token& token) = 0;
 
 protected:
   TokenStream() = default;